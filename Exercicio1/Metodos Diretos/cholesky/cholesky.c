@@ -0,0 +1,291 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "cholesky.h"
+#include "gauss.h"
+#include "kernels.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#define CHOLESKY_PRAGMA(x) _Pragma(#x)
+#else
+#define CHOLESKY_PRAGMA(x)
+#endif
+
+/* Ladrilho do micro-kernel da atualização (linhas x colunas) */
+#define MK_LINHAS  KERNEL_MK_LINHAS
+#define MK_COLUNAS KERNEL_MK_COLUNAS
+
+#ifdef _OPENMP
+/* Vale a pena dividir @p linhasRestantes linhas entre as threads? */
+static int usarParalelo(int linhasRestantes) {
+    if (gaussNumThreads() <= 1 || linhasRestantes < GAUSS_CORTE_PARALELO) return 0;
+    (void) kernelNivelAtivo(); /* resolve o despacho SIMD antes de abrir as threads */
+    return 1;
+}
+#endif
+
+/*
+ * Produto escalar com 4 acumuladores (ordem de soma fixa: o resultado não
+ * depende do número de threads nem do formato de armazenamento).
+ */
+static double produtoEscalar(const double* a, const double* b, int tamanho) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    int p = 0;
+    for (; p + 4 <= tamanho; p += 4) {
+        s0 += a[p]     * b[p];
+        s1 += a[p + 1] * b[p + 1];
+        s2 += a[p + 2] * b[p + 2];
+        s3 += a[p + 3] * b[p + 3];
+    }
+    for (; p < tamanho; p++) s0 += a[p] * b[p];
+    return (s0 + s1) + (s2 + s3);
+}
+
+// ============================================================
+// FATORAÇÃO EM BLOCOS (right-looking) sobre ponteiros de linha
+//   (a) bloco diagonal L11 por produtos escalares (left-looking);
+//   (b) painel L21 = A21·L11⁻ᵀ, linha a linha;
+//   (c) A22 -= L21·L21ᵀ, só no triângulo inferior.
+// Só se acessa linhas[i][j] com j ≤ i, então a mesma rotina serve à
+// matriz cheia e ao triângulo empacotado (linha i em ap + i(i+1)/2).
+// ============================================================
+
+/* linhas[linha][j] -= L21(linha,:)·L21(j,:) para j em [colunaIni, colunaFim) */
+static void atualizarElementos(double** linhas, int linha, int colunaIni, int colunaFim,
+                               int inicioPainel, int largura) {
+    double* linhaC = linhas[linha];
+    for (int j = colunaIni; j < colunaFim; j++)
+        linhaC[j] -= produtoEscalar(linhaC + inicioPainel, linhas[j] + inicioPainel, largura);
+}
+
+/**
+ * @brief A22 -= L21·L21ᵀ no triângulo inferior de [inicioA22, n).
+ *
+ * L21ᵀ é empacotado uma vez em ladrilhos de MK_COLUNAS colunas; cada grupo de
+ * MK_LINHAS linhas empacota seu pedaço de L21 e chama o micro-kernel nos
+ * ladrilhos inteiramente abaixo da diagonal. O que sobra junto à diagonal
+ * (e as últimas linhas, se n − inicioA22 não for múltiplo de MK_LINHAS) é
+ * atualizado por produtos escalares, sem escrever acima da diagonal.
+ */
+static void atualizarSubmatriz(double** linhas, int inicioA22, int ordemMatriz,
+                               int inicioPainel, int largura, double* painelU) {
+    int colunas = ordemMatriz - inicioA22;
+    int colunasCheias = (colunas / MK_COLUNAS) * MK_COLUNAS;
+
+    for (int coluna = 0; coluna < colunasCheias; coluna += MK_COLUNAS) {
+        double* destino = painelU + (size_t)coluna * largura;
+        for (int j = 0; j < MK_COLUNAS; j++) {
+            const double* origem = linhas[inicioA22 + coluna + j] + inicioPainel;
+            for (int p = 0; p < largura; p++) destino[p * MK_COLUNAS + j] = origem[p];
+        }
+    }
+
+    int grupos = colunas / MK_LINHAS;
+    // as linhas de baixo têm mais ladrilhos: distribuição dinâmica
+    CHOLESKY_PRAGMA(omp parallel for schedule(dynamic, 4) num_threads(gaussNumThreads()) \
+                    if(usarParalelo(colunas)))
+    for (int grupo = 0; grupo < grupos; grupo++) {
+        int linha = inicioA22 + grupo * MK_LINHAS;
+        double painelL[CHOLESKY_BLOCO * MK_LINHAS];
+        for (int p = 0; p < largura; p++)
+            for (int i = 0; i < MK_LINHAS; i++)
+                painelL[p * MK_LINHAS + i] = linhas[linha + i][inicioPainel + p];
+
+        // ladrilhos com todas as colunas ≤ linha (abaixo da diagonal nas 4 linhas)
+        int limite = linha + 1 - inicioA22;
+        int coluna = 0;
+        for (; coluna + MK_COLUNAS <= limite; coluna += MK_COLUNAS) {
+            double* linhasC[MK_LINHAS];
+            for (int i = 0; i < MK_LINHAS; i++) linhasC[i] = linhas[linha + i] + inicioA22 + coluna;
+            kernelMicroAtualizacao(linhasC, painelL, painelU + (size_t)coluna * largura, largura);
+        }
+        for (int i = 0; i < MK_LINHAS; i++)
+            atualizarElementos(linhas, linha + i, inicioA22 + coluna, linha + i + 1,
+                               inicioPainel, largura);
+    }
+    for (int linha = inicioA22 + grupos * MK_LINHAS; linha < ordemMatriz; linha++)
+        atualizarElementos(linhas, linha, inicioA22, linha + 1, inicioPainel, largura);
+}
+
+static CholeskyStatus fatorarLinhas(double** linhas, int ordemMatriz, int* colunaFalha) {
+    if (colunaFalha) *colunaFalha = -1;
+
+    double* painelU = NULL;
+    if (ordemMatriz > CHOLESKY_BLOCO) {
+        painelU = (double*) malloc((size_t)CHOLESKY_BLOCO * ordemMatriz * sizeof(double));
+        if (!painelU) return CHOLESKY_MEMORIA;
+    }
+
+    for (int inicio = 0; inicio < ordemMatriz; inicio += CHOLESKY_BLOCO) {
+        int fim = (inicio + CHOLESKY_BLOCO < ordemMatriz) ? inicio + CHOLESKY_BLOCO : ordemMatriz;
+        int largura = fim - inicio;
+
+        // (a) bloco diagonal: pivô d = a_jj − Σ l_jp²; d ≤ 0 (ou NaN) => não é SPD
+        for (int j = inicio; j < fim; j++) {
+            double* linhaJ = linhas[j];
+            double pivo = linhaJ[j] - produtoEscalar(linhaJ + inicio, linhaJ + inicio, j - inicio);
+            if (!(pivo > 0.0)) {
+                if (colunaFalha) *colunaFalha = j;
+                free(painelU);
+                return CHOLESKY_NAO_SPD;
+            }
+            double diagonal = sqrt(pivo);
+            linhaJ[j] = diagonal;
+            for (int i = j + 1; i < fim; i++) {
+                double* linhaI = linhas[i];
+                linhaI[j] = (linhaI[j] - produtoEscalar(linhaI + inicio, linhaJ + inicio, j - inicio))
+                            / diagonal;
+            }
+        }
+        if (fim == ordemMatriz) break;
+
+        // (b) painel: cada linha abaixo do bloco é uma substituição com L11
+        CHOLESKY_PRAGMA(omp parallel for schedule(static) num_threads(gaussNumThreads()) \
+                        if(usarParalelo(ordemMatriz - fim)))
+        for (int i = fim; i < ordemMatriz; i++) {
+            double* linhaI = linhas[i];
+            for (int j = inicio; j < fim; j++) {
+                const double* linhaJ = linhas[j];
+                linhaI[j] = (linhaI[j] - produtoEscalar(linhaI + inicio, linhaJ + inicio, j - inicio))
+                            / linhaJ[j];
+            }
+        }
+
+        // (c) complemento de Schur
+        atualizarSubmatriz(linhas, fim, ordemMatriz, inicio, largura, painelU);
+    }
+
+    free(painelU);
+    return CHOLESKY_OK;
+}
+
+// ============================================================
+// ARMAZENAMENTO COMPLETO
+// ============================================================
+CholeskyStatus cholesky_fatorar(double** matrizA, int ordemMatriz, int* colunaFalha) {
+    return fatorarLinhas(matrizA, ordemMatriz, colunaFalha);
+}
+
+void cholesky_resolver(double** fatorL, const double* vetorB, double* vetorSolucao, int ordemMatriz) {
+    if (vetorSolucao != vetorB)
+        memcpy(vetorSolucao, vetorB, ordemMatriz * sizeof(double));
+
+    // L y = b
+    for (int i = 0; i < ordemMatriz; i++) {
+        const double* linha = fatorL[i];
+        vetorSolucao[i] = (vetorSolucao[i] - produtoEscalar(linha, vetorSolucao, i)) / linha[i];
+    }
+    // Lᵀ x = y: a coluna i de Lᵀ é a linha i de L
+    for (int i = ordemMatriz - 1; i >= 0; i--) {
+        const double* linha = fatorL[i];
+        double valor = vetorSolucao[i] / linha[i];
+        vetorSolucao[i] = valor;
+        kernelAtualizarLinha(vetorSolucao, linha, valor, i);
+    }
+}
+
+// ============================================================
+// ARMAZENAMENTO TRIANGULAR EMPACOTADO (linha i em ap + i(i+1)/2)
+// ============================================================
+size_t choleskyTamanhoEmpacotado(int ordemMatriz) {
+    return (size_t)ordemMatriz * (ordemMatriz + 1) / 2;
+}
+
+double* cholesky_empacotar(double** matrizA, int ordemMatriz) {
+    double* empacotada = (double*) malloc(choleskyTamanhoEmpacotado(ordemMatriz) * sizeof(double));
+    if (!empacotada) return NULL;
+
+    double* destino = empacotada;
+    for (int i = 0; i < ordemMatriz; i++) {
+        memcpy(destino, matrizA[i], (size_t)(i + 1) * sizeof(double));
+        destino += i + 1;
+    }
+    return empacotada;
+}
+
+CholeskyStatus cholesky_fatorar_empacotada(double* matrizEmpacotada, int ordemMatriz, int* colunaFalha) {
+    if (colunaFalha) *colunaFalha = -1;
+    if (ordemMatriz <= 0) return CHOLESKY_OK;
+
+    double** linhas = (double**) malloc(ordemMatriz * sizeof(double*));
+    if (!linhas) return CHOLESKY_MEMORIA;
+    double* inicioLinha = matrizEmpacotada;
+    for (int i = 0; i < ordemMatriz; i++) {
+        linhas[i] = inicioLinha;
+        inicioLinha += i + 1;
+    }
+
+    CholeskyStatus status = fatorarLinhas(linhas, ordemMatriz, colunaFalha);
+    free(linhas);
+    return status;
+}
+
+void cholesky_resolver_empacotada(const double* fatorEmpacotado, const double* vetorB,
+                                  double* vetorSolucao, int ordemMatriz) {
+    if (vetorSolucao != vetorB)
+        memcpy(vetorSolucao, vetorB, ordemMatriz * sizeof(double));
+
+    const double* linha = fatorEmpacotado;
+    for (int i = 0; i < ordemMatriz; i++) {
+        vetorSolucao[i] = (vetorSolucao[i] - produtoEscalar(linha, vetorSolucao, i)) / linha[i];
+        linha += i + 1;
+    }
+    for (int i = ordemMatriz - 1; i >= 0; i--) {
+        linha -= i + 1;
+        double valor = vetorSolucao[i] / linha[i];
+        vetorSolucao[i] = valor;
+        kernelAtualizarLinha(vetorSolucao, linha, valor, i);
+    }
+}
+
+// ============================================================
+// SISTEMA [A|b]: Cholesky, com recurso a Gauss
+// ============================================================
+static int simetrica(double** matriz, int ordemMatriz) {
+    for (int i = 1; i < ordemMatriz; i++)
+        for (int j = 0; j < i; j++)
+            if (matriz[i][j] != matriz[j][i]) return 0;
+    return 1;
+}
+
+GaussStatus cholesky_ou_gauss(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                              double tolerancia, CholeskyMetodo* metodo) {
+    if (metodo) *metodo = CHOLESKY_METODO_GAUSS;
+
+    double* diagonal = NULL;
+    if (simetrica(matrizEstendida, ordemMatriz))
+        diagonal = (double*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(double));
+
+    if (diagonal) {
+        for (int i = 0; i < ordemMatriz; i++) diagonal[i] = matrizEstendida[i][i];
+
+        CholeskyStatus status = cholesky_fatorar(matrizEstendida, ordemMatriz, NULL);
+        if (status == CHOLESKY_OK) {
+            for (int i = 0; i < ordemMatriz; i++) vetorSolucao[i] = matrizEstendida[i][ordemMatriz];
+            cholesky_resolver(matrizEstendida, vetorSolucao, vetorSolucao, ordemMatriz);
+            if (metodo) *metodo = CHOLESKY_METODO_CHOLESKY;
+            free(diagonal);
+            return GAUSS_OK;
+        }
+
+        // não é SPD: A volta a partir do triângulo superior, que não foi tocado
+        for (int i = 0; i < ordemMatriz; i++) {
+            for (int j = 0; j < i; j++) matrizEstendida[i][j] = matrizEstendida[j][i];
+            matrizEstendida[i][i] = diagonal[i];
+        }
+        free(diagonal);
+    }
+
+    return gauss_escalonado(matrizEstendida, ordemMatriz, vetorSolucao, tolerancia);
+}
+
+// ============================================================
+// Impressão de status
+// ============================================================
+void imprimirStatusCholesky(CholeskyStatus status) {
+    if (status == CHOLESKY_OK) puts("OK");
+    else if (status == CHOLESKY_NAO_SPD) puts("Matriz não é positivo-definida (pivô <= 0).");
+    else if (status == CHOLESKY_MEMORIA) puts("Falha de alocação de memória.");
+}
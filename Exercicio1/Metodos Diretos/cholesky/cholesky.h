@@ -0,0 +1,137 @@
+#ifndef CHOLESKY_H
+#define CHOLESKY_H
+
+/**
+ * @file cholesky.h
+ * @brief Fatoração de Cholesky A = L·Lᵀ para sistemas simétricos positivo-definidos
+ *        (SPD), em blocos, com armazenamento completo ou triangular empacotado.
+ *
+ * Custa n³/3 flops (metade dos 2n³/3 da eliminação de Gauss) e só lê e escreve
+ * o triângulo inferior de A. No formato empacotado o triângulo inferior é
+ * guardado linha a linha num único vetor de n(n+1)/2 doubles (metade da
+ * memória da matriz cheia): o elemento (i, j), j ≤ i, fica na posição
+ * i(i+1)/2 + j, de modo que cada linha de L continua contígua.
+ *
+ * A matriz não ser SPD aparece como pivô d = a_jj − Σ l_jp² ≤ 0 (ou NaN);
+ * @ref cholesky_ou_gauss usa isso para recorrer à eliminação de Gauss.
+ */
+
+#include <stddef.h>
+#include "gauss.h"
+
+/**
+ * @brief Largura dos blocos de colunas da fatoração.
+ *
+ * O bloco diagonal e o painel abaixo dele (nb colunas) são fatorados por
+ * produtos escalares; a submatriz restante recebe A22 -= L21·L21ᵀ em
+ * ladrilhos do micro-kernel (ver kernels.h).
+ */
+#ifndef CHOLESKY_BLOCO
+#define CHOLESKY_BLOCO 64
+#endif
+
+/**
+ * @brief Status de retorno das rotinas de Cholesky.
+ */
+typedef enum {
+    CHOLESKY_OK = 0,     /**< Fatoração concluída. */
+    CHOLESKY_NAO_SPD,    /**< Pivô ≤ 0: A não é (numericamente) positivo-definida. */
+    CHOLESKY_MEMORIA     /**< Falha de alocação (A não foi alterada). */
+} CholeskyStatus;
+
+/**
+ * @brief Método que resolveu o sistema em @ref cholesky_ou_gauss.
+ */
+typedef enum {
+    CHOLESKY_METODO_CHOLESKY = 0, /**< A = L·Lᵀ e duas substituições. */
+    CHOLESKY_METODO_GAUSS         /**< A não é simétrica ou não é SPD: Gauss com pivotamento escalonado. */
+} CholeskyMetodo;
+
+/**
+ * @brief Fatora A = L·Lᵀ no lugar.
+ *
+ * Só o triângulo inferior (com a diagonal) é lido e substituído por L; o
+ * triângulo superior e colunas além da n-ésima (ex.: o b de [A|b]) não são
+ * tocados. Com OpenMP (-fopenmp) as linhas do painel e da atualização são
+ * divididas entre as threads (@ref gaussDefinirThreads).
+ *
+ * @param matrizA     Matriz n × n (ou [A|b]); triângulo inferior sobrescrito por L.
+ * @param ordemMatriz Ordem n.
+ * @param colunaFalha Saída opcional (NULL): coluna do pivô ≤ 0, ou -1.
+ * @return CHOLESKY_OK, CHOLESKY_NAO_SPD (colunas anteriores já fatoradas) ou CHOLESKY_MEMORIA.
+ */
+CholeskyStatus cholesky_fatorar(double** matrizA, int ordemMatriz, int* colunaFalha);
+
+/**
+ * @brief Resolve L·Lᵀ x = b: L y = b (progressiva) e Lᵀ x = y (regressiva).
+ *
+ * As duas substituições percorrem L apenas por linhas.
+ *
+ * @param fatorL       Fator L de @ref cholesky_fatorar (só o triângulo inferior é lido).
+ * @param vetorB       Lado direito b.
+ * @param vetorSolucao Solução x (pode ser o próprio @p vetorB).
+ * @param ordemMatriz  Ordem n.
+ */
+void cholesky_resolver(double** fatorL, const double* vetorB, double* vetorSolucao, int ordemMatriz);
+
+/**
+ * @brief Número de doubles do triângulo empacotado de ordem n: n(n+1)/2.
+ */
+size_t choleskyTamanhoEmpacotado(int ordemMatriz);
+
+/**
+ * @brief Copia o triângulo inferior de A para um vetor empacotado novo.
+ *
+ * @return Vetor com n(n+1)/2 posições (libere com free), ou NULL em falha de alocação.
+ */
+double* cholesky_empacotar(double** matrizA, int ordemMatriz);
+
+/**
+ * @brief Fatora A = L·Lᵀ no formato empacotado, no lugar.
+ *
+ * Mesmo algoritmo em blocos de @ref cholesky_fatorar (mesmos resultados, bit a bit).
+ *
+ * @param matrizEmpacotada Triângulo inferior de A (n(n+1)/2 posições), sobrescrito por L.
+ * @param ordemMatriz      Ordem n.
+ * @param colunaFalha      Saída opcional (NULL): coluna do pivô ≤ 0, ou -1.
+ * @return CHOLESKY_OK, CHOLESKY_NAO_SPD ou CHOLESKY_MEMORIA.
+ */
+CholeskyStatus cholesky_fatorar_empacotada(double* matrizEmpacotada, int ordemMatriz, int* colunaFalha);
+
+/**
+ * @brief Resolve L·Lᵀ x = b com L empacotado.
+ *
+ * @param fatorEmpacotado L de @ref cholesky_fatorar_empacotada.
+ * @param vetorB          Lado direito b.
+ * @param vetorSolucao    Solução x (pode ser o próprio @p vetorB).
+ * @param ordemMatriz     Ordem n.
+ */
+void cholesky_resolver_empacotada(const double* fatorEmpacotado, const double* vetorB,
+                                  double* vetorSolucao, int ordemMatriz);
+
+/**
+ * @brief Resolve [A|b] por Cholesky e, se A não for SPD, por Gauss.
+ *
+ * A simetria é conferida antes (a_ij == a_ji exatos); matrizes não simétricas
+ * vão direto para @ref gauss_escalonado. Se a fatoração encontrar um pivô
+ * ≤ 0, o triângulo inferior é reconstruído a partir do superior (que a
+ * fatoração não altera) e da diagonal guardada, e o sistema é resolvido por
+ * Gauss: não é preciso guardar uma cópia de A.
+ *
+ * @param matrizEstendida Matriz [A|b]. Com Cholesky, L fica no triângulo
+ *                        inferior; com Gauss, sai como [U|c].
+ * @param ordemMatriz     Ordem n.
+ * @param vetorSolucao    Solução x (saída).
+ * @param tolerancia      Tolerância de pivô repassada a Gauss.
+ * @param metodo          Saída opcional (NULL): método que resolveu o sistema.
+ * @return GAUSS_OK ou o status de Gauss (GAUSS_SINGULAR).
+ */
+GaussStatus cholesky_ou_gauss(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                              double tolerancia, CholeskyMetodo* metodo);
+
+/**
+ * @brief Imprime mensagem textual correspondente ao status de Cholesky.
+ */
+void imprimirStatusCholesky(CholeskyStatus status);
+
+#endif /* CHOLESKY_H */
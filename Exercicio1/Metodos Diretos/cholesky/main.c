@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <windows.h>  // para QueryPerformanceCounter e QueryPerformanceFrequency
+#include "utils.h"
+#include "gauss.h"
+#include "cholesky.h"
+
+/**
+ * @brief Programa principal para resolução de sistemas simétricos positivo-definidos
+ *        via fatoração de Cholesky (A = L·Lᵀ), com recurso a Gauss.
+ *
+ * O sistema de teste é a matriz de Hilbert aumentada [A|b]: A é SPD, mas tão
+ * mal-condicionada que, para ordens maiores, o arredondamento pode produzir um
+ * pivô ≤ 0. Nesse caso o sistema é resolvido por Gauss com pivotamento
+ * escalonado, e o programa informa qual método foi usado.
+ *
+ * Em seguida a mesma matriz é fatorada no formato triangular empacotado
+ * (n(n+1)/2 doubles), mostrando a memória usada por cada formato.
+ */
+int main(void) {
+    // ============================================
+    // ETAPA 1: Gerar sistema linear de teste
+    // Aqui é construída a matriz de Hilbert aumentada [A|b].
+    // ============================================
+    int ordemMatriz = 12;  // pode ser alterado (a partir de 14 o pivô <= 0 leva a Gauss)
+    double tolerancia = 1e-15;
+    double** matrizEstendida = gerarHilbertAumentada(ordemMatriz);
+
+    // ============================================
+    // ETAPA 2: Preparar vetor solução
+    // Vetor x será preenchido após a resolução.
+    // ============================================
+    double* vetorSolucao = criarVetorSolucao(ordemMatriz);
+
+    // ============================================
+    // ETAPA 3: Medir tempo de execução
+    // Uso de QueryPerformanceCounter para alta precisão.
+    // ============================================
+    LARGE_INTEGER freq, inicio, fim;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&inicio);
+
+    CholeskyMetodo metodo;
+    GaussStatus status = cholesky_ou_gauss(matrizEstendida, ordemMatriz, vetorSolucao,
+                                           tolerancia, &metodo);
+
+    QueryPerformanceCounter(&fim);
+    double tempoSegundos = (double)(fim.QuadPart - inicio.QuadPart) / (double)freq.QuadPart;
+    double tempoNanoSeg  = tempoSegundos * 1e9;
+
+    // ============================================
+    // ETAPA 4: Exibir resultados
+    // Mostra método usado, status, solução aproximada e erros relativos.
+    // ============================================
+    printf("Método: %s\n", (metodo == CHOLESKY_METODO_CHOLESKY)
+                               ? "Cholesky (A = L*L^T)"
+                               : "Gauss com pivotamento escalonado (A não é SPD)");
+    imprimirStatus(status);
+    if (status == GAUSS_OK) {
+        imprimirSolucao(vetorSolucao, ordemMatriz);
+        calcularErroRelativo(vetorSolucao, ordemMatriz);
+    }
+
+    printf("\nTempo de execução: %.9f segundos (%.0f ns)\n", tempoSegundos, tempoNanoSeg);
+
+    // ============================================
+    // ETAPA 5: Formato empacotado
+    // Só o triângulo inferior é guardado: n(n+1)/2 doubles em vez de n².
+    // ============================================
+    double** matrizHilbert = gerarHilbertAumentada(ordemMatriz);
+    double* matrizEmpacotada = cholesky_empacotar(matrizHilbert, ordemMatriz);
+    if (matrizEmpacotada) {
+        double* vetorB = criarVetorSolucao(ordemMatriz);
+        for (int i = 0; i < ordemMatriz; i++) vetorB[i] = matrizHilbert[i][ordemMatriz];
+
+        int colunaFalha;
+        CholeskyStatus statusEmpacotado =
+            cholesky_fatorar_empacotada(matrizEmpacotada, ordemMatriz, &colunaFalha);
+
+        printf("\nFormato empacotado: %zu doubles (cheio: %d)\n",
+               choleskyTamanhoEmpacotado(ordemMatriz), ordemMatriz * ordemMatriz);
+        imprimirStatusCholesky(statusEmpacotado);
+        if (statusEmpacotado == CHOLESKY_OK) {
+            cholesky_resolver_empacotada(matrizEmpacotada, vetorB, vetorB, ordemMatriz);
+            calcularErroRelativo(vetorB, ordemMatriz);
+        } else if (statusEmpacotado == CHOLESKY_NAO_SPD) {
+            printf("Pivô <= 0 na coluna %d.\n", colunaFalha);
+        }
+
+        liberarVetorSolucao(vetorB);
+        free(matrizEmpacotada);
+    }
+    liberarMatriz(matrizHilbert, ordemMatriz);
+
+    // ============================================
+    // ETAPA 6: Liberar memória alocada
+    // ============================================
+    liberar(matrizEstendida, ordemMatriz, vetorSolucao);
+
+    // ============================================
+    // ETAPA 7: Encerrar com código de status
+    // Retorna 0 se execução foi bem-sucedida, 1 caso contrário.
+    // ============================================
+    return (status == GAUSS_OK) ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L  /* posix_memalign */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "utils.h"
+#ifdef _WIN32
+#include <malloc.h>  /* _aligned_malloc */
+#endif
+
+
+// ============================================================
+// Armazenamento contíguo e alinhado
+//   [cabeçalho Matriz][ponteiros de linha][preenchimento][dados]
+// ============================================================
+static void* alocarAlinhado(size_t bytes) {
+#ifdef _WIN32
+    return _aligned_malloc(bytes, MATRIZ_ALINHAMENTO);
+#else
+    void* bloco = NULL;
+    if (posix_memalign(&bloco, MATRIZ_ALINHAMENTO, bytes) != 0) return NULL;
+    return bloco;
+#endif
+}
+
+static void liberarAlinhado(void* bloco) {
+#ifdef _WIN32
+    _aligned_free(bloco);
+#else
+    free(bloco);
+#endif
+}
+
+/* Bytes do cabeçalho + ponteiros, arredondados para o alinhamento */
+static size_t tamanhoCabecalho(int nLinhas) {
+    size_t bytes = sizeof(Matriz) + (size_t)nLinhas * sizeof(double*);
+    return (bytes + MATRIZ_ALINHAMENTO - 1) / MATRIZ_ALINHAMENTO * MATRIZ_ALINHAMENTO;
+}
+
+static Matriz* montarMatriz(void* bloco, double* dados, int nLinhas, int nColunas, int passo) {
+    Matriz* matriz = (Matriz*) bloco;
+    matriz->dados    = dados;
+    matriz->linhas   = (double**) (matriz + 1);
+    matriz->nLinhas  = nLinhas;
+    matriz->nColunas = nColunas;
+    matriz->passo    = passo;
+    for (int linha = 0; linha < nLinhas; linha++) {
+        matriz->linhas[linha] = dados + (size_t)linha * passo;
+    }
+    return matriz;
+}
+
+int passoAlinhado(int nColunas) {
+    int porLinhaCache = MATRIZ_ALINHAMENTO / (int) sizeof(double);
+    return (nColunas + porLinhaCache - 1) / porLinhaCache * porLinhaCache;
+}
+
+Matriz* criarMatriz(int nLinhas, int nColunas) {
+    if (nLinhas <= 0 || nColunas <= 0) return NULL;
+
+    int passo = passoAlinhado(nColunas);
+    size_t cabecalho = tamanhoCabecalho(nLinhas);
+    size_t bytesDados = (size_t)nLinhas * (size_t)passo * sizeof(double);
+
+    char* bloco = (char*) alocarAlinhado(cabecalho + bytesDados);
+    if (!bloco) return NULL;
+
+    Matriz* matriz = montarMatriz(bloco, (double*)(bloco + cabecalho), nLinhas, nColunas, passo);
+
+    // zera as colunas de preenchimento (nunca lidas pelos métodos, mas determinísticas)
+    for (int linha = 0; linha < nLinhas; linha++) {
+        for (int coluna = nColunas; coluna < passo; coluna++) {
+            matriz->linhas[linha][coluna] = 0.0;
+        }
+    }
+    return matriz;
+}
+
+Matriz* criarVisaoMatriz(double* dados, int nLinhas, int nColunas, int passo) {
+    if (!dados || nLinhas <= 0 || nColunas <= 0 || passo < nColunas) return NULL;
+
+    void* bloco = alocarAlinhado(tamanhoCabecalho(nLinhas));
+    if (!bloco) return NULL;
+    return montarMatriz(bloco, dados, nLinhas, nColunas, passo);
+}
+
+Matriz* matrizDe(double** linhas) {
+    return linhas ? ((Matriz*) linhas) - 1 : NULL;
+}
+
+void destruirMatriz(Matriz* matriz) {
+    if (matriz) liberarAlinhado(matriz);
+}
+
+void imprimirMatriz(double** matrizEstendida, int ordemMatriz) {
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        for (int coluna = 0; coluna < ordemMatriz + 1; coluna++) {
+            printf("%8.3f ", matrizEstendida[linha][coluna]);
+        }
+        printf("\n");
+    }
+}
+
+void liberarMatriz(double** matrizEstendida, int ordemMatriz) {
+    (void) ordemMatriz; // bloco único: não há linhas a liberar individualmente
+    destruirMatriz(matrizDe(matrizEstendida));
+}
+
+double* criarVetorSolucao(int ordemMatriz) {
+    double* vetorSolucao = (double*) malloc(ordemMatriz * sizeof(double));
+    if (!vetorSolucao) {
+        fprintf(stderr, "Erro: não foi possível alocar vetor solução.\n");
+        exit(1);
+    }
+    return vetorSolucao;
+}
+
+void liberarVetorSolucao(double* vetorSolucao) {
+    free(vetorSolucao);
+}
+
+void imprimirSolucao(const double* vetorSolucao, int ordemMatriz) {
+    printf("Solucao do sistema:\n");
+    for (int i = 0; i < ordemMatriz; i++) {
+        printf("x[%d] = %.16e\n", i, vetorSolucao[i]);
+    }
+}
+
+void liberar(double** matrizEstendida, int ordemMatriz, double* vetorSolucao) {
+    if (vetorSolucao) {
+        free(vetorSolucao);
+    }
+    if (matrizEstendida) {
+        liberarMatriz(matrizEstendida, ordemMatriz);
+    }
+}
+
+double** gerarHilbertAumentada(int ordemMatriz) {
+    if (ordemMatriz <= 0) {
+        fprintf(stderr, "Erro: ordem da Hilbert deve ser positiva.\n");
+        exit(1);
+    }
+
+    // Aloca [A|b] com n linhas e n+1 colunas em um único bloco alinhado
+    Matriz* matriz = criarMatriz(ordemMatriz, ordemMatriz + 1);
+    if (!matriz) { perror("malloc"); exit(1); }
+    double** matrizAumentada = matriz->linhas;
+
+    // Preenche A e b (A_ij = 1/(i+j-1); aqui com índices 0-based → 1/(i+j+1))
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        double somaDaLinha = 0.0;
+        for (int coluna = 0; coluna < ordemMatriz; coluna++) {
+            double a_ij = 1.0 / (double)(linha + coluna + 1);
+            matrizAumentada[linha][coluna] = a_ij;
+            somaDaLinha += a_ij;
+        }
+        matrizAumentada[linha][ordemMatriz] = somaDaLinha; // b_linha = soma dos coeficientes da linha
+    }
+
+    return matrizAumentada;
+}
+
+void calcularErroRelativo(const double* vetorSolucao, int ordemMatriz) {
+    double somaErrosPercentual = 0.0;
+    double erroPercentualMaximo = 0.0;
+
+    printf("\nErros relativos (em %%):\n");
+    for (int i = 0; i < ordemMatriz; i++) {
+        // solução exata é 1.0  →  erro_i(%) = |x_i - 1| * 100
+        double erroPercentual = fabs(vetorSolucao[i] - 1.0) * 100.0;
+        printf("A[%d] = %.6e %%\n", i, erroPercentual);
+
+        somaErrosPercentual += erroPercentual;
+        if (erroPercentual > erroPercentualMaximo) {
+            erroPercentualMaximo = erroPercentual;
+        }
+    }
+
+    double erroPercentualMedio = (ordemMatriz > 0) ? (somaErrosPercentual / ordemMatriz) : 0.0;
+    printf("\nErro relativo médio = %.6e %%\n", erroPercentualMedio);
+    printf("Erro relativo máximo = %.6e %%\n", erroPercentualMaximo);
+}
@@ -0,0 +1,152 @@
+#ifndef UTILS_H
+#define UTILS_H
+
+/**
+ * @brief Alinhamento (em bytes) do buffer das matrizes: uma linha de cache.
+ */
+#define MATRIZ_ALINHAMENTO 64
+
+/**
+ * @brief Matriz densa armazenada em um único bloco contíguo alinhado.
+ *
+ * Cabeçalho, vetor de ponteiros de linha e dados vivem em **uma só alocação**.
+ * As linhas físicas começam em `dados + i * passo`, com `passo` arredondado
+ * para múltiplo de uma linha de cache (colunas de preenchimento valem 0).
+ *
+ * O campo `linhas` é a visão `double**` usada por todas as rotinas existentes.
+ * Trocas de linha feitas pelos métodos (troca de ponteiros) alteram só essa
+ * visão: `dados` continua na ordem física de alocação.
+ */
+typedef struct {
+    double*  dados;    /**< Início do buffer contíguo (alinhado a MATRIZ_ALINHAMENTO). */
+    double** linhas;   /**< Visão por ponteiros de linha (compatível com double**). */
+    int      nLinhas;  /**< Número de linhas. */
+    int      nColunas; /**< Número de colunas úteis. */
+    int      passo;    /**< Distância, em doubles, entre linhas físicas consecutivas. */
+} Matriz;
+
+/**
+ * @brief Calcula o passo (em doubles) de uma linha com @p nColunas colunas,
+ *        arredondado para múltiplo de MATRIZ_ALINHAMENTO bytes.
+ */
+int passoAlinhado(int nColunas);
+
+/**
+ * @brief Cria uma matriz nLinhas × nColunas em um único bloco alinhado (1 malloc).
+ *
+ * O conteúdo útil não é inicializado (como em malloc); o preenchimento é zerado.
+ *
+ * @param nLinhas  Número de linhas (>= 1).
+ * @param nColunas Número de colunas (>= 1).
+ * @return Ponteiro para a matriz, ou NULL em falha de alocação.
+ */
+Matriz* criarMatriz(int nLinhas, int nColunas);
+
+/**
+ * @brief Cria uma visão Matriz (cabeçalho + ponteiros de linha) sobre um buffer externo.
+ *
+ * Útil para envolver dados já existentes (ex.: arquivos mapeados) sem copiá-los.
+ * @ref destruirMatriz libera apenas a visão, nunca @p dados.
+ *
+ * @param dados    Buffer externo (linha i em dados + i * passo).
+ * @param nLinhas  Número de linhas.
+ * @param nColunas Número de colunas úteis.
+ * @param passo    Distância, em doubles, entre linhas (>= nColunas).
+ * @return Ponteiro para a visão, ou NULL em falha de alocação.
+ */
+Matriz* criarVisaoMatriz(double* dados, int nLinhas, int nColunas, int passo);
+
+/**
+ * @brief Recupera a Matriz a partir da visão `double**` devolvida em `linhas`.
+ *
+ * Válido apenas para ponteiros obtidos de @ref criarMatriz / @ref criarVisaoMatriz.
+ */
+Matriz* matrizDe(double** linhas);
+
+/**
+ * @brief Libera a matriz (uma única chamada de free).
+ *
+ * @param matriz Matriz a liberar (NULL é ignorado).
+ */
+void destruirMatriz(Matriz* matriz);
+
+/**
+ * @brief Imprime a matriz estendida [A|b] no console.
+ *
+ * Cada linha contém os coeficientes da matriz A seguidos do termo independente b.
+ *
+ * @param matrizEstendida Ponteiro para a matriz estendida [A|b].
+ * @param ordemMatriz Ordem da matriz quadrada A.
+ */
+void imprimirMatriz(double** matrizEstendida, int ordemMatriz);
+
+/**
+ * @brief Libera a memória alocada para a matriz estendida [A|b].
+ *
+ * A matriz deve ter sido criada por @ref gerarHilbertAumentada ou @ref criarMatriz.
+ *
+ * @param matrizEstendida Ponteiro para a matriz a ser liberada.
+ * @param ordemMatriz Ordem da matriz quadrada A.
+ */
+void liberarMatriz(double** matrizEstendida, int ordemMatriz);
+
+/**
+ * @brief Cria e aloca o vetor solução x.
+ *
+ * @param ordemMatriz Dimensão do sistema (n).
+ * @return Ponteiro para o vetor solução alocado dinamicamente.
+ */
+double* criarVetorSolucao(int ordemMatriz);
+
+/**
+ * @brief Libera a memória ocupada pelo vetor solução.
+ *
+ * @param vetorSolucao Ponteiro para o vetor solução a ser liberado.
+ */
+void liberarVetorSolucao(double* vetorSolucao);
+
+/**
+ * @brief Imprime no console o vetor solução x.
+ *
+ * Mostra cada componente do vetor em notação científica com alta precisão.
+ *
+ * @param vetorSolucao Ponteiro para o vetor solução.
+ * @param ordemMatriz Dimensão do sistema (n).
+ */
+void imprimirSolucao(const double* vetorSolucao, int ordemMatriz);
+
+/**
+ * @brief Libera a matriz estendida [A|b] e o vetor solução em uma única chamada.
+ *
+ * @param matrizEstendida Ponteiro para a matriz estendida a ser liberada.
+ * @param ordemMatriz Ordem da matriz quadrada A.
+ * @param vetorSolucao Ponteiro para o vetor solução a ser liberado.
+ */
+void liberar(double** matrizEstendida, int ordemMatriz, double* vetorSolucao);
+
+/**
+ * @brief Gera a matriz de Hilbert aumentada [A|b] de ordem n.
+ *
+ * A matriz A é definida como:
+ *   A_ij = 1 / (i + j - 1), para i,j iniciando em 1.
+ * O vetor b é a soma dos elementos de cada linha de A.
+ *
+ * @param ordemMatriz Ordem da matriz (n).
+ * @return Ponteiro para a matriz estendida [A|b].
+ */
+double** gerarHilbertAumentada(int ordemMatriz);
+
+/**
+ * @brief Calcula e imprime os erros relativos entre a solução obtida e a solução exata (1,...,1)^T.
+ *
+ * Para cada componente x_i, calcula:
+ *   erro_i = |x_i - 1| / |1| * 100%
+ *
+ * Também imprime o erro médio e o erro máximo.
+ *
+ * @param vetorSolucao Ponteiro para o vetor solução aproximada.
+ * @param ordemMatriz Dimensão do sistema (n).
+ */
+void calcularErroRelativo(const double* vetorSolucao, int ordemMatriz);
+
+#endif
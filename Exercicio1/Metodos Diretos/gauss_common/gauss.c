@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <math.h>
 #include "gauss.h"
+#include "kernels.h"
 
 // ===============================================
 // ELIMINAÇÃO DE GAUSS (sem pivotamento, sem guardas)
@@ -16,10 +17,9 @@ GaussStatus eliminacao(double** matrizEstendida, int ordemMatriz) {
             if (multiplicador == 0.0) continue; // nada a fazer nesta linha
 
             // Atualiza toda a linha (inclui o termo independente na última coluna)
-            for (int colunaAtual = indicePivo; colunaAtual <= ordemMatriz; colunaAtual++) {
-                matrizEstendida[linhaAtual][colunaAtual] -=
-                    multiplicador * matrizEstendida[indicePivo][colunaAtual];
-            }
+            kernelAtualizarLinha(matrizEstendida[linhaAtual] + indicePivo,
+                                 matrizEstendida[indicePivo] + indicePivo,
+                                 multiplicador, ordemMatriz - indicePivo + 1);
         }
     }
 
@@ -43,9 +43,9 @@ GaussStatus eliminacao_com_tolerancia(double** matrizEstendida, int ordemMatriz,
             double multiplicador = matrizEstendida[linhaAtual][indicePivo] / pivo;
             if (multiplicador == 0.0) continue;
 
-            for (int colunaAtual = indicePivo; colunaAtual <= ordemMatriz; colunaAtual++) {
-                matrizEstendida[linhaAtual][colunaAtual] -= multiplicador * matrizEstendida[indicePivo][colunaAtual];
-            }
+            kernelAtualizarLinha(matrizEstendida[linhaAtual] + indicePivo,
+                                 matrizEstendida[indicePivo] + indicePivo,
+                                 multiplicador, ordemMatriz - indicePivo + 1);
         }
     }
 
@@ -1,9 +1,98 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L  /* posix_memalign */
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 #include "utils.h"
+#ifdef _WIN32
+#include <malloc.h>  /* _aligned_malloc */
+#endif
+
+
+
+// ============================================================
+// Armazenamento contíguo e alinhado
+//   [cabeçalho Matriz][ponteiros de linha][preenchimento][dados]
+// ============================================================
+static void* alocarAlinhado(size_t bytes) {
+#ifdef _WIN32
+    return _aligned_malloc(bytes, MATRIZ_ALINHAMENTO);
+#else
+    void* bloco = NULL;
+    if (posix_memalign(&bloco, MATRIZ_ALINHAMENTO, bytes) != 0) return NULL;
+    return bloco;
+#endif
+}
+
+static void liberarAlinhado(void* bloco) {
+#ifdef _WIN32
+    _aligned_free(bloco);
+#else
+    free(bloco);
+#endif
+}
+
+/* Bytes do cabeçalho + ponteiros, arredondados para o alinhamento */
+static size_t tamanhoCabecalho(int nLinhas) {
+    size_t bytes = sizeof(Matriz) + (size_t)nLinhas * sizeof(double*);
+    return (bytes + MATRIZ_ALINHAMENTO - 1) / MATRIZ_ALINHAMENTO * MATRIZ_ALINHAMENTO;
+}
 
+static Matriz* montarMatriz(void* bloco, double* dados, int nLinhas, int nColunas, int passo) {
+    Matriz* matriz = (Matriz*) bloco;
+    matriz->dados    = dados;
+    matriz->linhas   = (double**) (matriz + 1);
+    matriz->nLinhas  = nLinhas;
+    matriz->nColunas = nColunas;
+    matriz->passo    = passo;
+    for (int linha = 0; linha < nLinhas; linha++) {
+        matriz->linhas[linha] = dados + (size_t)linha * passo;
+    }
+    return matriz;
+}
 
+int passoAlinhado(int nColunas) {
+    int porLinhaCache = MATRIZ_ALINHAMENTO / (int) sizeof(double);
+    return (nColunas + porLinhaCache - 1) / porLinhaCache * porLinhaCache;
+}
+
+Matriz* criarMatriz(int nLinhas, int nColunas) {
+    if (nLinhas <= 0 || nColunas <= 0) return NULL;
+
+    int passo = passoAlinhado(nColunas);
+    size_t cabecalho = tamanhoCabecalho(nLinhas);
+    size_t bytesDados = (size_t)nLinhas * (size_t)passo * sizeof(double);
+
+    char* bloco = (char*) alocarAlinhado(cabecalho + bytesDados);
+    if (!bloco) return NULL;
+
+    Matriz* matriz = montarMatriz(bloco, (double*)(bloco + cabecalho), nLinhas, nColunas, passo);
+
+    // zera as colunas de preenchimento (nunca lidas pelos métodos, mas determinísticas)
+    for (int linha = 0; linha < nLinhas; linha++) {
+        for (int coluna = nColunas; coluna < passo; coluna++) {
+            matriz->linhas[linha][coluna] = 0.0;
+        }
+    }
+    return matriz;
+}
+
+Matriz* criarVisaoMatriz(double* dados, int nLinhas, int nColunas, int passo) {
+    if (!dados || nLinhas <= 0 || nColunas <= 0 || passo < nColunas) return NULL;
+
+    void* bloco = alocarAlinhado(tamanhoCabecalho(nLinhas));
+    if (!bloco) return NULL;
+    return montarMatriz(bloco, dados, nLinhas, nColunas, passo);
+}
+
+Matriz* matrizDe(double** linhas) {
+    return linhas ? ((Matriz*) linhas) - 1 : NULL;
+}
+
+void destruirMatriz(Matriz* matriz) {
+    if (matriz) liberarAlinhado(matriz);
+}
 
 void imprimirMatriz(double** matrizEstendida, int ordemMatriz) {
     for (int linha = 0; linha < ordemMatriz; linha++) {
@@ -15,10 +104,8 @@ void imprimirMatriz(double** matrizEstendida, int ordemMatriz) {
 }
 
 void liberarMatriz(double** matrizEstendida, int ordemMatriz) {
-    for (int linha = 0; linha < ordemMatriz; linha++) {
-        free(matrizEstendida[linha]);
-    }
-    free(matrizEstendida);
+    (void) ordemMatriz; // bloco único: não há linhas a liberar individualmente
+    destruirMatriz(matrizDe(matrizEstendida));
 }
 
 double* criarVetorSolucao(int ordemMatriz) {
@@ -46,10 +133,7 @@ void liberar(double** matrizEstendida, int ordemMatriz, double* vetorSolucao) {
         free(vetorSolucao);
     }
     if (matrizEstendida) {
-        for (int linha = 0; linha < ordemMatriz; linha++) {
-            free(matrizEstendida[linha]);
-        }
-        free(matrizEstendida);
+        liberarMatriz(matrizEstendida, ordemMatriz);
     }
 }
 
@@ -59,14 +143,10 @@ double** gerarHilbertAumentada(int ordemMatriz) {
         exit(1);
     }
 
-    // Aloca [A|b] com n linhas e n+1 colunas
-    double** matrizAumentada = (double**) malloc(ordemMatriz * sizeof(double*));
-    if (!matrizAumentada) { perror("malloc"); exit(1); }
-
-    for (int linha = 0; linha < ordemMatriz; linha++) {
-        matrizAumentada[linha] = (double*) malloc((ordemMatriz + 1) * sizeof(double));
-        if (!matrizAumentada[linha]) { perror("malloc"); exit(1); }
-    }
+    // Aloca [A|b] com n linhas e n+1 colunas em um único bloco alinhado
+    Matriz* matriz = criarMatriz(ordemMatriz, ordemMatriz + 1);
+    if (!matriz) { perror("malloc"); exit(1); }
+    double** matrizAumentada = matriz->linhas;
 
     // Preenche A e b (A_ij = 1/(i+j-1); aqui com índices 0-based → 1/(i+j+1))
     for (int linha = 0; linha < ordemMatriz; linha++) {
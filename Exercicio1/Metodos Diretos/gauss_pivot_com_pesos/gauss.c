@@ -2,6 +2,45 @@
 #include <stdlib.h>
 #include <math.h>
 #include "gauss.h"
+#include "kernels.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#define GAUSS_PRAGMA(x) _Pragma(#x)
+#else
+#define GAUSS_PRAGMA(x)
+#endif
+
+// ============================================================
+// CONFIGURAÇÃO DO PARALELISMO (fase de atualização)
+// ============================================================
+static int g_numThreads = 0;                       /* <= 0: padrão do OpenMP */
+static int g_corteParalelo = GAUSS_CORTE_PARALELO; /* linhas restantes mínimas */
+
+void gaussDefinirThreads(int numThreads) {
+    g_numThreads = numThreads;
+}
+
+void gaussDefinirCorteParalelo(int linhasMinimas) {
+    g_corteParalelo = linhasMinimas;
+}
+
+int gaussNumThreads(void) {
+#ifdef _OPENMP
+    return (g_numThreads > 0) ? g_numThreads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+#ifdef _OPENMP
+/* Vale a pena abrir a região paralela para @p linhasRestantes linhas? */
+static int usarParalelo(int linhasRestantes) {
+    if (gaussNumThreads() <= 1 || linhasRestantes < g_corteParalelo) return 0;
+    (void) kernelNivelAtivo(); /* resolve o despacho SIMD antes de abrir as threads */
+    return 1;
+}
+#endif
 
 // ============================================================
 // ELIMINAÇÃO DE GAUSS — pivotamento escalonado (com pesos)
@@ -59,15 +98,16 @@ GaussStatus eliminacao_escalonada(double** matrizEstendida, int ordemMatriz, dou
             return GAUSS_SINGULAR;
         }
 
-        // zera abaixo do pivô
+        // zera abaixo do pivô (linhas independentes: paralelizável)
+        GAUSS_PRAGMA(omp parallel for schedule(static) num_threads(gaussNumThreads()) \
+                     if(usarParalelo(ordemMatriz - colunaPivo - 1)))
         for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
             double multiplicador = matrizEstendida[linha][colunaPivo] / pivo;
             if (multiplicador == 0.0) continue;
 
-            for (int coluna = colunaPivo; coluna <= ordemMatriz; coluna++) {
-                matrizEstendida[linha][coluna] -=
-                    multiplicador * matrizEstendida[colunaPivo][coluna];
-            }
+            kernelAtualizarLinha(matrizEstendida[linha] + colunaPivo,
+                                 matrizEstendida[colunaPivo] + colunaPivo,
+                                 multiplicador, ordemMatriz - colunaPivo + 1);
         }
     }
 
@@ -125,14 +165,15 @@ GaussStatus eliminacao_escalonada_sem_tolerancia(double** matrizEstendida, int o
         double pivo = matrizEstendida[colunaPivo][colunaPivo];
         // sem checagem de tolerância: segue mesmo que pivo seja muito pequeno
 
+        GAUSS_PRAGMA(omp parallel for schedule(static) num_threads(gaussNumThreads()) \
+                     if(usarParalelo(ordemMatriz - colunaPivo - 1)))
         for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
             double multiplicador = matrizEstendida[linha][colunaPivo] / pivo;
             if (multiplicador == 0.0) continue;
 
-            for (int coluna = colunaPivo; coluna <= ordemMatriz; coluna++) {
-                matrizEstendida[linha][coluna] -=
-                    multiplicador * matrizEstendida[colunaPivo][coluna];
-            }
+            kernelAtualizarLinha(matrizEstendida[linha] + colunaPivo,
+                                 matrizEstendida[colunaPivo] + colunaPivo,
+                                 multiplicador, ordemMatriz - colunaPivo + 1);
         }
     }
 
@@ -10,6 +10,14 @@ typedef enum {
     GAUSS_INCONSISTENTE = 2 /**< Sistema inconsistente (linha nula em A com b ≠ 0). */
 } GaussStatus;
 
+/**
+ * @brief Número mínimo de linhas restantes para paralelizar a atualização
+ *        (abaixo disso o custo de sincronização supera o ganho).
+ */
+#ifndef GAUSS_CORTE_PARALELO
+#define GAUSS_CORTE_PARALELO 256
+#endif
+
 /**
  * @brief Eliminação de Gauss com pivotamento escalonado (com pesos) — COM tolerância.
  *
@@ -79,6 +87,27 @@ GaussStatus gauss_escalonado(double** matrizEstendida, int ordemMatriz, double*
  */
 GaussStatus gauss_escalonado_sem_tolerancia(double** matrizEstendida, int ordemMatriz, double* vetorSolucao);
 
+/**
+ * @brief Define quantas threads a fase de atualização (eliminação das linhas
+ *        abaixo do pivô) pode usar. Só tem efeito se compilado com OpenMP (-fopenmp).
+ *
+ * @param numThreads Número de threads (<= 0 volta ao padrão do OpenMP / OMP_NUM_THREADS).
+ */
+void gaussDefinirThreads(int numThreads);
+
+/**
+ * @brief Define o corte serial: etapas com menos de @p linhasMinimas linhas
+ *        abaixo do pivô rodam em uma única thread.
+ *
+ * @param linhasMinimas Número mínimo de linhas (padrão: GAUSS_CORTE_PARALELO).
+ */
+void gaussDefinirCorteParalelo(int linhasMinimas);
+
+/**
+ * @brief Número de threads efetivamente usado na atualização (1 sem OpenMP).
+ */
+int gaussNumThreads(void);
+
 /**
  * @brief Imprime mensagem textual correspondente ao status do método de Gauss.
  *
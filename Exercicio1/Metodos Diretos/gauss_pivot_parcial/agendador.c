@@ -0,0 +1,269 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L  /* sysconf */
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "agendador.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+typedef struct {
+    AgendadorFuncao funcao;
+    void* contexto;
+    int argumentos[AGENDADOR_ARGUMENTOS];
+} Tarefa;
+
+/* Fila dupla circular de um trabalhador (protegida pela própria trava) */
+typedef struct {
+    pthread_mutex_t trava;
+    Tarefa* tarefas;
+    int capacidade; /* potência de 2 */
+    int inicio;     /* índice da tarefa mais antiga */
+    int quantidade;
+} Fila;
+
+struct Agendador {
+    Fila* filas;
+    pthread_t* threads;
+    int numTrabalhadores;
+    int threadsCriadas;
+
+    /* Estado global: tarefas nas filas, tarefas ainda não terminadas e encerramento */
+    pthread_mutex_t trava;
+    pthread_cond_t mudou;
+    int disponiveis;
+    int pendentes;
+    int encerrar;
+};
+
+typedef struct {
+    Agendador* agendador;
+    int indice;
+} ArgumentoThread;
+
+// ============================================================
+// Filas
+// ============================================================
+static int iniciarFila(Fila* fila) {
+    fila->capacidade = 64;
+    fila->inicio = 0;
+    fila->quantidade = 0;
+    fila->tarefas = (Tarefa*) malloc(fila->capacidade * sizeof(Tarefa));
+    if (!fila->tarefas) return 0;
+    pthread_mutex_init(&fila->trava, NULL);
+    return 1;
+}
+
+static void encerrarFila(Fila* fila) {
+    pthread_mutex_destroy(&fila->trava);
+    free(fila->tarefas);
+}
+
+/* Chamada com a trava da fila */
+static int crescerFila(Fila* fila) {
+    int novaCapacidade = fila->capacidade * 2;
+    Tarefa* novas = (Tarefa*) malloc(novaCapacidade * sizeof(Tarefa));
+    if (!novas) return 0;
+    for (int i = 0; i < fila->quantidade; i++) {
+        novas[i] = fila->tarefas[(fila->inicio + i) & (fila->capacidade - 1)];
+    }
+    free(fila->tarefas);
+    fila->tarefas = novas;
+    fila->capacidade = novaCapacidade;
+    fila->inicio = 0;
+    return 1;
+}
+
+/* Dono: retira a mais recente (LIFO) */
+static int retirarDoFim(Fila* fila, Tarefa* tarefa) {
+    pthread_mutex_lock(&fila->trava);
+    int achou = fila->quantidade > 0;
+    if (achou) {
+        fila->quantidade--;
+        *tarefa = fila->tarefas[(fila->inicio + fila->quantidade) & (fila->capacidade - 1)];
+    }
+    pthread_mutex_unlock(&fila->trava);
+    return achou;
+}
+
+/* Ladrão: retira a mais antiga (FIFO) */
+static int roubarDoInicio(Fila* fila, Tarefa* tarefa) {
+    pthread_mutex_lock(&fila->trava);
+    int achou = fila->quantidade > 0;
+    if (achou) {
+        *tarefa = fila->tarefas[fila->inicio];
+        fila->inicio = (fila->inicio + 1) & (fila->capacidade - 1);
+        fila->quantidade--;
+    }
+    pthread_mutex_unlock(&fila->trava);
+    return achou;
+}
+
+// ============================================================
+// Trabalhadores
+// ============================================================
+static int buscarTarefa(Agendador* agendador, int indice, Tarefa* tarefa) {
+    if (retirarDoFim(&agendador->filas[indice], tarefa)) return 1;
+    for (int passo = 1; passo < agendador->numTrabalhadores; passo++) {
+        int vitima = (indice + passo) % agendador->numTrabalhadores;
+        if (roubarDoInicio(&agendador->filas[vitima], tarefa)) return 1;
+    }
+    return 0;
+}
+
+/*
+ * Laço de um trabalhador. Com @p ateAcabar, volta quando não houver tarefas
+ * pendentes (thread chamadora); senão, só quando o pool for encerrado.
+ */
+static void trabalhar(Agendador* agendador, int indice, int ateAcabar) {
+    Tarefa tarefa;
+    for (;;) {
+        if (buscarTarefa(agendador, indice, &tarefa)) {
+            pthread_mutex_lock(&agendador->trava);
+            agendador->disponiveis--;
+            pthread_mutex_unlock(&agendador->trava);
+
+            tarefa.funcao(tarefa.contexto, tarefa.argumentos, indice);
+
+            pthread_mutex_lock(&agendador->trava);
+            if (--agendador->pendentes == 0) pthread_cond_broadcast(&agendador->mudou);
+            pthread_mutex_unlock(&agendador->trava);
+            continue;
+        }
+
+        pthread_mutex_lock(&agendador->trava);
+        for (;;) {
+            if (ateAcabar ? agendador->pendentes == 0 : agendador->encerrar) {
+                pthread_mutex_unlock(&agendador->trava);
+                return;
+            }
+            if (agendador->disponiveis > 0) break;
+            pthread_cond_wait(&agendador->mudou, &agendador->trava);
+        }
+        pthread_mutex_unlock(&agendador->trava);
+    }
+}
+
+static void* corpoThread(void* argumento) {
+    ArgumentoThread* dados = (ArgumentoThread*) argumento;
+    trabalhar(dados->agendador, dados->indice, 0);
+    free(dados);
+    return NULL;
+}
+
+// ============================================================
+// Interface pública
+// ============================================================
+Agendador* criarAgendador(int numTrabalhadores) {
+    if (numTrabalhadores < 1) numTrabalhadores = 1;
+    Agendador* agendador = (Agendador*) calloc(1, sizeof(Agendador));
+    if (!agendador) return NULL;
+
+    agendador->filas = (Fila*) calloc(numTrabalhadores, sizeof(Fila));
+    agendador->threads = (pthread_t*) calloc(numTrabalhadores, sizeof(pthread_t));
+    if (!agendador->filas || !agendador->threads) {
+        free(agendador->filas); free(agendador->threads); free(agendador);
+        return NULL;
+    }
+    pthread_mutex_init(&agendador->trava, NULL);
+    pthread_cond_init(&agendador->mudou, NULL);
+
+    for (int i = 0; i < numTrabalhadores; i++) {
+        if (!iniciarFila(&agendador->filas[i])) {
+            agendador->numTrabalhadores = i;
+            destruirAgendador(agendador);
+            return NULL;
+        }
+        agendador->numTrabalhadores = i + 1;
+    }
+
+    /* trabalhador 0 é a thread chamadora */
+    for (int i = 1; i < numTrabalhadores; i++) {
+        ArgumentoThread* dados = (ArgumentoThread*) malloc(sizeof(ArgumentoThread));
+        if (dados) {
+            dados->agendador = agendador;
+            dados->indice = i;
+        }
+        if (!dados || pthread_create(&agendador->threads[i], NULL, corpoThread, dados) != 0) {
+            free(dados);
+            destruirAgendador(agendador);
+            return NULL;
+        }
+        agendador->threadsCriadas = i;
+    }
+    return agendador;
+}
+
+void destruirAgendador(Agendador* agendador) {
+    if (!agendador) return;
+    pthread_mutex_lock(&agendador->trava);
+    agendador->encerrar = 1;
+    pthread_cond_broadcast(&agendador->mudou);
+    pthread_mutex_unlock(&agendador->trava);
+
+    for (int i = 1; i <= agendador->threadsCriadas; i++) {
+        pthread_join(agendador->threads[i], NULL);
+    }
+    for (int i = 0; i < agendador->numTrabalhadores; i++) encerrarFila(&agendador->filas[i]);
+    pthread_cond_destroy(&agendador->mudou);
+    pthread_mutex_destroy(&agendador->trava);
+    free(agendador->filas);
+    free(agendador->threads);
+    free(agendador);
+}
+
+int agendadorNumTrabalhadores(const Agendador* agendador) {
+    return agendador->numTrabalhadores;
+}
+
+int agendadorSubmeter(Agendador* agendador, int trabalhador, AgendadorFuncao funcao,
+                      void* contexto, int arg0, int arg1, int arg2) {
+    /* Conta antes de enfileirar: "pendentes" nunca chega a 0 com a tarefa viva */
+    pthread_mutex_lock(&agendador->trava);
+    agendador->disponiveis++;
+    agendador->pendentes++;
+    pthread_mutex_unlock(&agendador->trava);
+
+    Fila* fila = &agendador->filas[trabalhador];
+    pthread_mutex_lock(&fila->trava);
+    int cabe = fila->quantidade < fila->capacidade || crescerFila(fila);
+    if (cabe) {
+        Tarefa* tarefa = &fila->tarefas[(fila->inicio + fila->quantidade) & (fila->capacidade - 1)];
+        tarefa->funcao = funcao;
+        tarefa->contexto = contexto;
+        tarefa->argumentos[0] = arg0;
+        tarefa->argumentos[1] = arg1;
+        tarefa->argumentos[2] = arg2;
+        fila->quantidade++;
+    }
+    pthread_mutex_unlock(&fila->trava);
+
+    pthread_mutex_lock(&agendador->trava);
+    if (cabe) {
+        pthread_cond_signal(&agendador->mudou);
+    } else {
+        agendador->disponiveis--;
+        if (--agendador->pendentes == 0) pthread_cond_broadcast(&agendador->mudou);
+    }
+    pthread_mutex_unlock(&agendador->trava);
+    return cabe;
+}
+
+void agendadorExecutar(Agendador* agendador) {
+    trabalhar(agendador, 0, 1);
+}
+
+int agendadorNumProcessadores(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+#else
+    long numero = sysconf(_SC_NPROCESSORS_ONLN);
+    return numero > 0 ? (int) numero : 1;
+#endif
+}
@@ -0,0 +1,80 @@
+#ifndef AGENDADOR_H
+#define AGENDADOR_H
+
+/**
+ * @file agendador.h
+ * @brief Pool de threads com roubo de tarefas (work stealing), usado pelo
+ *        motor de tarefas da eliminação em blocos.
+ *
+ * Cada trabalhador tem sua própria fila dupla: ele empilha e retira tarefas
+ * pelo fim (LIFO, o que mantém os dados recém-tocados em cache), e os
+ * trabalhadores ociosos roubam pelo início (FIFO, as tarefas mais antigas).
+ * Tarefas podem submeter novas tarefas; as dependências ficam a cargo de quem
+ * as submete (uma tarefa só é submetida quando já pode rodar).
+ *
+ * A thread que chama @ref agendadorExecutar participa como trabalhador 0.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Número de argumentos inteiros guardados em cada tarefa. */
+#define AGENDADOR_ARGUMENTOS 3
+
+/**
+ * @brief Corpo de uma tarefa.
+ *
+ * @param contexto    Ponteiro comum passado na submissão.
+ * @param argumentos  AGENDADOR_ARGUMENTOS inteiros da tarefa.
+ * @param trabalhador Índice do trabalhador que a executa (0..numTrabalhadores-1),
+ *                    útil para áreas de rascunho por thread.
+ */
+typedef void (*AgendadorFuncao)(void* contexto, const int* argumentos, int trabalhador);
+
+typedef struct Agendador Agendador;
+
+/**
+ * @brief Cria o pool com @p numTrabalhadores trabalhadores (numTrabalhadores - 1 threads novas).
+ *
+ * @return O agendador, ou NULL em falha de alocação/criação de threads.
+ */
+Agendador* criarAgendador(int numTrabalhadores);
+
+/**
+ * @brief Encerra as threads e libera o agendador (não pode haver tarefas pendentes).
+ */
+void destruirAgendador(Agendador* agendador);
+
+/**
+ * @brief Número de trabalhadores do pool.
+ */
+int agendadorNumTrabalhadores(const Agendador* agendador);
+
+/**
+ * @brief Submete uma tarefa na fila do trabalhador @p trabalhador.
+ *
+ * Dentro de uma tarefa, passe o próprio índice recebido (a nova tarefa é a
+ * próxima que ele executa); fora, use 0.
+ *
+ * @return 1 em sucesso; 0 em falha de alocação (a tarefa não foi submetida).
+ */
+int agendadorSubmeter(Agendador* agendador, int trabalhador, AgendadorFuncao funcao,
+                      void* contexto, int arg0, int arg1, int arg2);
+
+/**
+ * @brief Participa da execução até que todas as tarefas submetidas (inclusive as
+ *        criadas durante a execução) tenham terminado.
+ */
+void agendadorExecutar(Agendador* agendador);
+
+/**
+ * @brief Número de processadores lógicos disponíveis (>= 1).
+ */
+int agendadorNumProcessadores(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AGENDADOR_H */
@@ -0,0 +1,254 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "banda.h"
+#include "gauss.h"
+#include "kernels.h"
+
+// ============================================================
+// ARMAZENAMENTO EM BANDA
+// ============================================================
+MatrizBanda* criarMatrizBanda(int ordemMatriz, int inferior, int superior) {
+    MatrizBanda* banda = (MatrizBanda*) malloc(sizeof(MatrizBanda));
+    if (!banda) return NULL;
+    banda->ordem = ordemMatriz;
+    banda->inferior = inferior;
+    banda->superior = superior;
+    banda->passo = 2 * inferior + superior + 1;
+    banda->dados = (double*) calloc((size_t)(ordemMatriz > 0 ? ordemMatriz : 1) * banda->passo,
+                                    sizeof(double));
+    if (!banda->dados) { free(banda); return NULL; }
+    return banda;
+}
+
+void destruirMatrizBanda(MatrizBanda* banda) {
+    if (!banda) return;
+    free(banda->dados);
+    free(banda);
+}
+
+MatrizBanda* bandaDeDensa(double** matrizA, int ordemMatriz, int inferior, int superior) {
+    MatrizBanda* banda = criarMatrizBanda(ordemMatriz, inferior, superior);
+    if (!banda) return NULL;
+    for (int i = 0; i < ordemMatriz; i++) {
+        int inicio = (i - inferior > 0) ? i - inferior : 0;
+        int fim = (i + superior < ordemMatriz - 1) ? i + superior : ordemMatriz - 1;
+        memcpy(&BANDA_ELEMENTO(banda, i, inicio), matrizA[i] + inicio,
+               (size_t)(fim - inicio + 1) * sizeof(double));
+    }
+    return banda;
+}
+
+void bandaMedir(double** matrizA, int ordemMatriz, int* inferior, int* superior) {
+    int kl = 0, ku = 0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        const double* linha = matrizA[i];
+        // só as colunas fora da banda já conhecida, de fora para dentro
+        for (int j = 0; j < i - kl; j++) {
+            if (linha[j] != 0.0) { kl = i - j; break; }
+        }
+        for (int j = ordemMatriz - 1; j > i + ku; j--) {
+            if (linha[j] != 0.0) { ku = j - i; break; }
+        }
+    }
+    *inferior = kl;
+    *superior = ku;
+}
+
+// ============================================================
+// LU EM BANDA COM PIVOTAMENTO PARCIAL (xGBTRF, por linhas)
+// ============================================================
+GaussStatus banda_fatorar(MatrizBanda* banda, int* pivos, double tolerancia) {
+    int n = banda->ordem;
+    int kl = banda->inferior;
+    int larguraU = banda->superior + kl;  // diagonais de U, contando o preenchimento
+
+    for (int k = 0; k < n; k++) {
+        int ultimaLinha = (k + kl < n - 1) ? k + kl : n - 1;
+        int ultimaColuna = (k + larguraU < n - 1) ? k + larguraU : n - 1;
+
+        // (1) pivô: maior |a_ik| entre as kl linhas abaixo
+        int linhaPivo = k;
+        double maxAbs = fabs(BANDA_ELEMENTO(banda, k, k));
+        for (int i = k + 1; i <= ultimaLinha; i++) {
+            double valor = fabs(BANDA_ELEMENTO(banda, i, k));
+            if (valor > maxAbs) { maxAbs = valor; linhaPivo = i; }
+        }
+        pivos[k] = linhaPivo;
+        if (maxAbs < tolerancia) return GAUSS_SINGULAR;
+
+        // (2) troca das linhas k e linhaPivo nas colunas k..ultimaColuna
+        //     (posições diferentes na banda: o deslocamento depende da linha)
+        if (linhaPivo != k) {
+            double* linhaK = &BANDA_ELEMENTO(banda, k, k);
+            double* linhaP = &BANDA_ELEMENTO(banda, linhaPivo, k);
+            for (int j = 0; j <= ultimaColuna - k; j++) {
+                double temporario = linhaK[j];
+                linhaK[j] = linhaP[j];
+                linhaP[j] = temporario;
+            }
+        }
+
+        // (3) eliminação: segmentos contíguos nas duas linhas
+        double pivo = BANDA_ELEMENTO(banda, k, k);
+        const double* segmentoPivo = &BANDA_ELEMENTO(banda, k, k + 1);
+        for (int i = k + 1; i <= ultimaLinha; i++) {
+            double multiplicador = BANDA_ELEMENTO(banda, i, k) / pivo;
+            BANDA_ELEMENTO(banda, i, k) = multiplicador;
+            if (multiplicador == 0.0) continue;
+            kernelAtualizarLinha(&BANDA_ELEMENTO(banda, i, k + 1), segmentoPivo,
+                                 multiplicador, ultimaColuna - k);
+        }
+    }
+    return GAUSS_OK;
+}
+
+void banda_resolver(const MatrizBanda* banda, const int* pivos, double* vetor) {
+    int n = banda->ordem;
+    int kl = banda->inferior;
+    int larguraU = banda->superior + kl;
+
+    // L y = P b, com as trocas na ordem em que foram feitas
+    for (int k = 0; k < n; k++) {
+        int linhaPivo = pivos[k];
+        if (linhaPivo != k) {
+            double temporario = vetor[k];
+            vetor[k] = vetor[linhaPivo];
+            vetor[linhaPivo] = temporario;
+        }
+        int ultimaLinha = (k + kl < n - 1) ? k + kl : n - 1;
+        for (int i = k + 1; i <= ultimaLinha; i++)
+            vetor[i] -= BANDA_ELEMENTO(banda, i, k) * vetor[k];
+    }
+
+    // U x = y
+    for (int i = n - 1; i >= 0; i--) {
+        int ultimaColuna = (i + larguraU < n - 1) ? i + larguraU : n - 1;
+        const double* linha = &BANDA_ELEMENTO(banda, i, 0);
+        double soma = vetor[i];
+        for (int j = i + 1; j <= ultimaColuna; j++) soma -= linha[j] * vetor[j];
+        vetor[i] = soma / linha[i];
+    }
+}
+
+// ============================================================
+// THOMAS (tridiagonal, sem pivotamento)
+// ============================================================
+GaussStatus thomas(const double* subdiagonal, const double* diagonal, const double* superdiagonal,
+                   double* vetor, int ordemMatriz, double tolerancia) {
+    if (ordemMatriz <= 0) return GAUSS_OK;
+    double* superModificada = (double*) malloc(ordemMatriz * sizeof(double));
+    if (!superModificada) return GAUSS_SINGULAR; /* sem enum específico para memória */
+
+    double pivo = diagonal[0];
+    if (fabs(pivo) < tolerancia) { free(superModificada); return GAUSS_SINGULAR; }
+    superModificada[0] = (ordemMatriz > 1) ? superdiagonal[0] / pivo : 0.0;
+    vetor[0] /= pivo;
+
+    for (int i = 1; i < ordemMatriz; i++) {
+        pivo = diagonal[i] - subdiagonal[i] * superModificada[i - 1];
+        if (fabs(pivo) < tolerancia) { free(superModificada); return GAUSS_SINGULAR; }
+        superModificada[i] = (i < ordemMatriz - 1) ? superdiagonal[i] / pivo : 0.0;
+        vetor[i] = (vetor[i] - subdiagonal[i] * vetor[i - 1]) / pivo;
+    }
+    for (int i = ordemMatriz - 2; i >= 0; i--)
+        vetor[i] -= superModificada[i] * vetor[i + 1];
+
+    free(superModificada);
+    return GAUSS_OK;
+}
+
+// ============================================================
+// ESCOLHA AUTOMÁTICA DO CAMINHO
+// ============================================================
+
+/* |a_ii| >= |a_i,i-1| + |a_i,i+1| em todas as linhas */
+static int tridiagonalDominante(double** matrizA, int ordemMatriz) {
+    for (int i = 0; i < ordemMatriz; i++) {
+        double foraDiagonal = 0.0;
+        if (i > 0) foraDiagonal += fabs(matrizA[i][i - 1]);
+        if (i < ordemMatriz - 1) foraDiagonal += fabs(matrizA[i][i + 1]);
+        if (fabs(matrizA[i][i]) < foraDiagonal) return 0;
+    }
+    return 1;
+}
+
+static GaussStatus resolverThomas(double** matrizEstendida, int ordemMatriz,
+                                  double* vetorSolucao, double tolerancia) {
+    double* diagonais = (double*) malloc((size_t)3 * ordemMatriz * sizeof(double));
+    if (!diagonais) return GAUSS_SINGULAR; /* sem enum específico para memória */
+    double* subdiagonal = diagonais;
+    double* diagonal = diagonais + ordemMatriz;
+    double* superdiagonal = diagonais + 2 * ordemMatriz;
+
+    for (int i = 0; i < ordemMatriz; i++) {
+        const double* linha = matrizEstendida[i];
+        subdiagonal[i] = (i > 0) ? linha[i - 1] : 0.0;
+        diagonal[i] = linha[i];
+        superdiagonal[i] = (i < ordemMatriz - 1) ? linha[i + 1] : 0.0;
+        vetorSolucao[i] = linha[ordemMatriz];
+    }
+    GaussStatus status = thomas(subdiagonal, diagonal, superdiagonal, vetorSolucao,
+                                ordemMatriz, tolerancia);
+    free(diagonais);
+    return status;
+}
+
+static GaussStatus resolverBanda(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                                 int inferior, int superior, double tolerancia) {
+    MatrizBanda* banda = bandaDeDensa(matrizEstendida, ordemMatriz, inferior, superior);
+    int* pivos = (int*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(int));
+    if (!banda || !pivos) {
+        destruirMatrizBanda(banda);
+        free(pivos);
+        return GAUSS_SINGULAR; /* sem enum específico para memória */
+    }
+
+    GaussStatus status = banda_fatorar(banda, pivos, tolerancia);
+    if (status == GAUSS_OK) {
+        for (int i = 0; i < ordemMatriz; i++) vetorSolucao[i] = matrizEstendida[i][ordemMatriz];
+        banda_resolver(banda, pivos, vetorSolucao);
+    }
+    destruirMatrizBanda(banda);
+    free(pivos);
+    return status;
+}
+
+GaussStatus gauss_banda_ou_denso(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                                 double tolerancia, BandaInfo* info) {
+    int inferior, superior;
+    bandaMedir(matrizEstendida, ordemMatriz, &inferior, &superior);
+
+    BandaMetodo metodo = BANDA_METODO_DENSO;
+    if (inferior <= 1 && superior <= 1 && tridiagonalDominante(matrizEstendida, ordemMatriz))
+        metodo = BANDA_METODO_THOMAS;
+    else if ((size_t)(2 * inferior + superior + 1) * GAUSS_BANDA_FRACAO <= (size_t)ordemMatriz)
+        metodo = BANDA_METODO_BANDA;
+
+    if (info) {
+        info->inferior = inferior;
+        info->superior = superior;
+        info->metodo = metodo;
+    }
+
+    double limitePivo = (tolerancia > 0.0) ? tolerancia : 0.0;
+    switch (metodo) {
+        case BANDA_METODO_THOMAS:
+            return resolverThomas(matrizEstendida, ordemMatriz, vetorSolucao, limitePivo);
+        case BANDA_METODO_BANDA:
+            return resolverBanda(matrizEstendida, ordemMatriz, vetorSolucao,
+                                 inferior, superior, limitePivo);
+        default:
+            if (tolerancia > 0.0)
+                return gauss_com_tolerancia(matrizEstendida, ordemMatriz, vetorSolucao, tolerancia);
+            return gauss(matrizEstendida, ordemMatriz, vetorSolucao);
+    }
+}
+
+const char* bandaNomeMetodo(BandaMetodo metodo) {
+    switch (metodo) {
+        case BANDA_METODO_THOMAS: return "Thomas";
+        case BANDA_METODO_BANDA:  return "LU em banda";
+        default:                  return "Gauss denso";
+    }
+}
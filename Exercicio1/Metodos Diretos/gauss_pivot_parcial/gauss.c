@@ -1,6 +1,77 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
+#include <float.h>
+#include <string.h>
+#include <pthread.h>
 #include "gauss.h"
+#include "agendador.h"
+#include "kernels.h"
+#include "residuo_estendido.h"
+#include "utils.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#define GAUSS_PRAGMA(x) _Pragma(#x)
+#else
+#define GAUSS_PRAGMA(x)
+#endif
+
+// ============================================================
+// CONFIGURAÇÃO DO PARALELISMO (fase de atualização)
+// ============================================================
+static int g_numThreads = 0;                       /* <= 0: padrão do OpenMP */
+static int g_corteParalelo = GAUSS_CORTE_PARALELO; /* linhas restantes mínimas */
+static GaussMotor g_motor = GAUSS_MOTOR_LACOS;
+static GaussPivoPainel g_pivoPainel = GAUSS_PIVO_PARCIAL;
+
+void gaussDefinirThreads(int numThreads) {
+    g_numThreads = numThreads;
+}
+
+void gaussDefinirCorteParalelo(int linhasMinimas) {
+    g_corteParalelo = linhasMinimas;
+}
+
+void gaussDefinirMotor(GaussMotor motor) {
+    g_motor = motor;
+}
+
+GaussMotor gaussMotor(void) {
+    return g_motor;
+}
+
+void gaussDefinirPivoPainel(GaussPivoPainel pivo) {
+    g_pivoPainel = pivo;
+}
+
+GaussPivoPainel gaussPivoPainel(void) {
+    return g_pivoPainel;
+}
+
+int gaussNumThreads(void) {
+#ifdef _OPENMP
+    return (g_numThreads > 0) ? g_numThreads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+/* Vale a pena abrir a região paralela para @p linhasRestantes linhas? */
+static int usarParalelo(int linhasRestantes) {
+    if (gaussNumThreads() <= 1 || linhasRestantes < g_corteParalelo) return 0;
+    (void) kernelNivelAtivo(); /* resolve o despacho SIMD antes de abrir as threads */
+    return 1;
+}
+
+/* Índice da thread corrente dentro da região paralela (0 se serial) */
+static int idThread(void) {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
 
 // ============================================================
 // ELIMINAÇÃO DE GAUSS — pivotamento parcial (com tolerância)
@@ -31,16 +102,17 @@ GaussStatus eliminacao_com_tolerancia(double** matrizEstendida, int ordemMatriz,
             matrizEstendida[linhaPivo] = temp;
         }
 
-        // (1.4) eliminação
+        // (1.4) eliminação (linhas independentes: paralelizável)
+        GAUSS_PRAGMA(omp parallel for schedule(static) num_threads(gaussNumThreads()) \
+                     if(usarParalelo(ordemMatriz - colunaPivo - 1)))
         for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
             double multiplicador = matrizEstendida[linha][colunaPivo] /
                                    matrizEstendida[colunaPivo][colunaPivo];
             if (multiplicador == 0.0) continue;
 
-            for (int coluna = colunaPivo; coluna <= ordemMatriz; coluna++) {
-                matrizEstendida[linha][coluna] -=
-                    multiplicador * matrizEstendida[colunaPivo][coluna];
-            }
+            kernelAtualizarLinha(matrizEstendida[linha] + colunaPivo,
+                                 matrizEstendida[colunaPivo] + colunaPivo,
+                                 multiplicador, ordemMatriz - colunaPivo + 1);
         }
     }
 
@@ -76,22 +148,985 @@ GaussStatus eliminacao(double** matrizEstendida, int ordemMatriz) {
             matrizEstendida[linhaPivo] = temp;
         }
 
-        // (1.3) eliminação
+        // (1.3) eliminação (linhas independentes: paralelizável)
+        GAUSS_PRAGMA(omp parallel for schedule(static) num_threads(gaussNumThreads()) \
+                     if(usarParalelo(ordemMatriz - colunaPivo - 1)))
         for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
             double multiplicador = matrizEstendida[linha][colunaPivo] /
                                    matrizEstendida[colunaPivo][colunaPivo];
             if (multiplicador == 0.0) continue;
 
-            for (int coluna = colunaPivo; coluna <= ordemMatriz; coluna++) {
-                matrizEstendida[linha][coluna] -=
-                    multiplicador * matrizEstendida[colunaPivo][coluna];
+            kernelAtualizarLinha(matrizEstendida[linha] + colunaPivo,
+                                 matrizEstendida[colunaPivo] + colunaPivo,
+                                 multiplicador, ordemMatriz - colunaPivo + 1);
+        }
+    }
+
+    return GAUSS_OK;
+}
+
+// ============================================================
+// ELIMINAÇÃO DE GAUSS — versão em blocos (right-looking)
+//   (a) fatora um painel de nb colunas com pivotamento parcial;
+//   (b) resolve o bloco de linhas U12 = L11^{-1} A12;
+//   (c) atualiza a submatriz restante A22 -= L21 * U12 em ladrilhos,
+//       reaproveitando U12 e L21 em cache/registradores.
+// Os multiplicadores ficam guardados abaixo da diagonal.
+// ============================================================
+
+/* Ladrilho do micro-kernel da atualização (linhas x colunas) */
+#define MK_LINHAS  KERNEL_MK_LINHAS
+#define MK_COLUNAS KERNEL_MK_COLUNAS
+/* Largura das faixas de colunas da atualização (mantém U12 no L2) */
+#define FAIXA_COLUNAS 256
+
+/**
+ * @brief Micro-kernel: C[4][8] -= L[4][kb] * U[kb][8], acumulando em registradores.
+ *
+ * @p painelL e @p painelU estão empacotados contiguamente (índice p mais externo),
+ * de modo que o laço interno lê memória sequencial. A implementação vetorizada
+ * é escolhida em tempo de execução (ver kernels.h).
+ */
+static void microKernelAtualizacao(double** matriz, int linha, int coluna,
+                                   const double* painelL, const double* painelU,
+                                   int larguraPainel) {
+    double* linhasC[MK_LINHAS];
+    for (int i = 0; i < MK_LINHAS; i++) {
+        linhasC[i] = matriz[linha + i] + coluna;
+    }
+    kernelMicroAtualizacao(linhasC, painelL, painelU, larguraPainel);
+}
+
+/**
+ * @brief Atualização genérica (bordas que não fecham um ladrilho completo).
+ */
+static void atualizacaoBorda(double** matriz, int linhaIni, int linhaFim,
+                             int colunaIni, int colunaFim,
+                             int inicioPainel, int larguraPainel) {
+    for (int linha = linhaIni; linha < linhaFim; linha++) {
+        double* linhaC = matriz[linha];
+        for (int p = inicioPainel; p < inicioPainel + larguraPainel; p++) {
+            double l = linhaC[p];
+            if (l == 0.0) continue;
+            kernelAtualizarLinha(linhaC + colunaIni, matriz[p] + colunaIni,
+                                 l, colunaFim - colunaIni);
+        }
+    }
+}
+
+/**
+ * @brief A22 -= L21 * U12 sobre linhas/colunas [inicio, fim).
+ *
+ * Percorre faixas de FAIXA_COLUNAS colunas: empacota a faixa de U12 uma vez e,
+ * para cada grupo de MK_LINHAS linhas, empacota L21 e chama o micro-kernel.
+ * Os grupos de linhas são independentes e são divididos entre as threads.
+ *
+ * @return 1 em sucesso; 0 em falha de alocação.
+ */
+static int atualizarSubmatriz(double** matriz, int linhaIni, int linhaFim,
+                              int colunaIni, int colunaFim,
+                              int inicioPainel, int larguraPainel) {
+    int paralelo = usarParalelo(linhaFim - linhaIni);
+    int numThreads = paralelo ? gaussNumThreads() : 1;
+    size_t tamanhoPainelL = (size_t)larguraPainel * MK_LINHAS;
+
+    double* painelU = (double*) malloc((size_t)larguraPainel * FAIXA_COLUNAS * sizeof(double));
+    double* painelL = (double*) malloc(tamanhoPainelL * numThreads * sizeof(double));
+    if (!painelU || !painelL) {
+        free(painelU); free(painelL);
+        return 0;
+    }
+
+    int gruposLinhas = (linhaFim - linhaIni) / MK_LINHAS;
+    int linhasCheias = linhaIni + gruposLinhas * MK_LINHAS;
+
+    for (int faixa = colunaIni; faixa < colunaFim; faixa += FAIXA_COLUNAS) {
+        int fimFaixa = faixa + FAIXA_COLUNAS;
+        if (fimFaixa > colunaFim) fimFaixa = colunaFim;
+        int colunasCheias = faixa + ((fimFaixa - faixa) / MK_COLUNAS) * MK_COLUNAS;
+
+        // empacota U12[:, faixa] em blocos de MK_COLUNAS colunas
+        for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS) {
+            double* destino = painelU + (size_t)(coluna - faixa) * larguraPainel;
+            for (int p = 0; p < larguraPainel; p++)
+                for (int j = 0; j < MK_COLUNAS; j++)
+                    destino[p * MK_COLUNAS + j] = matriz[inicioPainel + p][coluna + j];
+        }
+
+        GAUSS_PRAGMA(omp parallel for schedule(static) num_threads(numThreads) if(paralelo))
+        for (int grupo = 0; grupo < gruposLinhas; grupo++) {
+            int linha = linhaIni + grupo * MK_LINHAS;
+            double* meuPainelL = painelL + tamanhoPainelL * idThread();
+
+            for (int p = 0; p < larguraPainel; p++)
+                for (int i = 0; i < MK_LINHAS; i++)
+                    meuPainelL[p * MK_LINHAS + i] = matriz[linha + i][inicioPainel + p];
+
+            for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS)
+                microKernelAtualizacao(matriz, linha, coluna, meuPainelL,
+                                       painelU + (size_t)(coluna - faixa) * larguraPainel,
+                                       larguraPainel);
+            atualizacaoBorda(matriz, linha, linha + MK_LINHAS, colunasCheias, fimFaixa,
+                             inicioPainel, larguraPainel);
+        }
+        atualizacaoBorda(matriz, linhasCheias, linhaFim, faixa, fimFaixa,
+                         inicioPainel, larguraPainel);
+    }
+
+    free(painelU);
+    free(painelL);
+    return 1;
+}
+
+// ============================================================
+// PIVOTAMENTO POR TORNEIO (CALU) — escolhe as nb linhas pivô de um
+// painel sem uma redução global por coluna:
+//   (1) cada bloco de linhas faz GEPP numa cópia e indica nb candidatas;
+//   (2) pares de candidatas (2nb linhas originais) disputam nova rodada
+//       de GEPP, numa árvore binária, até restarem nb vencedoras.
+// As vencedoras saem na ordem dos pivôs da última rodada e viram uma
+// sequência de trocas (pivos[]) aplicada como no pivotamento parcial.
+// ============================================================
+
+/* Copia as colunas do painel das linhas @p indices para @p bloco (linhas × largura) */
+static void torneioCarregar(double** matriz, const int* indices, int linhas,
+                            int inicioPainel, int largura, double* bloco) {
+    for (int i = 0; i < linhas; i++) {
+        memcpy(bloco + (size_t)i * largura, matriz[indices[i]] + inicioPainel,
+               (size_t)largura * sizeof(double));
+    }
+}
+
+/*
+ * Uma rodada: GEPP sobre @p bloco (linhas >= largura), com as mesmas operações
+ * do painel em eliminacaoBlocadaNucleo. No fim, indices[0..largura) são as
+ * vencedoras, na ordem em que viraram pivô.
+ */
+static void torneioRodada(double* bloco, int linhas, int largura, int* indices) {
+    for (int coluna = 0; coluna < largura; coluna++) {
+        double maxAbs = fabs(bloco[(size_t)coluna * largura + coluna]);
+        int linhaPivo = coluna;
+        for (int linha = coluna + 1; linha < linhas; linha++) {
+            double valor = fabs(bloco[(size_t)linha * largura + coluna]);
+            if (valor > maxAbs) {
+                maxAbs = valor;
+                linhaPivo = linha;
+            }
+        }
+
+        double* linhaDoPivo = bloco + (size_t)coluna * largura;
+        if (linhaPivo != coluna) {
+            double* outra = bloco + (size_t)linhaPivo * largura;
+            for (int j = 0; j < largura; j++) {
+                double temp = linhaDoPivo[j];
+                linhaDoPivo[j] = outra[j];
+                outra[j] = temp;
             }
+            int tempIndice = indices[coluna];
+            indices[coluna] = indices[linhaPivo];
+            indices[linhaPivo] = tempIndice;
+        }
+
+        double pivo = linhaDoPivo[coluna];
+        if (pivo == 0.0) continue; /* coluna nula: qualquer linha serve */
+        for (int linha = coluna + 1; linha < linhas; linha++) {
+            double* linhaAtual = bloco + (size_t)linha * largura;
+            double multiplicador = linhaAtual[coluna] / pivo;
+            linhaAtual[coluna] = multiplicador;
+            if (multiplicador == 0.0) continue;
+            kernelAtualizarLinha(linhaAtual + coluna + 1, linhaDoPivo + coluna + 1,
+                                 multiplicador, largura - coluna - 1);
         }
     }
+}
+
+/**
+ * @brief Seleciona, por torneio, as linhas pivô do painel [inicioPainel, fimPainel).
+ *
+ * Só lê a matriz. @p pivos[c - inicioPainel] recebe a linha a trocar com a
+ * linha c, na ordem das colunas (mesmo formato das trocas do pivotamento parcial).
+ *
+ * @param paralelo Distribui os blocos de cada etapa entre as threads OpenMP.
+ * @return 1 em sucesso; 0 em falha de alocação.
+ */
+static int selecionarPivosTorneio(double** matriz, int ordemMatriz, int inicioPainel,
+                                  int fimPainel, int* pivos, int paralelo) {
+    int largura = fimPainel - inicioPainel;
+    int linhas = ordemMatriz - inicioPainel;
+    int porFolha = GAUSS_TORNEIO_LINHAS;
+    if (porFolha < 2 * largura) porFolha = 2 * largura;
+    int folhas = linhas / porFolha;
+    if (folhas < 1) folhas = 1;
+#ifndef _OPENMP
+    (void) paralelo;
+#endif
+
+    double* area = (double*) malloc((size_t)linhas * largura * sizeof(double));
+    int* indices = (int*) malloc((size_t)linhas * 3 * sizeof(int));
+    if (!area || !indices) {
+        free(area); free(indices);
+        return 0;
+    }
+    for (int i = 0; i < linhas; i++) indices[i] = inicioPainel + i;
+
+    // (1) folhas: a última absorve as linhas que sobram
+    GAUSS_PRAGMA(omp parallel for schedule(dynamic) if(paralelo && folhas > 1))
+    for (int folha = 0; folha < folhas; folha++) {
+        int primeira = folha * porFolha;
+        int quantas = (folha == folhas - 1) ? linhas - primeira : porFolha;
+        double* bloco = area + (size_t)primeira * largura;
+        torneioCarregar(matriz, indices + primeira, quantas, inicioPainel, largura, bloco);
+        torneioRodada(bloco, quantas, largura, indices + primeira);
+    }
+
+    // (2) árvore: as vencedoras de folha+passo disputam com as de folha
+    for (int passo = 1; passo < folhas; passo *= 2) {
+        GAUSS_PRAGMA(omp parallel for schedule(dynamic) if(paralelo && folhas > 2 * passo))
+        for (int folha = 0; folha < folhas - passo; folha += 2 * passo) {
+            int* candidatas = indices + (size_t)folha * porFolha;
+            double* bloco = area + (size_t)folha * porFolha * largura;
+            memcpy(candidatas + largura, indices + (size_t)(folha + passo) * porFolha,
+                   (size_t)largura * sizeof(int));
+            torneioCarregar(matriz, candidatas, 2 * largura, inicioPainel, largura, bloco);
+            torneioRodada(bloco, 2 * largura, largura, candidatas);
+        }
+    }
+
+    // (3) vencedoras -> sequência de trocas, acompanhando onde cada linha está
+    int* linhaEm = indices + linhas;
+    int* posicaoDe = indices + 2 * (size_t)linhas;
+    for (int i = 0; i < linhas; i++) {
+        linhaEm[i] = i;
+        posicaoDe[i] = i;
+    }
+    for (int c = 0; c < largura; c++) {
+        int vencedora = indices[c] - inicioPainel;
+        int posicao = posicaoDe[vencedora];
+        int deslocada = linhaEm[c];
+        pivos[c] = inicioPainel + posicao;
+        linhaEm[c] = vencedora;
+        linhaEm[posicao] = deslocada;
+        posicaoDe[vencedora] = c;
+        posicaoDe[deslocada] = posicao;
+    }
+
+    free(area);
+    free(indices);
+    return 1;
+}
+
+/*
+ * Linha pivô da coluna: a do torneio (@p pivosTorneio, se não NULL) ou a de
+ * maior |A[i][coluna]|, i >= coluna. @p maxAbs recebe o |pivô| escolhido.
+ */
+static int escolherPivo(double** matriz, int ordemMatriz, int colunaPivo,
+                        const int* pivosTorneio, int inicioPainel, double* maxAbs) {
+    if (pivosTorneio) {
+        int linhaPivo = pivosTorneio[colunaPivo - inicioPainel];
+        *maxAbs = fabs(matriz[linhaPivo][colunaPivo]);
+        return linhaPivo;
+    }
+    double melhor = fabs(matriz[colunaPivo][colunaPivo]);
+    int linhaPivo = colunaPivo;
+    for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
+        double valor = fabs(matriz[linha][colunaPivo]);
+        if (valor > melhor) {
+            melhor = valor;
+            linhaPivo = linha;
+        }
+    }
+    *maxAbs = melhor;
+    return linhaPivo;
+}
+
+// ============================================================
+// MOTOR DE TAREFAS — a mesma eliminação em blocos como um grafo de
+// tarefas (DAG) sobre colunas-bloco de nb colunas, executado pelo
+// agendador com roubo de tarefas (agendador.h):
+//   P(k)      fatora o painel k (pivotamento parcial, só nas colunas dele)
+//             e empacota L21 uma vez para todo o passo;
+//   S(k,J)    aplica as trocas do painel k, resolve U12 num grupo J de
+//             colunas-bloco vizinhas (até FAIXA_COLUNAS colunas) e empacota U12;
+//   G(k,J,i)  A22 -= L21 * U12 num ladrilho de linhas i do grupo J.
+// A coluna-bloco k+1 forma sempre um grupo sozinha: P(k+1) só espera as
+// tarefas G(k,{k+1},*) e começa enquanto o resto da atualização do passo k
+// ainda roda (lookahead), sem barreira por painel.
+// Cada elemento recebe as mesmas operações, na mesma ordem, que em
+// eliminacaoBlocadaNucleo: os fatores são os mesmos da versão em laços.
+// ============================================================
+
+/* Linhas por ladrilho de G (múltiplo de MK_LINHAS) */
+#define TAREFA_LINHAS (64 * MK_LINHAS)
+
+typedef struct {
+    double** matriz;
+    int ordem, nColunas, bloco, numPaineis, numBlocos;
+    int checarTolerancia;
+    double tolerancia;
+    int* permutacao;         /* pode ser NULL */
+    int* pivos;              /* pivos[c]: linha trocada com c no passo da coluna c */
+    double** painelL;        /* L21 empacotado de cada passo em andamento (ou NULL) */
+    double* painelU;         /* U12 empacotado, bloco*bloco doubles por coluna-bloco */
+    Agendador* agendador;
+    pthread_mutex_t trava;   /* protege os campos abaixo */
+    int* pendentesBloco;     /* tarefas G abertas do grupo que começa na coluna-bloco */
+    int* fimGrupo;           /* fim (exclusivo) do grupo que começa na coluna-bloco */
+    int* etapaBloco;         /* a coluna-bloco j já recebeu os passos 0..etapaBloco[j]-1 */
+    int* blocosAbertos;      /* colunas-bloco que ainda não terminaram o passo k */
+    unsigned char* painelFeito;
+    GaussStatus status;
+} MotorTarefas;
+
+static void tarefaPainel(void* contexto, const int* argumentos, int trabalhador);
+static void tarefaTrsm(void* contexto, const int* argumentos, int trabalhador);
+static void tarefaProduto(void* contexto, const int* argumentos, int trabalhador);
+
+static int fimPainelTarefas(const MotorTarefas* motor, int painel) {
+    int fim = (painel + 1) * motor->bloco;
+    return fim < motor->ordem ? fim : motor->ordem;
+}
+
+/* Colunas das colunas-bloco [blocoIni, blocoFim) atualizadas no passo k (vazio se colunaIni >= colunaFim) */
+static void faixaBlocos(const MotorTarefas* motor, int painel, int blocoIni, int blocoFim,
+                        int* colunaIni, int* colunaFim) {
+    int inicio = blocoIni * motor->bloco;
+    int fim = blocoFim * motor->bloco;
+    int fimPainel = fimPainelTarefas(motor, painel);
+    *colunaIni = inicio > fimPainel ? inicio : fimPainel;
+    *colunaFim = fim < motor->nColunas ? fim : motor->nColunas;
+}
+
+static int tarefasAbortadas(MotorTarefas* motor) {
+    pthread_mutex_lock(&motor->trava);
+    int abortar = motor->status != GAUSS_OK;
+    pthread_mutex_unlock(&motor->trava);
+    return abortar;
+}
+
+/* Chamada com a trava: registra falha (a primeira vence) */
+static void falharTarefas(MotorTarefas* motor, GaussStatus status) {
+    if (motor->status == GAUSS_OK) motor->status = status;
+}
+
+/* Chamada com a trava */
+static void submeterTarefa(MotorTarefas* motor, int trabalhador, AgendadorFuncao funcao,
+                           int arg0, int arg1, int arg2) {
+    if (!agendadorSubmeter(motor->agendador, trabalhador, funcao, motor, arg0, arg1, arg2)) {
+        falharTarefas(motor, GAUSS_SINGULAR); /* sem enum específico para memória */
+    }
+}
+
+/*
+ * Chamada com a trava: submete S(painel, *) para as colunas-bloco
+ * [blocoIni, blocoFim), todas prontas para o passo. As colunas-bloco painel e
+ * painel+1 vão sozinhas; as demais, em grupos de até FAIXA_COLUNAS colunas.
+ * A ordem é decrescente: o grupo mais próximo sai primeiro da fila (LIFO).
+ */
+static void submeterGrupos(MotorTarefas* motor, int painel, int blocoIni, int blocoFim,
+                           int trabalhador) {
+    int porGrupo = FAIXA_COLUNAS / motor->bloco;
+    if (porGrupo < 1) porGrupo = 1;
+    if (blocoIni < painel) blocoIni = painel;
+
+    int fim = blocoFim;
+    while (fim > blocoIni) {
+        int inicio;
+        if (fim - 1 <= painel + 1) {
+            inicio = fim - 1;
+        } else {
+            inicio = fim - porGrupo;
+            if (inicio < painel + 2) inicio = painel + 2;
+        }
+        if (inicio < blocoIni) inicio = blocoIni;
+
+        int colunaIni, colunaFim;
+        faixaBlocos(motor, painel, inicio, fim, &colunaIni, &colunaFim);
+        if (colunaIni < colunaFim) {
+            submeterTarefa(motor, trabalhador, tarefaTrsm, painel, inicio, fim);
+        }
+        fim = inicio;
+    }
+}
+
+/* Chamada com a trava: as colunas-bloco [blocoIni, blocoFim) receberam o passo @p painel */
+static void grupoAtualizado(MotorTarefas* motor, int painel, int blocoIni, int blocoFim,
+                            int trabalhador) {
+    int proximo = painel + 1;
+    for (int bloco = blocoIni; bloco < blocoFim; bloco++) {
+        motor->etapaBloco[bloco] = proximo;
+    }
+    motor->blocosAbertos[painel] -= blocoFim - blocoIni;
+    if (motor->blocosAbertos[painel] == 0) {
+        free(motor->painelL[painel]);
+        motor->painelL[painel] = NULL;
+    }
+    if (proximo >= motor->numPaineis || motor->status != GAUSS_OK) return;
+
+    if (blocoIni <= proximo && proximo < blocoFim) {
+        submeterTarefa(motor, trabalhador, tarefaPainel, proximo, 0, 0);
+    } else if (motor->painelFeito[proximo]) {
+        submeterGrupos(motor, proximo, blocoIni, blocoFim, trabalhador);
+    }
+    /* senão, P(proximo) submete S(proximo, *) quando terminar */
+}
+
+static void tarefaPainel(void* contexto, const int* argumentos, int trabalhador) {
+    MotorTarefas* motor = (MotorTarefas*) contexto;
+    int painel = argumentos[0];
+    double** matriz = motor->matriz;
+    int inicioPainel = painel * motor->bloco;
+    int fimPainel = fimPainelTarefas(motor, painel);
+    int larguraPainel = fimPainel - inicioPainel;
+    GaussStatus status = tarefasAbortadas(motor) ? GAUSS_SINGULAR : GAUSS_OK;
+
+    // o torneio roda dentro desta tarefa, sem abrir threads OpenMP no trabalhador
+    int* pivosTorneio = NULL;
+    if (status == GAUSS_OK && g_pivoPainel == GAUSS_PIVO_TORNEIO) {
+        pivosTorneio = motor->pivos + inicioPainel;
+        if (!selecionarPivosTorneio(matriz, motor->ordem, inicioPainel, fimPainel, pivosTorneio, 0))
+            status = GAUSS_SINGULAR;
+    }
+
+    for (int colunaPivo = inicioPainel; colunaPivo < fimPainel && status == GAUSS_OK; colunaPivo++) {
+        double maxAbs;
+        int linhaPivo = escolherPivo(matriz, motor->ordem, colunaPivo, pivosTorneio,
+                                     inicioPainel, &maxAbs);
+        if (motor->checarTolerancia && maxAbs < motor->tolerancia) {
+            status = GAUSS_SINGULAR;
+            break;
+        }
+
+        // as outras colunas-bloco estão em uso: troca só o trecho do painel
+        motor->pivos[colunaPivo] = linhaPivo;
+        if (linhaPivo != colunaPivo) {
+            double* a = matriz[colunaPivo];
+            double* b = matriz[linhaPivo];
+            for (int coluna = inicioPainel; coluna < fimPainel; coluna++) {
+                double temp = a[coluna];
+                a[coluna] = b[coluna];
+                b[coluna] = temp;
+            }
+            if (motor->permutacao) {
+                int tempIndice = motor->permutacao[colunaPivo];
+                motor->permutacao[colunaPivo] = motor->permutacao[linhaPivo];
+                motor->permutacao[linhaPivo] = tempIndice;
+            }
+        }
+
+        double* linhaDoPivo = matriz[colunaPivo];
+        double pivo = linhaDoPivo[colunaPivo];
+        for (int linha = colunaPivo + 1; linha < motor->ordem; linha++) {
+            double* linhaAtual = matriz[linha];
+            double multiplicador = linhaAtual[colunaPivo] / pivo;
+            linhaAtual[colunaPivo] = multiplicador;
+            if (multiplicador == 0.0) continue;
+            kernelAtualizarLinha(linhaAtual + colunaPivo + 1, linhaDoPivo + colunaPivo + 1,
+                                 multiplicador, fimPainel - colunaPivo - 1);
+        }
+    }
+
+    // L21 empacotado em grupos de MK_LINHAS linhas, lido por todos os G(painel, *, *)
+    double* painelL = NULL;
+    int gruposLinhas = (motor->ordem - fimPainel) / MK_LINHAS;
+    if (status == GAUSS_OK && gruposLinhas > 0) {
+        painelL = (double*) malloc((size_t)gruposLinhas * larguraPainel * MK_LINHAS * sizeof(double));
+        if (!painelL) status = GAUSS_SINGULAR;
+        for (int grupo = 0; painelL && grupo < gruposLinhas; grupo++) {
+            double* destino = painelL + (size_t)grupo * larguraPainel * MK_LINHAS;
+            int linha = fimPainel + grupo * MK_LINHAS;
+            for (int p = 0; p < larguraPainel; p++)
+                for (int i = 0; i < MK_LINHAS; i++)
+                    destino[p * MK_LINHAS + i] = matriz[linha + i][inicioPainel + p];
+        }
+    }
+
+    pthread_mutex_lock(&motor->trava);
+    if (status != GAUSS_OK) falharTarefas(motor, status);
+    motor->painelFeito[painel] = 1;
+    motor->painelL[painel] = painelL;
+    for (int bloco = painel; bloco < motor->numBlocos; bloco++) {
+        int colunaIni, colunaFim;
+        faixaBlocos(motor, painel, bloco, bloco + 1, &colunaIni, &colunaFim);
+        if (colunaIni < colunaFim) motor->blocosAbertos[painel]++;
+    }
+    if (motor->blocosAbertos[painel] == 0) {
+        free(motor->painelL[painel]);
+        motor->painelL[painel] = NULL;
+    }
+    if (motor->status == GAUSS_OK) {
+        // sequências de colunas-bloco já prontas para o passo, da mais distante à mais próxima
+        int fim = motor->numBlocos;
+        while (fim > painel) {
+            if (motor->etapaBloco[fim - 1] != painel) {
+                fim--;
+                continue;
+            }
+            int inicio = fim - 1;
+            while (inicio > painel && motor->etapaBloco[inicio - 1] == painel) inicio--;
+            submeterGrupos(motor, painel, inicio, fim, trabalhador);
+            fim = inicio;
+        }
+    }
+    pthread_mutex_unlock(&motor->trava);
+}
+
+static void tarefaTrsm(void* contexto, const int* argumentos, int trabalhador) {
+    MotorTarefas* motor = (MotorTarefas*) contexto;
+    int painel = argumentos[0], blocoIni = argumentos[1], blocoFim = argumentos[2];
+    double** matriz = motor->matriz;
+    int inicioPainel = painel * motor->bloco;
+    int fimPainel = fimPainelTarefas(motor, painel);
+    int larguraPainel = fimPainel - inicioPainel;
+    int colunaIni, colunaFim;
+    faixaBlocos(motor, painel, blocoIni, blocoFim, &colunaIni, &colunaFim);
+
+    if (tarefasAbortadas(motor)) return;
+
+    // (1) trocas do painel, na ordem em que foram feitas
+    for (int colunaPivo = inicioPainel; colunaPivo < fimPainel; colunaPivo++) {
+        int linhaPivo = motor->pivos[colunaPivo];
+        if (linhaPivo == colunaPivo) continue;
+        double* a = matriz[colunaPivo];
+        double* b = matriz[linhaPivo];
+        for (int coluna = colunaIni; coluna < colunaFim; coluna++) {
+            double temp = a[coluna];
+            a[coluna] = b[coluna];
+            b[coluna] = temp;
+        }
+    }
+
+    // (2) U12 = L11^{-1} A12 nas colunas do grupo
+    for (int colunaPivo = inicioPainel; colunaPivo < fimPainel; colunaPivo++) {
+        const double* linhaDoPivo = matriz[colunaPivo];
+        for (int linha = colunaPivo + 1; linha < fimPainel; linha++) {
+            double multiplicador = matriz[linha][colunaPivo];
+            if (multiplicador == 0.0) continue;
+            kernelAtualizarLinha(matriz[linha] + colunaIni, linhaDoPivo + colunaIni,
+                                 multiplicador, colunaFim - colunaIni);
+        }
+    }
+
+    // (3) empacota U12 em blocos de MK_COLUNAS colunas e cria os ladrilhos de A22
+    double* painelU = motor->painelU + (size_t)blocoIni * motor->bloco * motor->bloco;
+    int colunasCheias = colunaIni + ((colunaFim - colunaIni) / MK_COLUNAS) * MK_COLUNAS;
+    for (int coluna = colunaIni; coluna < colunasCheias; coluna += MK_COLUNAS) {
+        double* destino = painelU + (size_t)(coluna - colunaIni) * larguraPainel;
+        for (int p = 0; p < larguraPainel; p++)
+            for (int j = 0; j < MK_COLUNAS; j++)
+                destino[p * MK_COLUNAS + j] = matriz[inicioPainel + p][coluna + j];
+    }
+
+    int ladrilhos = (motor->ordem - fimPainel + TAREFA_LINHAS - 1) / TAREFA_LINHAS;
+    pthread_mutex_lock(&motor->trava);
+    if (ladrilhos == 0) {
+        grupoAtualizado(motor, painel, blocoIni, blocoFim, trabalhador);
+    } else {
+        motor->pendentesBloco[blocoIni] = ladrilhos;
+        motor->fimGrupo[blocoIni] = blocoFim;
+        for (int ladrilho = ladrilhos - 1; ladrilho >= 0; ladrilho--) {
+            submeterTarefa(motor, trabalhador, tarefaProduto, painel, blocoIni, ladrilho);
+        }
+    }
+    pthread_mutex_unlock(&motor->trava);
+}
+
+static void tarefaProduto(void* contexto, const int* argumentos, int trabalhador) {
+    MotorTarefas* motor = (MotorTarefas*) contexto;
+    int painel = argumentos[0], blocoIni = argumentos[1], ladrilho = argumentos[2];
+    int blocoFim = motor->fimGrupo[blocoIni];
+    int inicioPainel = painel * motor->bloco;
+    int fimPainel = fimPainelTarefas(motor, painel);
+    int larguraPainel = fimPainel - inicioPainel;
+    int colunaIni, colunaFim;
+    faixaBlocos(motor, painel, blocoIni, blocoFim, &colunaIni, &colunaFim);
+    int colunasCheias = colunaIni + ((colunaFim - colunaIni) / MK_COLUNAS) * MK_COLUNAS;
+
+    int linhaIni = fimPainel + ladrilho * TAREFA_LINHAS;
+    int linhaFim = linhaIni + TAREFA_LINHAS;
+    if (linhaFim > motor->ordem) linhaFim = motor->ordem;
+    int linhasCheias = linhaIni + ((linhaFim - linhaIni) / MK_LINHAS) * MK_LINHAS;
+
+    if (!tarefasAbortadas(motor)) {
+        // painelL[painel] só é liberado depois deste grupo terminar o passo
+        const double* painelL = motor->painelL[painel];
+        const double* painelU = motor->painelU + (size_t)blocoIni * motor->bloco * motor->bloco;
+        for (int linha = linhaIni; linha < linhasCheias; linha += MK_LINHAS) {
+            const double* grupoL = painelL + (size_t)((linha - fimPainel) / MK_LINHAS) * larguraPainel * MK_LINHAS;
+            for (int coluna = colunaIni; coluna < colunasCheias; coluna += MK_COLUNAS)
+                microKernelAtualizacao(motor->matriz, linha, coluna, grupoL,
+                                       painelU + (size_t)(coluna - colunaIni) * larguraPainel,
+                                       larguraPainel);
+            atualizacaoBorda(motor->matriz, linha, linha + MK_LINHAS, colunasCheias, colunaFim,
+                             inicioPainel, larguraPainel);
+        }
+        atualizacaoBorda(motor->matriz, linhasCheias, linhaFim, colunaIni, colunaFim,
+                         inicioPainel, larguraPainel);
+    }
+
+    pthread_mutex_lock(&motor->trava);
+    if (--motor->pendentesBloco[blocoIni] == 0) {
+        grupoAtualizado(motor, painel, blocoIni, blocoFim, trabalhador);
+    }
+    pthread_mutex_unlock(&motor->trava);
+}
+
+/**
+ * @brief Eliminação em blocos pelo motor de tarefas (mesmo contrato de
+ *        eliminacaoBlocadaNucleo).
+ *
+ * @return 1 se executou (resultado em @p status); 0 se não foi possível montar
+ *         o motor (memória/threads) e o chamador deve usar a versão em laços.
+ */
+static int eliminacaoTarefasNucleo(double** matrizEstendida, int ordemMatriz, int nColunas,
+                                   int tamanhoBloco, int checarTolerancia, double tolerancia,
+                                   int* permutacao, GaussStatus* status) {
+    MotorTarefas motor;
+    memset(&motor, 0, sizeof(motor));
+    motor.matriz = matrizEstendida;
+    motor.ordem = ordemMatriz;
+    motor.nColunas = nColunas;
+    motor.bloco = tamanhoBloco;
+    motor.numPaineis = (ordemMatriz + tamanhoBloco - 1) / tamanhoBloco;
+    motor.numBlocos = (nColunas + tamanhoBloco - 1) / tamanhoBloco;
+    motor.checarTolerancia = checarTolerancia;
+    motor.tolerancia = tolerancia;
+    motor.permutacao = permutacao;
+    motor.status = GAUSS_OK;
+
+    int numTrabalhadores = (g_numThreads > 0) ? g_numThreads : agendadorNumProcessadores();
+    (void) kernelNivelAtivo(); /* resolve o despacho SIMD antes de abrir os trabalhadores */
+    motor.pivos = (int*) malloc(ordemMatriz * sizeof(int));
+    motor.painelL = (double**) calloc(motor.numPaineis, sizeof(double*));
+    motor.painelU = (double*) malloc((size_t)motor.numBlocos * tamanhoBloco * tamanhoBloco * sizeof(double));
+    motor.pendentesBloco = (int*) calloc(motor.numBlocos, sizeof(int));
+    motor.fimGrupo = (int*) calloc(motor.numBlocos, sizeof(int));
+    motor.etapaBloco = (int*) calloc(motor.numBlocos, sizeof(int));
+    motor.blocosAbertos = (int*) calloc(motor.numPaineis, sizeof(int));
+    motor.painelFeito = (unsigned char*) calloc(motor.numPaineis, 1);
+    motor.agendador = (motor.pivos && motor.painelL && motor.painelU && motor.pendentesBloco &&
+                       motor.fimGrupo && motor.etapaBloco && motor.blocosAbertos && motor.painelFeito)
+                      ? criarAgendador(numTrabalhadores) : NULL;
+
+    int executou = motor.agendador != NULL;
+    if (executou) {
+        pthread_mutex_init(&motor.trava, NULL);
+        pthread_mutex_lock(&motor.trava);
+        submeterTarefa(&motor, 0, tarefaPainel, 0, 0, 0);
+        pthread_mutex_unlock(&motor.trava);
+        agendadorExecutar(motor.agendador);
+        destruirAgendador(motor.agendador);
+        pthread_mutex_destroy(&motor.trava);
+
+        *status = motor.status;
+        if (*status == GAUSS_OK) {
+            // trocas de cada painel nas colunas à esquerda dele (multiplicadores de L)
+            for (int painel = 1; painel < motor.numPaineis; painel++) {
+                int inicioPainel = painel * tamanhoBloco;
+                int fimPainel = fimPainelTarefas(&motor, painel);
+                for (int colunaPivo = inicioPainel; colunaPivo < fimPainel; colunaPivo++) {
+                    int linhaPivo = motor.pivos[colunaPivo];
+                    if (linhaPivo == colunaPivo) continue;
+                    double* a = matrizEstendida[colunaPivo];
+                    double* b = matrizEstendida[linhaPivo];
+                    for (int coluna = 0; coluna < inicioPainel; coluna++) {
+                        double temp = a[coluna];
+                        a[coluna] = b[coluna];
+                        b[coluna] = temp;
+                    }
+                }
+            }
+            // pivô final (mesma regra da versão clássica)
+            if (checarTolerancia &&
+                fabs(matrizEstendida[ordemMatriz - 1][ordemMatriz - 1]) < tolerancia) {
+                *status = GAUSS_SINGULAR;
+            }
+        }
+    }
+
+    if (motor.painelL) {
+        for (int painel = 0; painel < motor.numPaineis; painel++) free(motor.painelL[painel]);
+    }
+    free(motor.pivos);
+    free(motor.painelL);
+    free(motor.painelU);
+    free(motor.pendentesBloco);
+    free(motor.fimGrupo);
+    free(motor.etapaBloco);
+    free(motor.blocosAbertos);
+    free(motor.painelFeito);
+    return executou;
+}
+
+/**
+ * @brief Eliminação em blocos pelo motor em laços (contrato de eliminacaoBlocadaNucleo).
+ *
+ * @param pivosTorneio NULL para pivotamento parcial; senão, tamanhoBloco
+ *                     posições para as trocas do torneio de cada painel.
+ */
+static GaussStatus eliminacaoLacosNucleo(double** matrizEstendida, int ordemMatriz,
+                                         int nColunas, int tamanhoBloco,
+                                         int checarTolerancia, double tolerancia,
+                                         int* permutacao, int* pivosTorneio) {
+    for (int inicioPainel = 0; inicioPainel < ordemMatriz; inicioPainel += tamanhoBloco) {
+        int larguraPainel = tamanhoBloco;
+        if (inicioPainel + larguraPainel > ordemMatriz)
+            larguraPainel = ordemMatriz - inicioPainel;
+        int fimPainel = inicioPainel + larguraPainel;
+
+        // (a) painel: pivotamento parcial (ou torneio) restrito às colunas do painel
+        if (pivosTorneio &&
+            !selecionarPivosTorneio(matrizEstendida, ordemMatriz, inicioPainel, fimPainel,
+                                    pivosTorneio, usarParalelo(ordemMatriz - inicioPainel))) {
+            return GAUSS_SINGULAR; /* sem enum específico para memória */
+        }
+        for (int colunaPivo = inicioPainel; colunaPivo < fimPainel; colunaPivo++) {
+            double maxAbs;
+            int linhaPivo = escolherPivo(matrizEstendida, ordemMatriz, colunaPivo,
+                                         pivosTorneio, inicioPainel, &maxAbs);
+
+            if (checarTolerancia && maxAbs < tolerancia) {
+                return GAUSS_SINGULAR;
+            }
+
+            // troca a linha inteira (ponteiros), inclusive multiplicadores já gravados
+            if (linhaPivo != colunaPivo) {
+                double* temp = matrizEstendida[colunaPivo];
+                matrizEstendida[colunaPivo] = matrizEstendida[linhaPivo];
+                matrizEstendida[linhaPivo] = temp;
+                if (permutacao) {
+                    int tempIndice = permutacao[colunaPivo];
+                    permutacao[colunaPivo] = permutacao[linhaPivo];
+                    permutacao[linhaPivo] = tempIndice;
+                }
+            }
+
+            double* linhaDoPivo = matrizEstendida[colunaPivo];
+            double pivo = linhaDoPivo[colunaPivo];
+            for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
+                double* linhaAtual = matrizEstendida[linha];
+                double multiplicador = linhaAtual[colunaPivo] / pivo;
+                linhaAtual[colunaPivo] = multiplicador;
+                if (multiplicador == 0.0) continue;
+                kernelAtualizarLinha(linhaAtual + colunaPivo + 1, linhaDoPivo + colunaPivo + 1,
+                                     multiplicador, fimPainel - colunaPivo - 1);
+            }
+        }
+
+        if (fimPainel >= nColunas) continue;
+
+        // (b) U12 = L11^{-1} A12 (L11 unitária)
+        for (int colunaPivo = inicioPainel; colunaPivo < fimPainel; colunaPivo++) {
+            const double* linhaDoPivo = matrizEstendida[colunaPivo];
+            for (int linha = colunaPivo + 1; linha < fimPainel; linha++) {
+                double multiplicador = matrizEstendida[linha][colunaPivo];
+                if (multiplicador == 0.0) continue;
+                kernelAtualizarLinha(matrizEstendida[linha] + fimPainel, linhaDoPivo + fimPainel,
+                                     multiplicador, nColunas - fimPainel);
+            }
+        }
+
+        // (c) A22 -= L21 * U12
+        if (!atualizarSubmatriz(matrizEstendida, fimPainel, ordemMatriz,
+                                fimPainel, nColunas, inicioPainel, larguraPainel)) {
+            return GAUSS_SINGULAR; /* sem enum específico para memória */
+        }
+    }
+
+    // pivô final (mesma regra da versão clássica)
+    if (checarTolerancia &&
+        fabs(matrizEstendida[ordemMatriz - 1][ordemMatriz - 1]) < tolerancia) {
+        return GAUSS_SINGULAR;
+    }
 
     return GAUSS_OK;
 }
 
+/**
+ * @brief Núcleo da eliminação em blocos sobre [A|B] (n linhas, nColunas colunas).
+ *
+ * Ao final, o triângulo superior contém U (e as colunas extras contêm c);
+ * abaixo da diagonal ficam os multiplicadores de L. Se @p permutacao não for
+ * NULL (inicializada com a identidade), registra as trocas de linha.
+ */
+static GaussStatus eliminacaoBlocadaNucleo(double** matrizEstendida, int ordemMatriz,
+                                           int nColunas, int tamanhoBloco,
+                                           int checarTolerancia, double tolerancia,
+                                           int* permutacao) {
+    if (tamanhoBloco <= 0) tamanhoBloco = GAUSS_BLOCO_PADRAO;
+
+    if (g_motor == GAUSS_MOTOR_TAREFAS && ordemMatriz >= g_corteParalelo) {
+        GaussStatus status;
+        if (eliminacaoTarefasNucleo(matrizEstendida, ordemMatriz, nColunas, tamanhoBloco,
+                                    checarTolerancia, tolerancia, permutacao, &status)) {
+            return status;
+        }
+    }
+
+    int* pivosTorneio = NULL;
+    if (g_pivoPainel == GAUSS_PIVO_TORNEIO) {
+        pivosTorneio = (int*) malloc(tamanhoBloco * sizeof(int));
+        if (!pivosTorneio) return GAUSS_SINGULAR; /* sem enum específico para memória */
+    }
+    GaussStatus status = eliminacaoLacosNucleo(matrizEstendida, ordemMatriz, nColunas,
+                                               tamanhoBloco, checarTolerancia, tolerancia,
+                                               permutacao, pivosTorneio);
+    free(pivosTorneio);
+    return status;
+}
+
+GaussStatus eliminacao_blocada(double** matrizEstendida, int ordemMatriz, int tamanhoBloco) {
+    return eliminacaoBlocadaNucleo(matrizEstendida, ordemMatriz, ordemMatriz + 1,
+                                   tamanhoBloco, 0, 0.0, NULL);
+}
+
+GaussStatus eliminacao_blocada_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                              int tamanhoBloco, double tolerancia) {
+    return eliminacaoBlocadaNucleo(matrizEstendida, ordemMatriz, ordemMatriz + 1,
+                                   tamanhoBloco, 1, tolerancia, NULL);
+}
+
+// ============================================================
+// ELIMINAÇÃO DE GAUSS — versão recursiva (cache-oblivious)
+//   Divide as colunas ao meio: fatora a metade esquerda (com
+//   pivotamento parcial), resolve U12 = L11^{-1} A12 e atualiza
+//   A22 -= L21 * U12, depois fatora a metade direita. Os produtos
+//   ficam cada vez menores e cabem em algum nível de cache sem um
+//   tamanho de bloco ajustado por máquina.
+// ============================================================
+
+/* Largura do painel eliminado diretamente no fim da recursão */
+#define RECURSAO_BASE 16
+/* Profundidade máxima de cada produto entregue a atualizarSubmatriz */
+#define RECURSAO_PRODUTO_BASE 128
+
+/**
+ * @brief A22 -= L21 * U12 dividindo a profundidade ao meio até RECURSAO_PRODUTO_BASE.
+ * @return 1 em sucesso; 0 em falha de alocação.
+ */
+static int produtoRecursivo(double** matriz, int linhaIni, int linhaFim,
+                            int colunaIni, int colunaFim,
+                            int inicioPainel, int larguraPainel) {
+    if (linhaIni >= linhaFim || colunaIni >= colunaFim || larguraPainel <= 0) return 1;
+    if (larguraPainel > RECURSAO_PRODUTO_BASE) {
+        int metade = larguraPainel / 2;
+        return produtoRecursivo(matriz, linhaIni, linhaFim, colunaIni, colunaFim,
+                                inicioPainel, metade) &&
+               produtoRecursivo(matriz, linhaIni, linhaFim, colunaIni, colunaFim,
+                                inicioPainel + metade, larguraPainel - metade);
+    }
+    return atualizarSubmatriz(matriz, linhaIni, linhaFim, colunaIni, colunaFim,
+                              inicioPainel, larguraPainel);
+}
+
+/**
+ * @brief U12 = L11^{-1} A12 (L11 unitária em [linhaIni, linhaFim)), recursivamente.
+ * @return 1 em sucesso; 0 em falha de alocação.
+ */
+static int trsmRecursiva(double** matriz, int linhaIni, int linhaFim,
+                         int colunaIni, int colunaFim) {
+    int altura = linhaFim - linhaIni;
+    if (altura <= RECURSAO_BASE) {
+        for (int k = linhaIni; k < linhaFim; k++) {
+            for (int linha = k + 1; linha < linhaFim; linha++) {
+                double multiplicador = matriz[linha][k];
+                if (multiplicador == 0.0) continue;
+                kernelAtualizarLinha(matriz[linha] + colunaIni, matriz[k] + colunaIni,
+                                     multiplicador, colunaFim - colunaIni);
+            }
+        }
+        return 1;
+    }
+    int meio = linhaIni + altura / 2;
+    return trsmRecursiva(matriz, linhaIni, meio, colunaIni, colunaFim) &&
+           produtoRecursivo(matriz, meio, linhaFim, colunaIni, colunaFim,
+                            linhaIni, meio - linhaIni) &&
+           trsmRecursiva(matriz, meio, linhaFim, colunaIni, colunaFim);
+}
+
+/**
+ * @brief Fatora as colunas [colunaIni, colunaFim) das linhas [colunaIni, n), no lugar,
+ *        com pivotamento parcial (trocas de ponteiros de linha inteira).
+ */
+static GaussStatus eliminacaoRecursivaNucleo(double** matrizEstendida, int ordemMatriz,
+                                             int colunaIni, int colunaFim,
+                                             int checarTolerancia, double tolerancia) {
+    int largura = colunaFim - colunaIni;
+    if (largura <= RECURSAO_BASE) {
+        for (int colunaPivo = colunaIni; colunaPivo < colunaFim; colunaPivo++) {
+            double maxAbs = fabs(matrizEstendida[colunaPivo][colunaPivo]);
+            int linhaPivo = colunaPivo;
+            for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
+                double valor = fabs(matrizEstendida[linha][colunaPivo]);
+                if (valor > maxAbs) {
+                    maxAbs = valor;
+                    linhaPivo = linha;
+                }
+            }
+
+            if (checarTolerancia && maxAbs < tolerancia) {
+                return GAUSS_SINGULAR; /* inclui o pivô final, como na versão clássica */
+            }
+
+            if (linhaPivo != colunaPivo) {
+                double* temp = matrizEstendida[colunaPivo];
+                matrizEstendida[colunaPivo] = matrizEstendida[linhaPivo];
+                matrizEstendida[linhaPivo] = temp;
+            }
+
+            double* linhaDoPivo = matrizEstendida[colunaPivo];
+            double pivo = linhaDoPivo[colunaPivo];
+            for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
+                double* linhaAtual = matrizEstendida[linha];
+                double multiplicador = linhaAtual[colunaPivo] / pivo;
+                linhaAtual[colunaPivo] = multiplicador;
+                if (multiplicador == 0.0 || colunaPivo + 1 >= colunaFim) continue;
+                kernelAtualizarLinha(linhaAtual + colunaPivo + 1, linhaDoPivo + colunaPivo + 1,
+                                     multiplicador, colunaFim - colunaPivo - 1);
+            }
+        }
+        return GAUSS_OK;
+    }
+
+    int meio = colunaIni + largura / 2;
+    GaussStatus status = eliminacaoRecursivaNucleo(matrizEstendida, ordemMatriz, colunaIni, meio,
+                                                   checarTolerancia, tolerancia);
+    if (status != GAUSS_OK) return status;
+
+    if (!trsmRecursiva(matrizEstendida, colunaIni, meio, meio, colunaFim) ||
+        !produtoRecursivo(matrizEstendida, meio, ordemMatriz, meio, colunaFim,
+                          colunaIni, meio - colunaIni)) {
+        return GAUSS_SINGULAR; /* sem enum específico para memória */
+    }
+
+    return eliminacaoRecursivaNucleo(matrizEstendida, ordemMatriz, meio, colunaFim,
+                                     checarTolerancia, tolerancia);
+}
+
+/**
+ * @brief Fatora A recursivamente e aplica L^{-1} às colunas de b.
+ */
+static GaussStatus eliminacaoRecursiva(double** matrizEstendida, int ordemMatriz,
+                                       int checarTolerancia, double tolerancia) {
+    GaussStatus status = eliminacaoRecursivaNucleo(matrizEstendida, ordemMatriz, 0, ordemMatriz,
+                                                   checarTolerancia, tolerancia);
+    if (status != GAUSS_OK) return status;
+
+    // c = L^{-1} P b (as trocas de linha já levaram b junto)
+    if (!trsmRecursiva(matrizEstendida, 0, ordemMatriz, ordemMatriz, ordemMatriz + 1)) {
+        return GAUSS_SINGULAR;
+    }
+    return GAUSS_OK;
+}
+
+GaussStatus eliminacao_recursiva(double** matrizEstendida, int ordemMatriz) {
+    return eliminacaoRecursiva(matrizEstendida, ordemMatriz, 0, 0.0);
+}
+
+GaussStatus eliminacao_recursiva_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                                double tolerancia) {
+    return eliminacaoRecursiva(matrizEstendida, ordemMatriz, 1, tolerancia);
+}
+
 // ============================================================
 // SUBSTITUIÇÃO REGRESSIVA (Ux = c)
 // ============================================================
@@ -110,6 +1145,567 @@ GaussStatus substituicaoRegressiva(double** matrizEstendida, int ordemMatriz, do
     return GAUSS_OK;
 }
 
+// ============================================================
+// MÚLTIPLOS LADOS DIREITOS — [A|B], B com k colunas
+//   Uma única eliminação (O(n³)) para todos os k sistemas e
+//   substituição regressiva vetorizada ao longo das k colunas.
+// ============================================================
+GaussStatus eliminacao_multiplos(double** matrizEstendida, int ordemMatriz, int numLados) {
+    if (numLados < 1) return GAUSS_SINGULAR;
+    return eliminacaoBlocadaNucleo(matrizEstendida, ordemMatriz, ordemMatriz + numLados,
+                                   GAUSS_BLOCO_PADRAO, 0, 0.0, NULL);
+}
+
+GaussStatus eliminacao_multiplos_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                                int numLados, double tolerancia) {
+    if (numLados < 1) return GAUSS_SINGULAR;
+    return eliminacaoBlocadaNucleo(matrizEstendida, ordemMatriz, ordemMatriz + numLados,
+                                   GAUSS_BLOCO_PADRAO, 1, tolerancia, NULL);
+}
+
+GaussStatus substituicaoRegressiva_multiplos(double** matrizEstendida, int ordemMatriz,
+                                             int numLados, double** matrizSolucao) {
+    for (int linha = ordemMatriz - 1; linha >= 0; linha--) {
+        double* x = matrizSolucao[linha];
+
+        // x_linha[:] = c_linha[:] - sum_{coluna > linha} U[linha][coluna] * x_coluna[:]
+        for (int lado = 0; lado < numLados; lado++) {
+            x[lado] = matrizEstendida[linha][ordemMatriz + lado];
+        }
+        for (int coluna = linha + 1; coluna < ordemMatriz; coluna++) {
+            double u = matrizEstendida[linha][coluna];
+            if (u == 0.0) continue;
+            kernelAtualizarLinha(x, matrizSolucao[coluna], u, numLados);
+        }
+
+        double diagonal = matrizEstendida[linha][linha];
+        for (int lado = 0; lado < numLados; lado++) {
+            x[lado] /= diagonal;
+        }
+    }
+
+    return GAUSS_OK;
+}
+
+// ============================================================
+// FATORAÇÃO REUTILIZÁVEL — PA = LU in-place + vetor de permutação
+//   gauss_fatorar: O(n³), uma vez; gauss_resolver: O(n²), quantas vezes
+//   for necessário (inclusive em paralelo, pois só lê a fatoração).
+// ============================================================
+GaussStatus gauss_fatorar(double** matrizA, int ordemMatriz, double tolerancia,
+                          GaussFatoracao* fatoracao) {
+    fatoracao->lu = NULL;
+    fatoracao->permutacao = NULL;
+    fatoracao->ordem = 0;
+    if (ordemMatriz < 1) return GAUSS_SINGULAR;
+
+    int* permutacao = (int*) malloc(ordemMatriz * sizeof(int));
+    if (!permutacao) return GAUSS_SINGULAR; /* sem enum específico para memória */
+    for (int linha = 0; linha < ordemMatriz; linha++) permutacao[linha] = linha;
+
+    GaussStatus status = eliminacaoBlocadaNucleo(matrizA, ordemMatriz, ordemMatriz,
+                                                 GAUSS_BLOCO_PADRAO, 1, tolerancia,
+                                                 permutacao);
+    if (status != GAUSS_OK) {
+        free(permutacao);
+        return status;
+    }
+
+    fatoracao->lu = matrizA;
+    fatoracao->permutacao = permutacao;
+    fatoracao->ordem = ordemMatriz;
+    return GAUSS_OK;
+}
+
+GaussStatus gauss_resolver(const GaussFatoracao* fatoracao, const double* vetorB,
+                           double* vetorSolucao) {
+    if (!fatoracao || !fatoracao->lu || !fatoracao->permutacao) return GAUSS_SINGULAR;
+    double** lu = fatoracao->lu;
+    int ordemMatriz = fatoracao->ordem;
+
+    // (1) y = P b
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        vetorSolucao[linha] = vetorB[fatoracao->permutacao[linha]];
+    }
+
+    // (2) L y = P b (diagonal unitária), in-place
+    for (int linha = 1; linha < ordemMatriz; linha++) {
+        const double* linhaL = lu[linha];
+        double soma = 0.0;
+        for (int coluna = 0; coluna < linha; coluna++) {
+            soma += linhaL[coluna] * vetorSolucao[coluna];
+        }
+        vetorSolucao[linha] -= soma;
+    }
+
+    // (3) U x = y, in-place
+    for (int linha = ordemMatriz - 1; linha >= 0; linha--) {
+        const double* linhaU = lu[linha];
+        double soma = 0.0;
+        for (int coluna = linha + 1; coluna < ordemMatriz; coluna++) {
+            soma += linhaU[coluna] * vetorSolucao[coluna];
+        }
+        vetorSolucao[linha] = (vetorSolucao[linha] - soma) / linhaU[linha];
+    }
+
+    return GAUSS_OK;
+}
+
+void gauss_liberarFatoracao(GaussFatoracao* fatoracao) {
+    if (!fatoracao) return;
+    free(fatoracao->permutacao);
+    fatoracao->permutacao = NULL;
+    fatoracao->lu = NULL;
+    fatoracao->ordem = 0;
+}
+
+// ============================================================
+// PRECISÃO MISTA — PA = LU em float (O(n³), metade dos bytes por
+// elemento) e refinamento iterativo em double (O(n²) por passo):
+//     r = b - A x (double);  LU d = P r;  x += d
+// até o erro retroativo chegar ao nível da precisão dupla. Se A for
+// mal condicionada demais para float, o refinamento estaciona e a
+// solução é refeita inteiramente em double.
+// ============================================================
+
+#define MK_COLUNAS_F KERNEL_MK_COLUNAS_F
+
+/* Fatores L\U em float sobre um bloco contíguo (linhas trocadas por ponteiro) */
+typedef struct {
+    float** linhas;
+    float*  dados;
+    int*    permutacao;
+    int     ordem;
+} FatoracaoSimples;
+
+static void liberarFatoracaoSimples(FatoracaoSimples* fatoracao) {
+    free(fatoracao->linhas);
+    free(fatoracao->dados);
+    free(fatoracao->permutacao);
+    memset(fatoracao, 0, sizeof(*fatoracao));
+}
+
+/* Bordas da atualização em float (ver atualizacaoBorda) */
+static void atualizacaoBordaF(float** matriz, int linhaIni, int linhaFim,
+                              int colunaIni, int colunaFim,
+                              int inicioPainel, int larguraPainel) {
+    for (int linha = linhaIni; linha < linhaFim; linha++) {
+        float* linhaC = matriz[linha];
+        for (int p = inicioPainel; p < inicioPainel + larguraPainel; p++) {
+            float l = linhaC[p];
+            if (l == 0.0f) continue;
+            kernelAtualizarLinhaF(linhaC + colunaIni, matriz[p] + colunaIni,
+                                  l, colunaFim - colunaIni);
+        }
+    }
+}
+
+/* A22 -= L21 * U12 em float: mesmo esquema de atualizarSubmatriz, ladrilho 4x16 */
+static int atualizarSubmatrizF(float** matriz, int linhaIni, int linhaFim,
+                               int colunaIni, int colunaFim,
+                               int inicioPainel, int larguraPainel) {
+    int paralelo = usarParalelo(linhaFim - linhaIni);
+    int numThreads = paralelo ? gaussNumThreads() : 1;
+    size_t tamanhoPainelL = (size_t)larguraPainel * MK_LINHAS;
+
+    float* painelU = (float*) malloc((size_t)larguraPainel * FAIXA_COLUNAS * sizeof(float));
+    float* painelL = (float*) malloc(tamanhoPainelL * numThreads * sizeof(float));
+    if (!painelU || !painelL) {
+        free(painelU); free(painelL);
+        return 0;
+    }
+
+    int gruposLinhas = (linhaFim - linhaIni) / MK_LINHAS;
+    int linhasCheias = linhaIni + gruposLinhas * MK_LINHAS;
+
+    for (int faixa = colunaIni; faixa < colunaFim; faixa += FAIXA_COLUNAS) {
+        int fimFaixa = faixa + FAIXA_COLUNAS;
+        if (fimFaixa > colunaFim) fimFaixa = colunaFim;
+        int colunasCheias = faixa + ((fimFaixa - faixa) / MK_COLUNAS_F) * MK_COLUNAS_F;
+
+        for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS_F) {
+            float* destino = painelU + (size_t)(coluna - faixa) * larguraPainel;
+            for (int p = 0; p < larguraPainel; p++)
+                for (int j = 0; j < MK_COLUNAS_F; j++)
+                    destino[p * MK_COLUNAS_F + j] = matriz[inicioPainel + p][coluna + j];
+        }
+
+        GAUSS_PRAGMA(omp parallel for schedule(static) num_threads(numThreads) if(paralelo))
+        for (int grupo = 0; grupo < gruposLinhas; grupo++) {
+            int linha = linhaIni + grupo * MK_LINHAS;
+            float* meuPainelL = painelL + tamanhoPainelL * idThread();
+
+            for (int p = 0; p < larguraPainel; p++)
+                for (int i = 0; i < MK_LINHAS; i++)
+                    meuPainelL[p * MK_LINHAS + i] = matriz[linha + i][inicioPainel + p];
+
+            for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS_F) {
+                float* linhasC[MK_LINHAS];
+                for (int i = 0; i < MK_LINHAS; i++) linhasC[i] = matriz[linha + i] + coluna;
+                kernelMicroAtualizacaoF(linhasC, meuPainelL,
+                                        painelU + (size_t)(coluna - faixa) * larguraPainel,
+                                        larguraPainel);
+            }
+            atualizacaoBordaF(matriz, linha, linha + MK_LINHAS, colunasCheias, fimFaixa,
+                              inicioPainel, larguraPainel);
+        }
+        atualizacaoBordaF(matriz, linhasCheias, linhaFim, faixa, fimFaixa,
+                          inicioPainel, larguraPainel);
+    }
+
+    free(painelU);
+    free(painelL);
+    return 1;
+}
+
+/**
+ * @brief Converte A para float e fatora PA = LU em blocos (mesmo algoritmo de
+ *        eliminacaoBlocadaNucleo, só que em precisão simples).
+ *
+ * @return GAUSS_OK; GAUSS_SINGULAR se algum |a_ij| não couber em float, se um
+ *         pivô ficar abaixo de @p tolerancia ou em falha de alocação.
+ */
+static GaussStatus fatorarSimples(double** matrizA, int ordemMatriz, double tolerancia,
+                                  FatoracaoSimples* fatoracao) {
+    memset(fatoracao, 0, sizeof(*fatoracao));
+    int passo = (ordemMatriz + MK_COLUNAS_F - 1) / MK_COLUNAS_F * MK_COLUNAS_F;
+    fatoracao->linhas = (float**) malloc(ordemMatriz * sizeof(float*));
+    fatoracao->dados = (float*) malloc((size_t)ordemMatriz * passo * sizeof(float));
+    fatoracao->permutacao = (int*) malloc(ordemMatriz * sizeof(int));
+    fatoracao->ordem = ordemMatriz;
+    if (!fatoracao->linhas || !fatoracao->dados || !fatoracao->permutacao) {
+        liberarFatoracaoSimples(fatoracao);
+        return GAUSS_SINGULAR; /* sem enum específico para memória */
+    }
+
+    float** lu = fatoracao->linhas;
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        lu[linha] = fatoracao->dados + (size_t)linha * passo;
+        fatoracao->permutacao[linha] = linha;
+        for (int coluna = 0; coluna < ordemMatriz; coluna++) {
+            double valor = matrizA[linha][coluna];
+            if (fabs(valor) > FLT_MAX) {
+                liberarFatoracaoSimples(fatoracao);
+                return GAUSS_SINGULAR;
+            }
+            lu[linha][coluna] = (float) valor;
+        }
+    }
+
+    for (int inicioPainel = 0; inicioPainel < ordemMatriz; inicioPainel += GAUSS_BLOCO_PADRAO) {
+        int fimPainel = inicioPainel + GAUSS_BLOCO_PADRAO;
+        if (fimPainel > ordemMatriz) fimPainel = ordemMatriz;
+
+        // (a) painel com pivotamento parcial
+        for (int colunaPivo = inicioPainel; colunaPivo < fimPainel; colunaPivo++) {
+            float maxAbs = fabsf(lu[colunaPivo][colunaPivo]);
+            int linhaPivo = colunaPivo;
+            for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
+                float valor = fabsf(lu[linha][colunaPivo]);
+                if (valor > maxAbs) {
+                    maxAbs = valor;
+                    linhaPivo = linha;
+                }
+            }
+            if (!(maxAbs >= tolerancia) || maxAbs == 0.0f) {
+                liberarFatoracaoSimples(fatoracao);
+                return GAUSS_SINGULAR;
+            }
+
+            if (linhaPivo != colunaPivo) {
+                float* temp = lu[colunaPivo];
+                lu[colunaPivo] = lu[linhaPivo];
+                lu[linhaPivo] = temp;
+                int tempIndice = fatoracao->permutacao[colunaPivo];
+                fatoracao->permutacao[colunaPivo] = fatoracao->permutacao[linhaPivo];
+                fatoracao->permutacao[linhaPivo] = tempIndice;
+            }
+
+            const float* linhaDoPivo = lu[colunaPivo];
+            float pivo = linhaDoPivo[colunaPivo];
+            for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
+                float* linhaAtual = lu[linha];
+                float multiplicador = linhaAtual[colunaPivo] / pivo;
+                linhaAtual[colunaPivo] = multiplicador;
+                if (multiplicador == 0.0f) continue;
+                kernelAtualizarLinhaF(linhaAtual + colunaPivo + 1, linhaDoPivo + colunaPivo + 1,
+                                      multiplicador, fimPainel - colunaPivo - 1);
+            }
+        }
+
+        if (fimPainel >= ordemMatriz) continue;
+
+        // (b) U12 = L11^{-1} A12
+        for (int colunaPivo = inicioPainel; colunaPivo < fimPainel; colunaPivo++) {
+            const float* linhaDoPivo = lu[colunaPivo];
+            for (int linha = colunaPivo + 1; linha < fimPainel; linha++) {
+                float multiplicador = lu[linha][colunaPivo];
+                if (multiplicador == 0.0f) continue;
+                kernelAtualizarLinhaF(lu[linha] + fimPainel, linhaDoPivo + fimPainel,
+                                      multiplicador, ordemMatriz - fimPainel);
+            }
+        }
+
+        // (c) A22 -= L21 * U12
+        if (!atualizarSubmatrizF(lu, fimPainel, ordemMatriz, fimPainel, ordemMatriz,
+                                 inicioPainel, fimPainel - inicioPainel)) {
+            liberarFatoracaoSimples(fatoracao);
+            return GAUSS_SINGULAR;
+        }
+    }
+
+    return GAUSS_OK;
+}
+
+/* LU d = P r com os fatores em float, acumulando em double (O(n²)) */
+static void resolverSimples(const FatoracaoSimples* fatoracao, const double* residuo,
+                            double* correcao) {
+    int ordemMatriz = fatoracao->ordem;
+    float** lu = fatoracao->linhas;
+
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        correcao[linha] = residuo[fatoracao->permutacao[linha]];
+    }
+    for (int linha = 1; linha < ordemMatriz; linha++) {
+        const float* linhaL = lu[linha];
+        double soma = 0.0;
+        for (int coluna = 0; coluna < linha; coluna++) {
+            soma += (double) linhaL[coluna] * correcao[coluna];
+        }
+        correcao[linha] -= soma;
+    }
+    for (int linha = ordemMatriz - 1; linha >= 0; linha--) {
+        const float* linhaU = lu[linha];
+        double soma = 0.0;
+        for (int coluna = linha + 1; coluna < ordemMatriz; coluna++) {
+            soma += (double) linhaU[coluna] * correcao[coluna];
+        }
+        correcao[linha] = (correcao[linha] - soma) / (double) linhaU[linha];
+    }
+}
+
+/**
+ * @brief r = b - A x em double e erro retroativo normado
+ *        ||r||∞ / (||A||∞ ||x||∞ + ||b||∞).
+ */
+static double residuoRetroativo(double** matrizEstendida, int ordemMatriz,
+                                const double* vetorSolucao, double normaA, double* residuo) {
+    double normaR = 0.0, normaX = 0.0, normaB = 0.0;
+    int paralelo = usarParalelo(ordemMatriz);
+#ifndef _OPENMP
+    (void) paralelo;
+#endif
+
+    GAUSS_PRAGMA(omp parallel for schedule(static) if(paralelo) reduction(max:normaR, normaB))
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        const double* linhaA = matrizEstendida[linha];
+        double soma = linhaA[ordemMatriz];
+        for (int coluna = 0; coluna < ordemMatriz; coluna++) {
+            soma -= linhaA[coluna] * vetorSolucao[coluna];
+        }
+        residuo[linha] = soma;
+        if (fabs(soma) > normaR) normaR = fabs(soma);
+        if (fabs(linhaA[ordemMatriz]) > normaB) normaB = fabs(linhaA[ordemMatriz]);
+    }
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        if (fabs(vetorSolucao[linha]) > normaX) normaX = fabs(vetorSolucao[linha]);
+    }
+
+    double escala = normaA * normaX + normaB;
+    if (escala == 0.0) return (normaR == 0.0) ? 0.0 : INFINITY;
+    return normaR / escala;
+}
+
+/* Recurso: eliminação em double sobre uma cópia de [A|b] (a original fica intacta) */
+static GaussStatus resolverEmDupla(double** matrizEstendida, int ordemMatriz,
+                                   double* vetorSolucao, double tolerancia) {
+    Matriz* copia = criarMatriz(ordemMatriz, ordemMatriz + 1);
+    if (!copia) return GAUSS_SINGULAR; /* sem enum específico para memória */
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        memcpy(copia->linhas[linha], matrizEstendida[linha], (ordemMatriz + 1) * sizeof(double));
+    }
+    GaussStatus status = gauss_blocado_com_tolerancia(copia->linhas, ordemMatriz, vetorSolucao,
+                                                      GAUSS_BLOCO_PADRAO, tolerancia);
+    destruirMatriz(copia);
+    return status;
+}
+
+GaussStatus gauss_precisao_mista(double** matrizEstendida, int ordemMatriz,
+                                 double* vetorSolucao, double tolerancia,
+                                 GaussPrecisaoMistaInfo* info) {
+    GaussPrecisaoMistaInfo local;
+    if (!info) info = &local;
+    info->iteracoes = 0;
+    info->erroRetroativo = INFINITY;
+    info->recorreuDupla = 0;
+    if (ordemMatriz < 1) return GAUSS_SINGULAR;
+
+    double normaA = 0.0;
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        double soma = 0.0;
+        for (int coluna = 0; coluna < ordemMatriz; coluna++) {
+            soma += fabs(matrizEstendida[linha][coluna]);
+        }
+        if (soma > normaA) normaA = soma;
+    }
+    /* Critério de parada do LAPACK (dsgesv): erro retroativo <= sqrt(n) * eps */
+    double alvo = sqrt((double) ordemMatriz) * DBL_EPSILON;
+
+    double* residuo = (double*) malloc(2 * (size_t)ordemMatriz * sizeof(double));
+    FatoracaoSimples fatoracao;
+    int convergiu = 0;
+
+    if (residuo && fatorarSimples(matrizEstendida, ordemMatriz, tolerancia, &fatoracao) == GAUSS_OK) {
+        double* correcao = residuo + ordemMatriz;
+        double erroAnterior = INFINITY;
+
+        // x0 = (LU)^{-1} P b, ainda com a precisão da fatoração em float
+        for (int linha = 0; linha < ordemMatriz; linha++) {
+            residuo[linha] = matrizEstendida[linha][ordemMatriz];
+        }
+        resolverSimples(&fatoracao, residuo, vetorSolucao);
+
+        for (;;) {
+            double erro = residuoRetroativo(matrizEstendida, ordemMatriz, vetorSolucao,
+                                            normaA, residuo);
+            info->erroRetroativo = erro;
+            if (erro <= alvo) {
+                convergiu = 1;
+                break;
+            }
+            // estagnou (ou divergiu): float não basta para esta matriz
+            if (!(erro < GAUSS_MISTA_REDUCAO_MINIMA * erroAnterior) ||
+                info->iteracoes >= GAUSS_MISTA_MAX_ITERACOES) {
+                break;
+            }
+            erroAnterior = erro;
+
+            resolverSimples(&fatoracao, residuo, correcao);
+            for (int linha = 0; linha < ordemMatriz; linha++) {
+                vetorSolucao[linha] += correcao[linha];
+            }
+            info->iteracoes++;
+        }
+        liberarFatoracaoSimples(&fatoracao);
+    }
+
+    if (convergiu) {
+        free(residuo);
+        return GAUSS_OK;
+    }
+
+    info->recorreuDupla = 1;
+    GaussStatus status = resolverEmDupla(matrizEstendida, ordemMatriz, vetorSolucao, tolerancia);
+    if (status == GAUSS_OK && residuo) {
+        info->erroRetroativo = residuoRetroativo(matrizEstendida, ordemMatriz, vetorSolucao,
+                                                 normaA, residuo);
+    }
+    free(residuo);
+    return status;
+}
+
+// ============================================================
+// REFINAMENTO COM RESÍDUO ESTENDIDO — reaproveita os fatores em
+// double de gauss_fatorar; cada passo custa O(n²):
+//     r = b - A (x + cauda)   (double-double)
+//     LU d = P r;  (x, cauda) += d
+// até a correção relativa (componente a componente) parar de cair.
+// ============================================================
+
+/* max_i |d_i| / |x_i| (componentes nulas de x usam ||x||∞) */
+static double correcaoRelativa(const double* correcao, const double* vetorX, int ordemMatriz) {
+    double normaX = 0.0, maior = 0.0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        if (fabs(vetorX[i]) > normaX) normaX = fabs(vetorX[i]);
+    }
+    for (int i = 0; i < ordemMatriz; i++) {
+        if (correcao[i] == 0.0) continue;
+        double escala = (vetorX[i] != 0.0) ? fabs(vetorX[i]) : normaX;
+        double razao = (escala > 0.0) ? fabs(correcao[i]) / escala : INFINITY;
+        if (razao > maior) maior = razao;
+    }
+    return maior;
+}
+
+GaussStatus gauss_refinar(const GaussFatoracao* fatoracao, double** matrizA,
+                          const double* vetorB, double* vetorSolucao,
+                          GaussRefinamentoInfo* info) {
+    GaussRefinamentoInfo local;
+    if (!info) info = &local;
+    info->iteracoes = 0;
+    info->limiteErro = INFINITY;
+    info->convergiu = 0;
+
+    GaussStatus status = gauss_resolver(fatoracao, vetorB, vetorSolucao);
+    if (status != GAUSS_OK) return status;
+    int ordemMatriz = fatoracao->ordem;
+
+    double* trabalho = (double*) calloc(3 * (size_t)ordemMatriz, sizeof(double));
+    if (!trabalho) return GAUSS_SINGULAR; /* sem enum específico para memória */
+    double* residuo = trabalho;
+    double* correcao = trabalho + ordemMatriz;
+    double* cauda = trabalho + 2 * (size_t)ordemMatriz;
+    int paralelo = usarParalelo(ordemMatriz);
+#ifndef _OPENMP
+    (void) paralelo;
+#endif
+
+    double correcaoAnterior = INFINITY;
+    while (info->iteracoes < GAUSS_REFINO_MAX_ITERACOES) {
+        GAUSS_PRAGMA(omp parallel for schedule(static) if(paralelo))
+        for (int linha = 0; linha < ordemMatriz; linha++) {
+            residuo[linha] = residuoEstendido(matrizA[linha], vetorSolucao, cauda,
+                                              vetorB[linha], ordemMatriz);
+        }
+        gauss_resolver(fatoracao, residuo, correcao);
+
+        double relativa = correcaoRelativa(correcao, vetorSolucao, ordemMatriz);
+        if (!(relativa < GAUSS_REFINO_REDUCAO_MINIMA * correcaoAnterior)) {
+            break; /* estagnou ou divergiu: fica com o x anterior */
+        }
+        somarCorrecaoEstendida(vetorSolucao, cauda, correcao, ordemMatriz);
+        info->iteracoes++;
+        info->limiteErro = relativa;
+        correcaoAnterior = relativa;
+
+        if (relativa <= DBL_EPSILON) {
+            info->convergiu = 1;
+            break;
+        }
+    }
+
+    free(trabalho);
+    return GAUSS_OK;
+}
+
+GaussStatus gauss_refinado(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                           double tolerancia, GaussRefinamentoInfo* info) {
+    if (ordemMatriz < 1) return GAUSS_SINGULAR;
+
+    Matriz* fatores = criarMatriz(ordemMatriz, ordemMatriz);
+    double* vetorB = (double*) malloc(ordemMatriz * sizeof(double));
+    if (!fatores || !vetorB) {
+        destruirMatriz(fatores);
+        free(vetorB);
+        return GAUSS_SINGULAR; /* sem enum específico para memória */
+    }
+    for (int linha = 0; linha < ordemMatriz; linha++) {
+        memcpy(fatores->linhas[linha], matrizEstendida[linha], ordemMatriz * sizeof(double));
+        vetorB[linha] = matrizEstendida[linha][ordemMatriz];
+    }
+
+    GaussFatoracao fatoracao;
+    GaussStatus status = gauss_fatorar(fatores->linhas, ordemMatriz, tolerancia, &fatoracao);
+    if (status == GAUSS_OK) {
+        status = gauss_refinar(&fatoracao, matrizEstendida, vetorB, vetorSolucao, info);
+        gauss_liberarFatoracao(&fatoracao);
+    }
+
+    destruirMatriz(fatores);
+    free(vetorB);
+    return status;
+}
+
 // ============================================================
 // WRAPPERS
 // ============================================================
@@ -126,6 +1722,52 @@ GaussStatus gauss_com_tolerancia(double** matrizEstendida, int ordemMatriz,
     return substituicaoRegressiva(matrizEstendida, ordemMatriz, vetorSolucao);
 }
 
+GaussStatus gauss_blocado(double** matrizEstendida, int ordemMatriz,
+                          double* vetorSolucao, int tamanhoBloco) {
+    GaussStatus status = eliminacao_blocada(matrizEstendida, ordemMatriz, tamanhoBloco);
+    if (status != GAUSS_OK) return status;
+    return substituicaoRegressiva(matrizEstendida, ordemMatriz, vetorSolucao);
+}
+
+GaussStatus gauss_blocado_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                         double* vetorSolucao, int tamanhoBloco,
+                                         double tolerancia) {
+    GaussStatus status = eliminacao_blocada_com_tolerancia(matrizEstendida, ordemMatriz,
+                                                           tamanhoBloco, tolerancia);
+    if (status != GAUSS_OK) return status;
+    return substituicaoRegressiva(matrizEstendida, ordemMatriz, vetorSolucao);
+}
+
+GaussStatus gauss_recursivo(double** matrizEstendida, int ordemMatriz, double* vetorSolucao) {
+    GaussStatus status = eliminacao_recursiva(matrizEstendida, ordemMatriz);
+    if (status != GAUSS_OK) return status;
+    return substituicaoRegressiva(matrizEstendida, ordemMatriz, vetorSolucao);
+}
+
+GaussStatus gauss_recursivo_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                           double* vetorSolucao, double tolerancia) {
+    GaussStatus status = eliminacao_recursiva_com_tolerancia(matrizEstendida, ordemMatriz,
+                                                             tolerancia);
+    if (status != GAUSS_OK) return status;
+    return substituicaoRegressiva(matrizEstendida, ordemMatriz, vetorSolucao);
+}
+
+GaussStatus gauss_multiplos(double** matrizEstendida, int ordemMatriz,
+                            int numLados, double** matrizSolucao) {
+    GaussStatus status = eliminacao_multiplos(matrizEstendida, ordemMatriz, numLados);
+    if (status != GAUSS_OK) return status;
+    return substituicaoRegressiva_multiplos(matrizEstendida, ordemMatriz, numLados, matrizSolucao);
+}
+
+GaussStatus gauss_multiplos_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                           int numLados, double** matrizSolucao,
+                                           double tolerancia) {
+    GaussStatus status = eliminacao_multiplos_com_tolerancia(matrizEstendida, ordemMatriz,
+                                                             numLados, tolerancia);
+    if (status != GAUSS_OK) return status;
+    return substituicaoRegressiva_multiplos(matrizEstendida, ordemMatriz, numLados, matrizSolucao);
+}
+
 // ============================================================
 // Utilitário: imprimir status
 // ============================================================
@@ -14,6 +14,29 @@ typedef enum {
     GAUSS_INCONSISTENTE = 2 /**< Sistema inconsistente (linha nula em A com b ≠ 0). */
 } GaussStatus;
 
+/**
+ * @brief Número mínimo de linhas restantes para paralelizar a atualização
+ *        (abaixo disso o custo de sincronização supera o ganho).
+ */
+#ifndef GAUSS_CORTE_PARALELO
+#define GAUSS_CORTE_PARALELO 256
+#endif
+
+/**
+ * @brief Tamanho de bloco (largura do painel) usado quando o chamador passa tamanhoBloco <= 0.
+ */
+#ifndef GAUSS_BLOCO_PADRAO
+#define GAUSS_BLOCO_PADRAO 64
+#endif
+
+/**
+ * @brief Linhas por bloco-folha do pivotamento por torneio (ver @ref gaussDefinirPivoPainel);
+ *        usa-se pelo menos 2 * largura do painel.
+ */
+#ifndef GAUSS_TORNEIO_LINHAS
+#define GAUSS_TORNEIO_LINHAS 512
+#endif
+
 /**
  * @brief Executa a eliminação de Gauss com **pivotamento parcial** (troca de linhas) **com tolerância**.
  *
@@ -45,6 +68,79 @@ GaussStatus eliminacao_com_tolerancia(double** matrizEstendida,
  */
 GaussStatus eliminacao(double** matrizEstendida, int ordemMatriz);
 
+/**
+ * @brief Eliminação de Gauss com pivotamento parcial **em blocos** (right-looking), sem tolerância.
+ *
+ * Fatora painéis de @p tamanhoBloco colunas com pivotamento parcial e aplica
+ * a atualização da submatriz restante em ladrilhos (A22 -= L21 * U12), o que
+ * reaproveita os dados em cache em vez de varrer a submatriz inteira a cada pivô.
+ * A escolha dos pivôs é a mesma da @ref eliminacao; o resultado difere apenas
+ * por arredondamento (ordem das operações).
+ *
+ * Ao final, o triângulo superior de @p matrizEstendida contém [U|c] (como na
+ * versão clássica) e a parte estritamente inferior guarda os multiplicadores de L
+ * em vez de zeros.
+ *
+ * @param matrizEstendida Matriz aumentada [A|b], modificada in-place.
+ * @param ordemMatriz     Ordem n da matriz A (n >= 1).
+ * @param tamanhoBloco    Largura do painel (<= 0 usa GAUSS_BLOCO_PADRAO).
+ * @return GAUSS_OK (não aborta por pivô pequeno).
+ */
+GaussStatus eliminacao_blocada(double** matrizEstendida, int ordemMatriz, int tamanhoBloco);
+
+/**
+ * @brief Eliminação de Gauss em blocos **com tolerância**.
+ *
+ * Mesmo contrato de @ref eliminacao_com_tolerancia: retorna GAUSS_SINGULAR se o
+ * pivô escolhido em alguma coluna (ou o último pivô) tiver módulo menor que
+ * @p tolerancia.
+ *
+ * @param matrizEstendida Matriz aumentada [A|b], modificada in-place.
+ * @param ordemMatriz     Ordem n da matriz A (n >= 1).
+ * @param tamanhoBloco    Largura do painel (<= 0 usa GAUSS_BLOCO_PADRAO).
+ * @param tolerancia      Limite abaixo do qual um pivô é considerado nulo.
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0.
+ */
+GaussStatus eliminacao_blocada_com_tolerancia(double** matrizEstendida,
+                                              int ordemMatriz,
+                                              int tamanhoBloco,
+                                              double tolerancia);
+
+/**
+ * @brief Eliminação de Gauss com pivotamento parcial **recursiva** (cache-oblivious), sem tolerância.
+ *
+ * Divide as colunas ao meio recursivamente: fatora a metade esquerda, resolve
+ * U12 = L11^{-1} A12 e atualiza A22 -= L21 * U12 (a maior parte do trabalho vira
+ * multiplicação de matrizes), depois fatora a metade direita. Os blocos diminuem
+ * até caber em cada nível de cache, então não há tamanho de bloco a ajustar por
+ * máquina. A escolha dos pivôs é a mesma da @ref eliminacao (o resultado difere
+ * apenas por arredondamento).
+ *
+ * Ao final, como em @ref eliminacao_blocada, o triângulo superior contém [U|c] e
+ * a parte estritamente inferior guarda os multiplicadores de L.
+ *
+ * @param matrizEstendida Matriz aumentada [A|b], modificada in-place.
+ * @param ordemMatriz     Ordem n da matriz A (n >= 1).
+ * @return GAUSS_OK (não aborta por pivô pequeno).
+ */
+GaussStatus eliminacao_recursiva(double** matrizEstendida, int ordemMatriz);
+
+/**
+ * @brief Eliminação recursiva **com tolerância**.
+ *
+ * Mesmo contrato de @ref eliminacao_com_tolerancia: retorna GAUSS_SINGULAR se o
+ * pivô escolhido em alguma coluna (ou o último pivô) tiver módulo menor que
+ * @p tolerancia.
+ *
+ * @param matrizEstendida Matriz aumentada [A|b], modificada in-place.
+ * @param ordemMatriz     Ordem n da matriz A (n >= 1).
+ * @param tolerancia      Limite abaixo do qual um pivô é considerado nulo.
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0.
+ */
+GaussStatus eliminacao_recursiva_com_tolerancia(double** matrizEstendida,
+                                                int ordemMatriz,
+                                                double tolerancia);
+
 /**
  * @brief Realiza a substituição regressiva em um sistema triangular superior Ux = c.
  *
@@ -92,6 +188,392 @@ GaussStatus gauss_com_tolerancia(double** matrizEstendida,
                                  double* vetorSolucao,
                                  double tolerancia);
 
+/**
+ * @brief Resolve Ax = b por Gauss com pivotamento parcial em blocos **sem tolerância**.
+ *
+ * Wrapper de @ref eliminacao_blocada seguido de @ref substituicaoRegressiva.
+ *
+ * @param matrizEstendida Matriz [A|b], modificada durante o processo.
+ * @param ordemMatriz     Ordem n da matriz.
+ * @param vetorSolucao    Vetor solução (saída), tamanho n.
+ * @param tamanhoBloco    Largura do painel (<= 0 usa GAUSS_BLOCO_PADRAO).
+ * @return GAUSS_OK em sucesso.
+ */
+GaussStatus gauss_blocado(double** matrizEstendida,
+                          int ordemMatriz,
+                          double* vetorSolucao,
+                          int tamanhoBloco);
+
+/**
+ * @brief Resolve Ax = b por Gauss com pivotamento parcial em blocos **com tolerância**.
+ *
+ * Wrapper de @ref eliminacao_blocada_com_tolerancia seguido de
+ * @ref substituicaoRegressiva.
+ *
+ * @param matrizEstendida Matriz [A|b], modificada durante o processo.
+ * @param ordemMatriz     Ordem n da matriz.
+ * @param vetorSolucao    Vetor solução (saída), tamanho n.
+ * @param tamanhoBloco    Largura do painel (<= 0 usa GAUSS_BLOCO_PADRAO).
+ * @param tolerancia      Limite mínimo para o pivô (ex.: 1e-12).
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0.
+ */
+GaussStatus gauss_blocado_com_tolerancia(double** matrizEstendida,
+                                         int ordemMatriz,
+                                         double* vetorSolucao,
+                                         int tamanhoBloco,
+                                         double tolerancia);
+
+/**
+ * @brief Resolve Ax = b por Gauss com pivotamento parcial recursivo **sem tolerância**.
+ *
+ * Wrapper de @ref eliminacao_recursiva seguido de @ref substituicaoRegressiva.
+ *
+ * @param matrizEstendida Matriz [A|b], modificada durante o processo.
+ * @param ordemMatriz     Ordem n da matriz.
+ * @param vetorSolucao    Vetor solução (saída), tamanho n.
+ * @return GAUSS_OK em sucesso.
+ */
+GaussStatus gauss_recursivo(double** matrizEstendida,
+                            int ordemMatriz,
+                            double* vetorSolucao);
+
+/**
+ * @brief Resolve Ax = b por Gauss com pivotamento parcial recursivo **com tolerância**.
+ *
+ * Wrapper de @ref eliminacao_recursiva_com_tolerancia seguido de
+ * @ref substituicaoRegressiva.
+ *
+ * @param matrizEstendida Matriz [A|b], modificada durante o processo.
+ * @param ordemMatriz     Ordem n da matriz.
+ * @param vetorSolucao    Vetor solução (saída), tamanho n.
+ * @param tolerancia      Limite mínimo para o pivô (ex.: 1e-12).
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0.
+ */
+GaussStatus gauss_recursivo_com_tolerancia(double** matrizEstendida,
+                                           int ordemMatriz,
+                                           double* vetorSolucao,
+                                           double tolerancia);
+
+/**
+ * @brief Fatoração PA = LU reutilizável (pivotamento parcial), guardada in-place.
+ *
+ * `lu` é a própria matriz A do chamador: L (diagonal unitária implícita) fica
+ * abaixo da diagonal e U no triângulo superior, com as linhas já na ordem
+ * pivotada (os ponteiros de linha de A são permutados pela fatoração).
+ */
+typedef struct {
+    double** lu;         /**< Fatores L e U compactados sobre A (não pertence à estrutura). */
+    int*     permutacao; /**< permutacao[i] = índice original da linha que está na posição i. */
+    int      ordem;      /**< Ordem n do sistema. */
+} GaussFatoracao;
+
+/**
+ * @brief Fatora A uma única vez (PA = LU, pivotamento parcial, em blocos).
+ *
+ * Custo O(n³). A matriz @p matrizA é sobrescrita pelos fatores e deve continuar
+ * viva enquanto a fatoração for usada; libere-a normalmente depois de
+ * @ref gauss_liberarFatoracao.
+ *
+ * @param matrizA     Matriz A (n × n, colunas extras são ignoradas), sobrescrita com L\U.
+ * @param ordemMatriz Ordem n da matriz.
+ * @param tolerancia  Limite mínimo para o pivô (ex.: 1e-12), como em @ref eliminacao_com_tolerancia.
+ * @param fatoracao   Saída: fatoração pronta para @ref gauss_resolver.
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0 ou falha de alocação.
+ */
+GaussStatus gauss_fatorar(double** matrizA, int ordemMatriz, double tolerancia,
+                          GaussFatoracao* fatoracao);
+
+/**
+ * @brief Resolve Ax = b reaproveitando a fatoração (O(n²)).
+ *
+ * Aplica P, resolve Ly = Pb e Ux = y. Só lê @p fatoracao, então pode ser
+ * chamada simultaneamente por várias threads (cada uma com seus vetores).
+ *
+ * @param fatoracao    Fatoração obtida com @ref gauss_fatorar.
+ * @param vetorB       Lado direito b (tamanho n); não pode coincidir com @p vetorSolucao.
+ * @param vetorSolucao Saída x (tamanho n).
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se a fatoração for inválida.
+ */
+GaussStatus gauss_resolver(const GaussFatoracao* fatoracao, const double* vetorB,
+                           double* vetorSolucao);
+
+/**
+ * @brief Libera os recursos da fatoração (o vetor de permutação).
+ *
+ * A matriz A (fatores) pertence ao chamador e não é liberada aqui.
+ *
+ * @param fatoracao Fatoração a liberar.
+ */
+void gauss_liberarFatoracao(GaussFatoracao* fatoracao);
+
+/**
+ * @brief Máximo de passos em @ref gauss_refinar.
+ */
+#ifndef GAUSS_REFINO_MAX_ITERACOES
+#define GAUSS_REFINO_MAX_ITERACOES 10
+#endif
+
+/**
+ * @brief Cada correção de @ref gauss_refinar precisa ser menor que esta fração
+ *        da anterior; senão o refinamento para (estagnou).
+ */
+#ifndef GAUSS_REFINO_REDUCAO_MINIMA
+#define GAUSS_REFINO_REDUCAO_MINIMA 0.5
+#endif
+
+/**
+ * @brief Diagnóstico de @ref gauss_refinar / @ref gauss_refinado.
+ */
+typedef struct {
+    int    iteracoes;  /**< Correções aplicadas. */
+    double limiteErro; /**< max_i |d_i|/|x_i| da última correção aplicada: estimativa do erro
+                            relativo componente a componente (INFINITY se nenhuma foi aplicada). */
+    int    convergiu;  /**< 1 se a última correção ficou abaixo de ε_double. */
+} GaussRefinamentoInfo;
+
+/**
+ * @brief Resolve Ax = b com os fatores de @ref gauss_fatorar e refina x com
+ *        resíduo em **double-double**.
+ *
+ * Cada passo custa O(n²): r = b − A·x avaliado com ~106 bits (ver
+ * residuo_estendido.h), LU d = Pr com os fatores em double e x += d, com x
+ * mantido como double-double. Os passos continuam enquanto a correção
+ * relativa cair pelo menos pela metade; se a correção parar de cair (cond(A)
+ * acima de ~1/ε, como a Hilbert com n ≥ 13), o x com a menor correção é mantido.
+ *
+ * @param fatoracao    Fatoração de A obtida com @ref gauss_fatorar.
+ * @param matrizA      A **original** (n × n), não os fatores; só é lida.
+ * @param vetorB       Lado direito b (tamanho n).
+ * @param vetorSolucao Saída x (tamanho n).
+ * @param info         (opcional) passos, limite de erro e convergência; NULL ignora.
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se a fatoração for inválida ou faltar memória.
+ */
+GaussStatus gauss_refinar(const GaussFatoracao* fatoracao, double** matrizA,
+                          const double* vetorB, double* vetorSolucao,
+                          GaussRefinamentoInfo* info);
+
+/**
+ * @brief Atalho: fatora uma cópia de A (@ref gauss_fatorar) e chama @ref gauss_refinar.
+ *
+ * @param matrizEstendida Matriz aumentada [A|b]; não é modificada.
+ * @param ordemMatriz     Ordem n da matriz.
+ * @param vetorSolucao    Saída x (tamanho n).
+ * @param tolerancia      Limite mínimo para o pivô (ex.: 1e-12).
+ * @param info            (opcional) diagnóstico do refinamento; NULL ignora.
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0 ou falha de alocação.
+ */
+GaussStatus gauss_refinado(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                           double tolerancia, GaussRefinamentoInfo* info);
+
+/**
+ * @brief Máximo de passos de refinamento em @ref gauss_precisao_mista.
+ */
+#ifndef GAUSS_MISTA_MAX_ITERACOES
+#define GAUSS_MISTA_MAX_ITERACOES 30
+#endif
+
+/**
+ * @brief Cada passo de refinamento precisa reduzir o erro retroativo por pelo
+ *        menos este fator; senão a precisão mista é abandonada.
+ */
+#ifndef GAUSS_MISTA_REDUCAO_MINIMA
+#define GAUSS_MISTA_REDUCAO_MINIMA 0.5
+#endif
+
+/**
+ * @brief Diagnóstico de @ref gauss_precisao_mista.
+ */
+typedef struct {
+    int    iteracoes;      /**< Passos de refinamento em double executados. */
+    double erroRetroativo; /**< ||b - Ax||∞ / (||A||∞ ||x||∞ + ||b||∞) da solução devolvida. */
+    int    recorreuDupla;  /**< 1 se o refinamento não convergiu e x veio da eliminação em double. */
+} GaussPrecisaoMistaInfo;
+
+/**
+ * @brief Resolve Ax = b em **precisão mista**: fatoração PA = LU em float e
+ *        refinamento iterativo em double.
+ *
+ * O trabalho O(n³) (eliminação em blocos com pivotamento parcial) é feito em
+ * precisão simples, movendo metade dos bytes; cada passo de refinamento custa
+ * O(n²): r = b - Ax em double, LU d = Pr com os fatores em float, x += d. Os
+ * passos param quando o erro retroativo normado chega a sqrt(n)·ε_double.
+ *
+ * Se A não couber em float, se a fatoração simples encontrar pivô < @p tolerancia,
+ * ou se o refinamento estacionar (A mal condicionada demais para float, como a
+ * Hilbert com n ≥ 10), o sistema é resolvido automaticamente por
+ * @ref gauss_blocado_com_tolerancia em double.
+ *
+ * @param matrizEstendida Matriz aumentada [A|b]; **não** é modificada (o recurso usa uma cópia).
+ * @param ordemMatriz     Ordem n da matriz A.
+ * @param vetorSolucao    Saída x (tamanho n).
+ * @param tolerancia      Limite mínimo para o pivô (ex.: 1e-12).
+ * @param info            (opcional) passos, erro retroativo final e se houve recurso; NULL ignora.
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se também a eliminação em double falhar.
+ */
+GaussStatus gauss_precisao_mista(double** matrizEstendida, int ordemMatriz,
+                                 double* vetorSolucao, double tolerancia,
+                                 GaussPrecisaoMistaInfo* info);
+
+/**
+ * @brief Eliminação de Gauss com pivotamento parcial sobre [A|B], com @p numLados
+ *        lados direitos, **sem tolerância**.
+ *
+ * Todas as k colunas de B são eliminadas junto com A em uma única passada
+ * (algoritmo em blocos de @ref eliminacao_blocada): o custo é n³ + k·n² em vez
+ * de k·n³ para k sistemas separados.
+ *
+ * @param matrizEstendida Matriz [A|B] com n linhas e n + @p numLados colunas,
+ *                        modificada in-place para [U|C] (multiplicadores abaixo da diagonal).
+ * @param ordemMatriz     Ordem n da matriz A.
+ * @param numLados        Número k de lados direitos (k >= 1).
+ * @return GAUSS_OK (GAUSS_SINGULAR se k < 1 ou falha de alocação).
+ */
+GaussStatus eliminacao_multiplos(double** matrizEstendida, int ordemMatriz, int numLados);
+
+/**
+ * @brief Igual a @ref eliminacao_multiplos, **com tolerância** no pivô.
+ *
+ * @param matrizEstendida Matriz [A|B] (n × (n + k)), modificada in-place.
+ * @param ordemMatriz     Ordem n da matriz A.
+ * @param numLados        Número k de lados direitos (k >= 1).
+ * @param tolerancia      Limite mínimo para o pivô (ex.: 1e-12).
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0.
+ */
+GaussStatus eliminacao_multiplos_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                                int numLados, double tolerancia);
+
+/**
+ * @brief Substituição regressiva simultânea para os k lados direitos de [U|C].
+ *
+ * Resolve U X = C linha a linha, de baixo para cima; cada passo atualiza a
+ * linha inteira de X (as k soluções) com o núcleo vetorizado.
+ *
+ * @param matrizEstendida Matriz [U|C] (n × (n + k)) após a eliminação.
+ * @param ordemMatriz     Ordem n da matriz U.
+ * @param numLados        Número k de lados direitos.
+ * @param matrizSolucao   Saída X (n × k): matrizSolucao[i][r] = x_i do r-ésimo sistema
+ *                        (ex.: criada com criarMatriz(n, k)).
+ * @return GAUSS_OK em sucesso.
+ */
+GaussStatus substituicaoRegressiva_multiplos(double** matrizEstendida, int ordemMatriz,
+                                             int numLados, double** matrizSolucao);
+
+/**
+ * @brief Resolve AX = B (k lados direitos) por Gauss com pivotamento parcial **sem tolerância**.
+ *
+ * Wrapper de @ref eliminacao_multiplos seguido de @ref substituicaoRegressiva_multiplos.
+ *
+ * @param matrizEstendida Matriz [A|B] (n × (n + k)), modificada durante o processo.
+ * @param ordemMatriz     Ordem n da matriz.
+ * @param numLados        Número k de lados direitos.
+ * @param matrizSolucao   Saída X (n × k).
+ * @return GAUSS_OK em sucesso.
+ */
+GaussStatus gauss_multiplos(double** matrizEstendida, int ordemMatriz,
+                            int numLados, double** matrizSolucao);
+
+/**
+ * @brief Resolve AX = B (k lados direitos) por Gauss com pivotamento parcial **com tolerância**.
+ *
+ * @param matrizEstendida Matriz [A|B] (n × (n + k)), modificada durante o processo.
+ * @param ordemMatriz     Ordem n da matriz.
+ * @param numLados        Número k de lados direitos.
+ * @param matrizSolucao   Saída X (n × k).
+ * @param tolerancia      Limite mínimo para o pivô (ex.: 1e-12).
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se pivô ≈ 0.
+ */
+GaussStatus gauss_multiplos_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                           int numLados, double** matrizSolucao,
+                                           double tolerancia);
+
+/**
+ * @brief Define quantas threads a fase de atualização (eliminação das linhas
+ *        abaixo do pivô) pode usar. Só tem efeito se compilado com OpenMP (-fopenmp).
+ *
+ * @param numThreads Número de threads (<= 0 volta ao padrão do OpenMP / OMP_NUM_THREADS).
+ */
+void gaussDefinirThreads(int numThreads);
+
+/**
+ * @brief Define o corte serial: etapas com menos de @p linhasMinimas linhas
+ *        abaixo do pivô rodam em uma única thread.
+ *
+ * @param linhasMinimas Número mínimo de linhas (padrão: GAUSS_CORTE_PARALELO).
+ */
+void gaussDefinirCorteParalelo(int linhasMinimas);
+
+/**
+ * @brief Motores de execução da eliminação em blocos.
+ */
+typedef enum {
+    GAUSS_MOTOR_LACOS = 0,  /**< Laços fork-join (OpenMP) com barreira a cada painel (padrão). */
+    GAUSS_MOTOR_TAREFAS = 1 /**< Grafo de tarefas com roubo de tarefas e lookahead (pthreads). */
+} GaussMotor;
+
+/**
+ * @brief Escolhe o motor usado por @ref eliminacao_blocada, @ref eliminacao_multiplos,
+ *        @ref gauss_fatorar e seus wrappers.
+ *
+ * Com GAUSS_MOTOR_TAREFAS, cada operação do painel (fatoração do painel, solução
+ * triangular de U12 e atualização de cada ladrilho de A22) vira uma tarefa com
+ * dependências de dados, executada por um pool com roubo de tarefas
+ * (agendador.h). O painel seguinte começa assim que sua coluna-bloco é
+ * atualizada, sem esperar o resto da matriz. Os fatores, os pivôs e o status
+ * são os mesmos do motor em laços. Usa @ref gaussDefinirThreads threads (ou
+ * uma por processador) e só entra em ação a partir de
+ * @ref gaussDefinirCorteParalelo linhas; se o pool não puder ser criado, a
+ * eliminação segue pelos laços.
+ *
+ * @param motor Motor desejado.
+ */
+void gaussDefinirMotor(GaussMotor motor);
+
+/**
+ * @brief Motor em uso (ver @ref gaussDefinirMotor).
+ */
+GaussMotor gaussMotor(void);
+
+/**
+ * @brief Escolha das linhas pivô dentro de um painel da eliminação em blocos.
+ */
+typedef enum {
+    GAUSS_PIVO_PARCIAL = 0, /**< Busca do maior |pivô| coluna a coluna em todas as linhas (padrão). */
+    GAUSS_PIVO_TORNEIO = 1  /**< Torneio (CALU): candidatos por bloco de linhas + árvore de redução. */
+} GaussPivoPainel;
+
+/**
+ * @brief Escolhe como os pivôs de cada painel são selecionados em
+ *        @ref eliminacao_blocada, @ref eliminacao_multiplos, @ref gauss_fatorar
+ *        e seus wrappers (nos dois motores).
+ *
+ * No pivotamento parcial, cada coluna do painel faz uma busca (redução) sobre
+ * todas as linhas restantes: são nb sincronizações por painel. No torneio, as
+ * linhas do painel são divididas em blocos de @ref GAUSS_TORNEIO_LINHAS linhas;
+ * cada bloco faz eliminação com pivotamento parcial numa cópia e indica nb
+ * candidatas; os candidatos são confrontados dois a dois (de novo com as
+ * linhas originais) numa árvore até sobrarem nb vencedoras, que vão para o
+ * topo do painel. O painel é então fatorado sem busca. São 1 + log2(blocos)
+ * etapas, cada uma paralela entre os blocos (OpenMP).
+ *
+ * Os fatores deixam de ser os do pivotamento parcial, mas o crescimento dos
+ * elementos fica próximo na prática (Grigori, Demmel e Xiang, 2011). Com
+ * painéis de até GAUSS_TORNEIO_LINHAS linhas há um único bloco e o resultado
+ * é idêntico ao pivotamento parcial.
+ *
+ * @param pivo Estratégia desejada.
+ */
+void gaussDefinirPivoPainel(GaussPivoPainel pivo);
+
+/**
+ * @brief Estratégia de pivotamento do painel em uso (ver @ref gaussDefinirPivoPainel).
+ */
+GaussPivoPainel gaussPivoPainel(void);
+
+/**
+ * @brief Número de threads efetivamente usado na atualização (1 sem OpenMP).
+ */
+int gaussNumThreads(void);
+
 /**
  * @brief Imprime, em texto, o significado do código de status.
  *
@@ -0,0 +1,582 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L  /* fseeko */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include "gauss_ooc.h"
+#include "kernels.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#define OOC_PRAGMA(x) _Pragma(#x)
+#else
+#define OOC_PRAGMA(x)
+#endif
+
+#ifdef _WIN32
+#define OOC_POSICIONAR(arquivo, posicao) _fseeki64((arquivo), (long long)(posicao), SEEK_SET)
+#else
+#define OOC_POSICIONAR(arquivo, posicao) fseeko((arquivo), (off_t)(posicao), SEEK_SET)
+#endif
+
+/* Mesmos ladrilhos e faixas da eliminação em blocos de gauss.c */
+#define MK_LINHAS     KERNEL_MK_LINHAS
+#define MK_COLUNAS    KERNEL_MK_COLUNAS
+#define FAIXA_COLUNAS 256
+#define BLOCO         GAUSS_BLOCO_PADRAO
+
+/* Fatias na memória ao mesmo tempo: a fatorada, a anterior em uso e a pré-carregada */
+#define FATIAS_NA_MEMORIA 3
+
+// ============================================================
+// GEOMETRIA DO ARQUIVO
+//   fatia f = colunas [f·L, min((f+1)·L, n+1)), n linhas contíguas;
+//   a fatia f começa no byte 8·n·f·L.
+// ============================================================
+static int inicioFatia(const GaussOoc* ooc, int fatia) {
+    return fatia * ooc->largura;
+}
+
+static int larguraFatia(const GaussOoc* ooc, int fatia) {
+    int restante = ooc->nColunas - inicioFatia(ooc, fatia);
+    return restante < ooc->largura ? restante : ooc->largura;
+}
+
+/* Colunas-pivô da fatia: [inicio, fimPivos) (a coluna de b não é pivô) */
+static int fimPivosFatia(const GaussOoc* ooc, int fatia) {
+    int fim = inicioFatia(ooc, fatia) + larguraFatia(ooc, fatia);
+    return fim < ooc->ordem ? fim : ooc->ordem;
+}
+
+static long long posicaoFatia(const GaussOoc* ooc, int fatia, int linha) {
+    return ((long long) ooc->ordem * inicioFatia(ooc, fatia) +
+            (long long) linha * larguraFatia(ooc, fatia)) * (long long) sizeof(double);
+}
+
+/* Lê as linhas [linhaIni, linhaFim) da fatia (contíguas no arquivo) */
+static int lerFatia(FILE* arquivo, const GaussOoc* ooc, int fatia, int linhaIni, int linhaFim,
+                    double* destino) {
+    size_t quantidade = (size_t)(linhaFim - linhaIni) * larguraFatia(ooc, fatia);
+    if (OOC_POSICIONAR(arquivo, posicaoFatia(ooc, fatia, linhaIni)) != 0) return 0;
+    return fread(destino, sizeof(double), quantidade, arquivo) == quantidade;
+}
+
+/* Grava a fatia na ordem lógica das linhas (linhas[i] pode estar em qualquer lugar do buffer) */
+static int gravarFatia(GaussOoc* ooc, int fatia, double* const* linhas) {
+    size_t largura = (size_t) larguraFatia(ooc, fatia);
+    if (OOC_POSICIONAR(ooc->arquivo, posicaoFatia(ooc, fatia, 0)) != 0) return 0;
+    for (int linha = 0; linha < ooc->ordem; linha++) {
+        if (fwrite(linhas[linha], sizeof(double), largura, ooc->arquivo) != largura) return 0;
+    }
+    return fflush(ooc->arquivo) == 0; /* visível para o leitor da pré-carga */
+}
+
+// ============================================================
+// FATIAS NA MEMÓRIA E PRÉ-CARGA
+// ============================================================
+typedef struct {
+    double*  dados;  /* n × largura */
+    double** linhas; /* linhas[i] -> linha lógica i (só i >= linhaIni quando parcial) */
+} Fatia;
+
+/* Aponta linhas[linhaIni..n) para o buffer lido com lerFatia(..., linhaIni, n, ...) */
+static void montarLinhas(Fatia* fatia, const GaussOoc* ooc, int indice, int linhaIni) {
+    int largura = larguraFatia(ooc, indice);
+    for (int linha = linhaIni; linha < ooc->ordem; linha++) {
+        fatia->linhas[linha] = fatia->dados + (size_t)(linha - linhaIni) * largura;
+    }
+}
+
+/* Leitura assíncrona de uma fatia pela thread de pré-carga */
+typedef struct {
+    const GaussOoc* ooc;
+    int fatia, linhaIni;
+    double* destino;
+    int ok;
+    int ativa;
+    pthread_t thread;
+} Leitura;
+
+static void* executarLeitura(void* argumento) {
+    Leitura* leitura = (Leitura*) argumento;
+    leitura->ok = lerFatia(leitura->ooc->leitor, leitura->ooc, leitura->fatia,
+                           leitura->linhaIni, leitura->ooc->ordem, leitura->destino);
+    return NULL;
+}
+
+static void iniciarLeitura(Leitura* leitura, const GaussOoc* ooc, int fatia, int linhaIni,
+                           double* destino) {
+    leitura->ooc = ooc;
+    leitura->fatia = fatia;
+    leitura->linhaIni = linhaIni;
+    leitura->destino = destino;
+    leitura->ok = 0;
+    leitura->ativa = pthread_create(&leitura->thread, NULL, executarLeitura, leitura) == 0;
+    if (!leitura->ativa) executarLeitura(leitura); /* sem thread: lê na hora */
+}
+
+static int aguardarLeitura(Leitura* leitura) {
+    if (leitura->ativa) {
+        pthread_join(leitura->thread, NULL);
+        leitura->ativa = 0;
+    }
+    return leitura->ok;
+}
+
+// ============================================================
+// ATUALIZAÇÃO POR UM PAINEL DE PIVÔS [q0, q1)
+//   (b) linhas [q0, q1) de C:  U12 = L11^{-1} A12;
+//   (c) linhas [q1, n) de C:   A22 -= L21 * U12 (micro-kernel).
+// L vem de linhasL (coluna local colL + p para o pivô q0 + p) e pode ser a
+// própria fatia ou uma fatia anterior lida do arquivo. A sequência de
+// operações por elemento é a mesma de eliminacaoBlocadaNucleo.
+// ============================================================
+static void atualizarPorPainel(double* const* linhasL, int colL, double* const* linhasC,
+                               int q0, int q1, int ordem, int colunaIni, int colunaFim,
+                               double* painelU, double* painelL, int numThreads) {
+    int larguraPainel = q1 - q0;
+    if (colunaIni >= colunaFim) return;
+#ifndef _OPENMP
+    (void) numThreads;
+#endif
+
+    // (b) solução triangular (L11 unitária)
+    for (int colunaPivo = q0; colunaPivo < q1; colunaPivo++) {
+        const double* linhaDoPivo = linhasC[colunaPivo];
+        for (int linha = colunaPivo + 1; linha < q1; linha++) {
+            double multiplicador = linhasL[linha][colL + colunaPivo - q0];
+            if (multiplicador == 0.0) continue;
+            kernelAtualizarLinha(linhasC[linha] + colunaIni, linhaDoPivo + colunaIni,
+                                 multiplicador, colunaFim - colunaIni);
+        }
+    }
+
+    // (c) produto em faixas de colunas, grupos de linhas entre as threads
+    int gruposLinhas = (ordem - q1) / MK_LINHAS;
+    int linhasCheias = q1 + gruposLinhas * MK_LINHAS;
+    for (int faixa = colunaIni; faixa < colunaFim; faixa += FAIXA_COLUNAS) {
+        int fimFaixa = faixa + FAIXA_COLUNAS;
+        if (fimFaixa > colunaFim) fimFaixa = colunaFim;
+        int colunasCheias = faixa + ((fimFaixa - faixa) / MK_COLUNAS) * MK_COLUNAS;
+
+        for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS) {
+            double* destino = painelU + (size_t)(coluna - faixa) * larguraPainel;
+            for (int p = 0; p < larguraPainel; p++)
+                for (int j = 0; j < MK_COLUNAS; j++)
+                    destino[p * MK_COLUNAS + j] = linhasC[q0 + p][coluna + j];
+        }
+
+        OOC_PRAGMA(omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1))
+        for (int grupo = 0; grupo < gruposLinhas; grupo++) {
+            int linha = q1 + grupo * MK_LINHAS;
+#ifdef _OPENMP
+            double* meuPainelL = painelL + (size_t)larguraPainel * MK_LINHAS * omp_get_thread_num();
+#else
+            double* meuPainelL = painelL;
+#endif
+            for (int p = 0; p < larguraPainel; p++)
+                for (int i = 0; i < MK_LINHAS; i++)
+                    meuPainelL[p * MK_LINHAS + i] = linhasL[linha + i][colL + p];
+
+            double* linhasBloco[MK_LINHAS];
+            for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS) {
+                for (int i = 0; i < MK_LINHAS; i++) linhasBloco[i] = linhasC[linha + i] + coluna;
+                kernelMicroAtualizacao(linhasBloco, meuPainelL,
+                                       painelU + (size_t)(coluna - faixa) * larguraPainel,
+                                       larguraPainel);
+            }
+            for (int i = 0; i < MK_LINHAS; i++) {
+                for (int p = 0; p < larguraPainel; p++) {
+                    double l = linhasL[linha + i][colL + p];
+                    if (l == 0.0) continue;
+                    kernelAtualizarLinha(linhasC[linha + i] + colunasCheias,
+                                         linhasC[q0 + p] + colunasCheias, l,
+                                         fimFaixa - colunasCheias);
+                }
+            }
+        }
+
+        for (int linha = linhasCheias; linha < ordem; linha++) {
+            for (int p = 0; p < larguraPainel; p++) {
+                double l = linhasL[linha][colL + p];
+                if (l == 0.0) continue;
+                kernelAtualizarLinha(linhasC[linha] + faixa, linhasC[q0 + p] + faixa, l,
+                                     fimFaixa - faixa);
+            }
+        }
+    }
+}
+
+/* Aplica à fatia S tudo o que a fatia anterior T (lida a partir da linha inicioFatia(T)) fez */
+static void aplicarFatiaAnterior(const GaussOoc* ooc, const Fatia* anterior, int indiceAnterior,
+                                 Fatia* atual, int indiceAtual,
+                                 double* painelU, double* painelL, int numThreads) {
+    int t0 = inicioFatia(ooc, indiceAnterior);
+    int fimPivos = fimPivosFatia(ooc, indiceAnterior);
+
+    // trocas de toda a fatia anterior primeiro: as linhas de T já estão nessa ordem
+    for (int coluna = t0; coluna < fimPivos; coluna++) {
+        int linhaPivo = ooc->pivos[coluna];
+        if (linhaPivo == coluna) continue;
+        double* temp = atual->linhas[coluna];
+        atual->linhas[coluna] = atual->linhas[linhaPivo];
+        atual->linhas[linhaPivo] = temp;
+    }
+
+    for (int q0 = t0; q0 < fimPivos; q0 += BLOCO) {
+        int q1 = q0 + BLOCO < fimPivos ? q0 + BLOCO : fimPivos;
+        atualizarPorPainel(anterior->linhas, q0 - t0, atual->linhas, q0, q1, ooc->ordem,
+                           0, larguraFatia(ooc, indiceAtual), painelU, painelL, numThreads);
+    }
+}
+
+/* Fatora a fatia na memória: painéis de BLOCO colunas, pivotamento parcial */
+static GaussStatus fatorarFatia(GaussOoc* ooc, Fatia* fatia, int indice,
+                                int checarTolerancia, double tolerancia,
+                                double* painelU, double* painelL, int numThreads) {
+    double** linhas = fatia->linhas;
+    int s0 = inicioFatia(ooc, indice);
+    int largura = larguraFatia(ooc, indice);
+    int fimPivos = fimPivosFatia(ooc, indice);
+
+    for (int q0 = s0; q0 < fimPivos; q0 += BLOCO) {
+        int q1 = q0 + BLOCO < fimPivos ? q0 + BLOCO : fimPivos;
+
+        for (int colunaPivo = q0; colunaPivo < q1; colunaPivo++) {
+            int local = colunaPivo - s0;
+            double maxAbs = fabs(linhas[colunaPivo][local]);
+            int linhaPivo = colunaPivo;
+            for (int linha = colunaPivo + 1; linha < ooc->ordem; linha++) {
+                double valor = fabs(linhas[linha][local]);
+                if (valor > maxAbs) {
+                    maxAbs = valor;
+                    linhaPivo = linha;
+                }
+            }
+            if (checarTolerancia && maxAbs < tolerancia) {
+                return GAUSS_SINGULAR;
+            }
+
+            ooc->pivos[colunaPivo] = linhaPivo;
+            if (linhaPivo != colunaPivo) {
+                double* temp = linhas[colunaPivo];
+                linhas[colunaPivo] = linhas[linhaPivo];
+                linhas[linhaPivo] = temp;
+            }
+
+            double* linhaDoPivo = linhas[colunaPivo];
+            double pivo = linhaDoPivo[local];
+            for (int linha = colunaPivo + 1; linha < ooc->ordem; linha++) {
+                double* linhaAtual = linhas[linha];
+                double multiplicador = linhaAtual[local] / pivo;
+                linhaAtual[local] = multiplicador;
+                if (multiplicador == 0.0) continue;
+                kernelAtualizarLinha(linhaAtual + local + 1, linhaDoPivo + local + 1,
+                                     multiplicador, q1 - colunaPivo - 1);
+            }
+        }
+
+        atualizarPorPainel(linhas, q0 - s0, linhas, q0, q1, ooc->ordem,
+                           q1 - s0, largura, painelU, painelL, numThreads);
+    }
+    return GAUSS_OK;
+}
+
+/* Índice de uma fatia na memória que não é nenhuma das duas em uso */
+static int fatiaLivre(int ocupada1, int ocupada2) {
+    int indice = 0;
+    while (indice == ocupada1 || indice == ocupada2) indice++;
+    return indice;
+}
+
+/*
+ * Ordem das leituras: S_0 | S_1 | T_0 | S_2 | T_0 T_1 | S_3 | ...
+ * Depois do item (fatia atual s, anterior t; t = -1 é a própria S_s), devolve
+ * o próximo (fatia e primeira linha a ler) ou 0 se acabou.
+ */
+static int proximaLeitura(const GaussOoc* ooc, int atual, int anterior,
+                          int* fatia, int* linhaIni) {
+    if (anterior + 1 < atual) {
+        *fatia = anterior + 1;
+        *linhaIni = inicioFatia(ooc, anterior + 1);
+        return 1;
+    }
+    if (atual + 1 < ooc->numFatias) {
+        *fatia = atual + 1;
+        *linhaIni = 0;
+        return 1;
+    }
+    return 0;
+}
+
+/* Leva as trocas das fatias seguintes às colunas de L já gravadas */
+static int aplicarTrocasPosteriores(GaussOoc* ooc, Fatia* fatias) {
+    Leitura leitura;
+    int ok = 1;
+    int atual = 0;
+    iniciarLeitura(&leitura, ooc, 0, 0, fatias[0].dados);
+    for (int fatia = 0; fatia < ooc->numFatias - 1; fatia++) {
+        if (!aguardarLeitura(&leitura)) return 0;
+        if (fatia + 1 < ooc->numFatias - 1) {
+            iniciarLeitura(&leitura, ooc, fatia + 1, 0, fatias[1 - atual].dados);
+        }
+        montarLinhas(&fatias[atual], ooc, fatia, 0);
+        for (int coluna = fimPivosFatia(ooc, fatia); coluna < ooc->ordem; coluna++) {
+            int linhaPivo = ooc->pivos[coluna];
+            if (linhaPivo == coluna) continue;
+            double* temp = fatias[atual].linhas[coluna];
+            fatias[atual].linhas[coluna] = fatias[atual].linhas[linhaPivo];
+            fatias[atual].linhas[linhaPivo] = temp;
+        }
+        if (!gravarFatia(ooc, fatia, fatias[atual].linhas)) {
+            ok = 0;
+            break;
+        }
+        atual = 1 - atual;
+    }
+    aguardarLeitura(&leitura);
+    return ok;
+}
+
+static GaussStatus eliminacaoOocNucleo(GaussOoc* ooc, int checarTolerancia, double tolerancia) {
+    int ordem = ooc->ordem;
+    int numThreads = gaussNumThreads();
+    int numBuffers = ooc->numFatias < FATIAS_NA_MEMORIA ? ooc->numFatias : FATIAS_NA_MEMORIA;
+    GaussStatus status = GAUSS_OK;
+
+    Fatia fatias[FATIAS_NA_MEMORIA];
+    memset(fatias, 0, sizeof(fatias));
+    int alocou = 1;
+    for (int i = 0; i < numBuffers; i++) {
+        fatias[i].dados = (double*) malloc((size_t)ordem * ooc->largura * sizeof(double));
+        fatias[i].linhas = (double**) malloc((size_t)ordem * sizeof(double*));
+        alocou = alocou && fatias[i].dados && fatias[i].linhas;
+    }
+    double* painelU = (double*) malloc((size_t)BLOCO * FAIXA_COLUNAS * sizeof(double));
+    double* painelL = (double*) malloc((size_t)BLOCO * MK_LINHAS * numThreads * sizeof(double));
+    if (!alocou || !painelU || !painelL) {
+        status = GAUSS_SINGULAR; /* sem enum específico para memória */
+    }
+
+    Leitura leitura;
+    memset(&leitura, 0, sizeof(leitura));
+    int bufferLeitura = 0;
+    if (status == GAUSS_OK) {
+        (void) kernelNivelAtivo(); /* resolve o despacho SIMD antes das threads */
+        iniciarLeitura(&leitura, ooc, 0, 0, fatias[0].dados);
+    }
+
+    for (int atual = 0; atual < ooc->numFatias && status == GAUSS_OK; atual++) {
+        if (!aguardarLeitura(&leitura)) {
+            status = GAUSS_SINGULAR; /* sem enum específico para E/S */
+            break;
+        }
+        int bufferAtual = bufferLeitura;
+        montarLinhas(&fatias[bufferAtual], ooc, atual, 0);
+
+        // (1) left-looking: fatias anteriores, lidas enquanto a anterior é aplicada
+        for (int anterior = -1; anterior < atual; anterior++) {
+            int bufferAnterior = -1;
+            if (anterior >= 0) {
+                if (!aguardarLeitura(&leitura)) {
+                    status = GAUSS_SINGULAR; /* sem enum específico para E/S */
+                    break;
+                }
+                bufferAnterior = bufferLeitura;
+                montarLinhas(&fatias[bufferAnterior], ooc, anterior, inicioFatia(ooc, anterior));
+            }
+
+            int fatia, linhaIni;
+            if (proximaLeitura(ooc, atual, anterior, &fatia, &linhaIni)) {
+                bufferLeitura = fatiaLivre(bufferAtual, bufferAnterior);
+                iniciarLeitura(&leitura, ooc, fatia, linhaIni, fatias[bufferLeitura].dados);
+            }
+
+            if (anterior >= 0) {
+                aplicarFatiaAnterior(ooc, &fatias[bufferAnterior], anterior,
+                                     &fatias[bufferAtual], atual, painelU, painelL, numThreads);
+            }
+        }
+        if (status != GAUSS_OK) break;
+
+        // (2) a própria fatia, na memória, e de volta ao arquivo
+        status = fatorarFatia(ooc, &fatias[bufferAtual], atual, checarTolerancia, tolerancia,
+                              painelU, painelL, numThreads);
+        if (status == GAUSS_OK && !gravarFatia(ooc, atual, fatias[bufferAtual].linhas)) {
+            status = GAUSS_SINGULAR; /* sem enum específico para E/S */
+        }
+    }
+    aguardarLeitura(&leitura);
+
+    // (3) multiplicadores com as trocas posteriores, como na versão na memória
+    if (status == GAUSS_OK && ooc->numFatias > 1 && !aplicarTrocasPosteriores(ooc, fatias)) {
+        status = GAUSS_SINGULAR; /* sem enum específico para E/S */
+    }
+
+    /* o pivô final já passou pela mesma regra em fatorarFatia (coluna n - 1) */
+
+    for (int i = 0; i < numBuffers; i++) {
+        free(fatias[i].dados);
+        free(fatias[i].linhas);
+    }
+    free(painelU);
+    free(painelL);
+    return status;
+}
+
+// ============================================================
+// API PÚBLICA
+// ============================================================
+int gauss_ooc_criar(GaussOoc* ooc, const char* caminho, int ordemMatriz, size_t orcamentoBytes) {
+    memset(ooc, 0, sizeof(*ooc));
+    if (ordemMatriz < 1) return 0;
+
+    size_t n = (size_t) ordemMatriz;
+    size_t nColunas = n + 1;
+    int numThreads = gaussNumThreads();
+    size_t fixo = FATIAS_NA_MEMORIA * n * sizeof(double*) + n * sizeof(int) +
+                  (size_t)BLOCO * (FAIXA_COLUNAS + (size_t)MK_LINHAS * numThreads) * sizeof(double);
+    if (orcamentoBytes <= fixo) return 0;
+
+    size_t largura = (orcamentoBytes - fixo) / (FATIAS_NA_MEMORIA * n * sizeof(double));
+    if (largura >= nColunas) largura = nColunas;
+    else if (largura >= MK_COLUNAS) largura -= largura % MK_COLUNAS;
+    if (largura < 1) return 0;
+
+    ooc->ordem = ordemMatriz;
+    ooc->nColunas = (int) nColunas;
+    ooc->largura = (int) largura;
+    ooc->numFatias = (int)((nColunas + largura - 1) / largura);
+    ooc->orcamento = orcamentoBytes;
+    ooc->pivos = (int*) malloc(n * sizeof(int));
+    ooc->caminho = (char*) malloc(strlen(caminho) + 1);
+    if (!ooc->pivos || !ooc->caminho) {
+        gauss_ooc_fechar(ooc, 0);
+        return 0;
+    }
+    strcpy(ooc->caminho, caminho);
+    for (int i = 0; i < ordemMatriz; i++) ooc->pivos[i] = i;
+
+    // arquivo com o tamanho final (esparso onde o sistema de arquivos permitir)
+    ooc->arquivo = fopen(caminho, "w+b");
+    double zero = 0.0;
+    long long ultimo = (long long)(n * nColunas - 1) * (long long) sizeof(double);
+    if (!ooc->arquivo || OOC_POSICIONAR(ooc->arquivo, ultimo) != 0 ||
+        fwrite(&zero, sizeof(double), 1, ooc->arquivo) != 1 || fflush(ooc->arquivo) != 0) {
+        gauss_ooc_fechar(ooc, 1);
+        return 0;
+    }
+    ooc->leitor = fopen(caminho, "rb");
+    if (!ooc->leitor) {
+        gauss_ooc_fechar(ooc, 1);
+        return 0;
+    }
+    // sem buffer: o leitor relê regiões que gravarFatia acabou de reescrever
+    // pelo outro FILE*, e um buffer guardaria os valores antigos
+    setvbuf(ooc->leitor, NULL, _IONBF, 0);
+    return 1;
+}
+
+int gauss_ooc_definirLinha(GaussOoc* ooc, int linha, const double* valores) {
+    for (int fatia = 0; fatia < ooc->numFatias; fatia++) {
+        size_t largura = (size_t) larguraFatia(ooc, fatia);
+        if (OOC_POSICIONAR(ooc->arquivo, posicaoFatia(ooc, fatia, linha)) != 0 ||
+            fwrite(valores + inicioFatia(ooc, fatia), sizeof(double), largura, ooc->arquivo) != largura) {
+            return 0;
+        }
+    }
+    return fflush(ooc->arquivo) == 0;
+}
+
+int gauss_ooc_obterLinha(const GaussOoc* ooc, int linha, double* valores) {
+    for (int fatia = 0; fatia < ooc->numFatias; fatia++) {
+        if (!lerFatia(ooc->arquivo, ooc, fatia, linha, linha + 1, valores + inicioFatia(ooc, fatia))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+GaussStatus gauss_ooc_eliminacao_com_tolerancia(GaussOoc* ooc, double tolerancia) {
+    return eliminacaoOocNucleo(ooc, 1, tolerancia);
+}
+
+GaussStatus gauss_ooc_eliminacao(GaussOoc* ooc) {
+    return eliminacaoOocNucleo(ooc, 0, 0.0);
+}
+
+/*
+ * Regressiva por blocos de linhas, da última fatia para a primeira: as
+ * linhas [s0, s1) de U vêm de todas as fatias a partir de s e são montadas
+ * num bloco contíguo, e cada x_i é calculado como em substituicaoRegressiva
+ * (soma em ordem crescente de coluna).
+ */
+GaussStatus gauss_ooc_substituicaoRegressiva(GaussOoc* ooc, double* vetorSolucao) {
+    int ordem = ooc->ordem;
+    size_t largura = (size_t) ooc->largura;
+    double* bloco = (double*) malloc(largura * ooc->nColunas * sizeof(double));
+    double* pedaco = (double*) malloc(largura * largura * sizeof(double));
+    GaussStatus status = (bloco && pedaco) ? GAUSS_OK : GAUSS_SINGULAR;
+
+    for (int atual = ooc->numFatias - 1; atual >= 0 && status == GAUSS_OK; atual--) {
+        int s0 = inicioFatia(ooc, atual);
+        int s1 = fimPivosFatia(ooc, atual);
+        if (s0 >= ordem) continue; /* fatia só com a coluna de b */
+        int larguraBloco = ooc->nColunas - s0;
+
+        for (int fatia = atual; fatia < ooc->numFatias; fatia++) {
+            int larguraPedaco = larguraFatia(ooc, fatia);
+            int deslocamento = inicioFatia(ooc, fatia) - s0;
+            if (!lerFatia(ooc->arquivo, ooc, fatia, s0, s1, pedaco)) {
+                status = GAUSS_SINGULAR; /* sem enum específico para E/S */
+                break;
+            }
+            for (int linha = s0; linha < s1; linha++) {
+                memcpy(bloco + (size_t)(linha - s0) * larguraBloco + deslocamento,
+                       pedaco + (size_t)(linha - s0) * larguraPedaco,
+                       (size_t) larguraPedaco * sizeof(double));
+            }
+        }
+        if (status != GAUSS_OK) break;
+
+        for (int linha = s1 - 1; linha >= s0; linha--) {
+            const double* linhaU = bloco + (size_t)(linha - s0) * larguraBloco - s0;
+            double soma = 0.0;
+            for (int coluna = linha + 1; coluna < ordem; coluna++) {
+                soma += linhaU[coluna] * vetorSolucao[coluna];
+            }
+
+            vetorSolucao[linha] = (linhaU[ordem] - soma) / linhaU[linha];
+        }
+    }
+
+    free(bloco);
+    free(pedaco);
+    return status;
+}
+
+GaussStatus gauss_ooc_com_tolerancia(GaussOoc* ooc, double* vetorSolucao, double tolerancia) {
+    GaussStatus status = gauss_ooc_eliminacao_com_tolerancia(ooc, tolerancia);
+    if (status != GAUSS_OK) return status;
+    return gauss_ooc_substituicaoRegressiva(ooc, vetorSolucao);
+}
+
+GaussStatus gauss_ooc(GaussOoc* ooc, double* vetorSolucao) {
+    GaussStatus status = gauss_ooc_eliminacao(ooc);
+    if (status != GAUSS_OK) return status;
+    return gauss_ooc_substituicaoRegressiva(ooc, vetorSolucao);
+}
+
+void gauss_ooc_fechar(GaussOoc* ooc, int apagarArquivo) {
+    if (!ooc) return;
+    if (ooc->arquivo) fclose(ooc->arquivo);
+    if (ooc->leitor) fclose(ooc->leitor);
+    if (apagarArquivo && ooc->caminho) remove(ooc->caminho);
+    free(ooc->caminho);
+    free(ooc->pivos);
+    memset(ooc, 0, sizeof(*ooc));
+}
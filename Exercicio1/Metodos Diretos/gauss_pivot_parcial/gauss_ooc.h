@@ -0,0 +1,125 @@
+#ifndef GAUSS_OOC_H
+#define GAUSS_OOC_H
+
+/**
+ * @file gauss_ooc.h
+ * @brief Eliminação de Gauss com pivotamento parcial *out-of-core*: [A|b]
+ *        fica num arquivo e só uma parte limitada dele fica na memória.
+ *
+ * O arquivo guarda [A|b] em **fatias** de colunas: a fatia f tem as colunas
+ * [f·L, (f+1)·L) de todas as n linhas, contíguas e por linhas (n × L). A
+ * largura L é a maior que cabe no orçamento de memória com três fatias na
+ * memória ao mesmo tempo.
+ *
+ * A fatoração é *left-looking* por fatias: para cada fatia f, as fatias
+ * anteriores são lidas do arquivo uma a uma (trocas de linha, solução
+ * triangular e atualização com o micro-kernel de kernels.h), a fatia é
+ * fatorada na memória em painéis de GAUSS_BLOCO_PADRAO colunas e gravada de
+ * volta. Uma thread lê a próxima fatia enquanto a atual é usada (pré-carga).
+ *
+ * O resultado segue a semântica de @ref eliminacao_blocada_com_tolerancia:
+ * U e c no triângulo superior e na coluna n, multiplicadores de L abaixo da
+ * diagonal (com as trocas posteriores aplicadas) e o mesmo critério de
+ * tolerância. Cada elemento recebe as mesmas operações, na mesma ordem, que
+ * na versão na memória, então os fatores e a solução são os mesmos.
+ */
+
+#include <stdio.h>
+#include <stddef.h>
+#include "gauss.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sistema [A|b] guardado em arquivo, em fatias de colunas.
+ */
+typedef struct {
+    FILE*  arquivo;    /**< Leitura e escrita pela thread principal. */
+    FILE*  leitor;     /**< Leitura pela thread de pré-carga. */
+    char*  caminho;    /**< Caminho do arquivo (cópia). */
+    int    ordem;      /**< Ordem n de A. */
+    int    nColunas;   /**< n + 1 colunas de [A|b]. */
+    int    largura;    /**< Colunas por fatia (a última pode ser mais estreita). */
+    int    numFatias;  /**< ceil(nColunas / largura). */
+    int*   pivos;      /**< pivos[c]: linha trocada com a linha c na coluna c (após a eliminação). */
+    size_t orcamento;  /**< Orçamento de memória informado, em bytes. */
+} GaussOoc;
+
+/**
+ * @brief Cria (ou sobrescreve) o arquivo de um sistema de ordem @p ordemMatriz.
+ *
+ * O conteúdo começa zerado; preencha-o com @ref gauss_ooc_definirLinha.
+ * A largura das fatias é escolhida para que a eliminação e a substituição
+ * usem no máximo cerca de @p orcamentoBytes de memória (três fatias, seus
+ * vetores de linhas e as áreas de empacotamento).
+ *
+ * @param ooc            Estrutura a preencher.
+ * @param caminho        Arquivo de trabalho (n·(n+1)·8 bytes).
+ * @param ordemMatriz    Ordem n de A.
+ * @param orcamentoBytes Memória máxima, em bytes.
+ * @return 1 em sucesso; 0 se o arquivo não puder ser criado, faltar memória
+ *         ou o orçamento não comportar nem uma coluna por fatia.
+ */
+int gauss_ooc_criar(GaussOoc* ooc, const char* caminho, int ordemMatriz, size_t orcamentoBytes);
+
+/**
+ * @brief Grava a linha @p linha de [A|b] (n + 1 valores).
+ * @return 1 em sucesso; 0 em erro de E/S.
+ */
+int gauss_ooc_definirLinha(GaussOoc* ooc, int linha, const double* valores);
+
+/**
+ * @brief Lê a linha @p linha de [A|b] (ou de [L\\U|c], após a eliminação) para @p valores.
+ * @return 1 em sucesso; 0 em erro de E/S.
+ */
+int gauss_ooc_obterLinha(const GaussOoc* ooc, int linha, double* valores);
+
+/**
+ * @brief Eliminação com pivotamento parcial, **com tolerância**, sobre o arquivo.
+ *
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR se |pivô| < @p tolerancia, ou
+ *         em falha de memória ou de E/S (o arquivo fica num estado intermediário).
+ */
+GaussStatus gauss_ooc_eliminacao_com_tolerancia(GaussOoc* ooc, double tolerancia);
+
+/**
+ * @brief Eliminação com pivotamento parcial, **sem tolerância**, sobre o arquivo.
+ *
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR em falha de memória ou de E/S.
+ */
+GaussStatus gauss_ooc_eliminacao(GaussOoc* ooc);
+
+/**
+ * @brief Substituição regressiva sobre [U|c] já eliminado (mesma ordem das
+ *        operações de @ref substituicaoRegressiva).
+ *
+ * @param ooc          Sistema eliminado.
+ * @param vetorSolucao Saída x (tamanho n).
+ * @return GAUSS_OK em sucesso; GAUSS_SINGULAR em falha de memória ou de E/S.
+ */
+GaussStatus gauss_ooc_substituicaoRegressiva(GaussOoc* ooc, double* vetorSolucao);
+
+/**
+ * @brief Eliminação com tolerância seguida de substituição regressiva.
+ */
+GaussStatus gauss_ooc_com_tolerancia(GaussOoc* ooc, double* vetorSolucao, double tolerancia);
+
+/**
+ * @brief Eliminação sem tolerância seguida de substituição regressiva.
+ */
+GaussStatus gauss_ooc(GaussOoc* ooc, double* vetorSolucao);
+
+/**
+ * @brief Fecha o arquivo e libera a estrutura.
+ *
+ * @param apagarArquivo Se não-zero, remove o arquivo de trabalho.
+ */
+void gauss_ooc_fechar(GaussOoc* ooc, int apagarArquivo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GAUSS_OOC_H */
@@ -0,0 +1,643 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdatomic.h>
+#include "kernels.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*FuncaoAtualizarLinha)(double*, const double*, double, int);
+typedef void (*FuncaoMicroAtualizacao)(double* const*, const double*, const double*, int);
+typedef int (*FuncaoArgMaxAbs)(const double*, const uint64_t*, int, double*);
+typedef void (*FuncaoAtualizarLinhaF)(float*, const float*, float, int);
+typedef void (*FuncaoMicroAtualizacaoF)(float* const*, const float*, const float*, int);
+
+/* Conjunto de implementações de um nível: publicado de uma vez só */
+typedef struct {
+    KernelNivel              nivel;
+    FuncaoAtualizarLinha     atualizarLinha;
+    FuncaoMicroAtualizacao   microAtualizacao;
+    FuncaoArgMaxAbs          argMaxAbs;
+    FuncaoAtualizarLinhaF    atualizarLinhaF;
+    FuncaoMicroAtualizacaoF  microAtualizacaoF;
+} TabelaKernels;
+
+/* Tabela ativa (NULL até a inicialização); trocada só por um store atômico */
+static _Atomic(const TabelaKernels*) g_tabela = NULL;
+
+// ============================================================
+// ESCALAR (referência / reprodutível)
+// ============================================================
+static void atualizarLinhaEscalar(double* linha, const double* linhaPivo,
+                                  double multiplicador, int tamanho) {
+    for (int j = 0; j < tamanho; j++) {
+        linha[j] -= multiplicador * linhaPivo[j];
+    }
+}
+
+static void microAtualizacaoEscalar(double* const* linhasC, const double* painelL,
+                                    const double* painelU, int larguraPainel) {
+    double acumulado[KERNEL_MK_LINHAS][KERNEL_MK_COLUNAS];
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < KERNEL_MK_COLUNAS; j++)
+            acumulado[i][j] = linhasC[i][j];
+
+    for (int p = 0; p < larguraPainel; p++) {
+        const double* u = painelU + (size_t)p * KERNEL_MK_COLUNAS;
+        const double* l = painelL + (size_t)p * KERNEL_MK_LINHAS;
+        for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+            for (int j = 0; j < KERNEL_MK_COLUNAS; j++)
+                acumulado[i][j] -= l[i] * u[j];
+    }
+
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < KERNEL_MK_COLUNAS; j++)
+            linhasC[i][j] = acumulado[i][j];
+}
+
+static void atualizarLinhaFEscalar(float* linha, const float* linhaPivo,
+                                   float multiplicador, int tamanho) {
+    for (int j = 0; j < tamanho; j++) {
+        linha[j] -= multiplicador * linhaPivo[j];
+    }
+}
+
+static void microAtualizacaoFEscalar(float* const* linhasC, const float* painelL,
+                                     const float* painelU, int larguraPainel) {
+    float acumulado[KERNEL_MK_LINHAS][KERNEL_MK_COLUNAS_F];
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < KERNEL_MK_COLUNAS_F; j++)
+            acumulado[i][j] = linhasC[i][j];
+
+    for (int p = 0; p < larguraPainel; p++) {
+        const float* u = painelU + (size_t)p * KERNEL_MK_COLUNAS_F;
+        const float* l = painelL + (size_t)p * KERNEL_MK_LINHAS;
+        for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+            for (int j = 0; j < KERNEL_MK_COLUNAS_F; j++)
+                acumulado[i][j] -= l[i] * u[j];
+    }
+
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < KERNEL_MK_COLUNAS_F; j++)
+            linhasC[i][j] = acumulado[i][j];
+}
+
+/* Bits de |v| com a máscara aplicada (0 para elementos inativos) */
+static double absMascarado(double valor, const uint64_t* mascara, int j) {
+    double absoluto = fabs(valor);
+    if (!mascara) return absoluto;
+    uint64_t bits;
+    memcpy(&bits, &absoluto, sizeof bits);
+    bits &= mascara[j];
+    memcpy(&absoluto, &bits, sizeof bits);
+    return absoluto;
+}
+
+static int argMaxAbsEscalar(const double* valores, const uint64_t* mascara,
+                            int tamanho, double* valorMax) {
+    int indice = -1;
+    double maximo = 0.0;
+    for (int j = 0; j < tamanho; j++) {
+        double absoluto = absMascarado(valores[j], mascara, j);
+        if (absoluto > maximo) {
+            maximo = absoluto;
+            indice = j;
+        }
+    }
+    *valorMax = maximo;
+    return indice;
+}
+
+/* Junta o resultado das pistas SIMD (menor índice entre os máximos) com a cauda escalar */
+static int combinarPistas(const double* maximos, const double* indices, int pistas,
+                          const double* valores, const uint64_t* mascara,
+                          int inicioCauda, int tamanho, double* valorMax) {
+    int indice = -1;
+    double maximo = 0.0;
+    for (int pista = 0; pista < pistas; pista++) {
+        if (indices[pista] < 0.0) continue;
+        if (maximos[pista] > maximo ||
+            (maximos[pista] == maximo && indice >= 0 && (int) indices[pista] < indice)) {
+            maximo = maximos[pista];
+            indice = (int) indices[pista];
+        }
+    }
+    for (int j = inicioCauda; j < tamanho; j++) {
+        double absoluto = absMascarado(valores[j], mascara, j);
+        if (absoluto > maximo) {
+            maximo = absoluto;
+            indice = j;
+        }
+    }
+    *valorMax = maximo;
+    return indice;
+}
+
+#ifdef KERNELS_X86
+// ============================================================
+// SSE2 — 2 doubles por instrução (sem FMA)
+// ============================================================
+__attribute__((target("sse2")))
+static void atualizarLinhaSSE2(double* linha, const double* linhaPivo,
+                               double multiplicador, int tamanho) {
+    __m128d m = _mm_set1_pd(multiplicador);
+    int j = 0;
+    for (; j + 4 <= tamanho; j += 4) {
+        __m128d a0 = _mm_loadu_pd(linha + j);
+        __m128d a1 = _mm_loadu_pd(linha + j + 2);
+        a0 = _mm_sub_pd(a0, _mm_mul_pd(m, _mm_loadu_pd(linhaPivo + j)));
+        a1 = _mm_sub_pd(a1, _mm_mul_pd(m, _mm_loadu_pd(linhaPivo + j + 2)));
+        _mm_storeu_pd(linha + j, a0);
+        _mm_storeu_pd(linha + j + 2, a1);
+    }
+    for (; j < tamanho; j++) {
+        linha[j] -= multiplicador * linhaPivo[j];
+    }
+}
+
+// ============================================================
+// AVX2 + FMA — 4 doubles por instrução, 2 acumuladores
+// ============================================================
+__attribute__((target("avx2,fma")))
+static void atualizarLinhaAVX2(double* linha, const double* linhaPivo,
+                               double multiplicador, int tamanho) {
+    __m256d m = _mm256_set1_pd(multiplicador);
+    int j = 0;
+    for (; j + 8 <= tamanho; j += 8) {
+        __m256d a0 = _mm256_loadu_pd(linha + j);
+        __m256d a1 = _mm256_loadu_pd(linha + j + 4);
+        a0 = _mm256_fnmadd_pd(m, _mm256_loadu_pd(linhaPivo + j), a0);
+        a1 = _mm256_fnmadd_pd(m, _mm256_loadu_pd(linhaPivo + j + 4), a1);
+        _mm256_storeu_pd(linha + j, a0);
+        _mm256_storeu_pd(linha + j + 4, a1);
+    }
+    for (; j + 4 <= tamanho; j += 4) {
+        __m256d a = _mm256_loadu_pd(linha + j);
+        a = _mm256_fnmadd_pd(m, _mm256_loadu_pd(linhaPivo + j), a);
+        _mm256_storeu_pd(linha + j, a);
+    }
+    for (; j < tamanho; j++) {
+        linha[j] = __builtin_fma(-multiplicador, linhaPivo[j], linha[j]);
+    }
+}
+
+// ============================================================
+// AVX-512F — 8 doubles por instrução, cauda com máscara
+// ============================================================
+__attribute__((target("avx512f")))
+static void atualizarLinhaAVX512(double* linha, const double* linhaPivo,
+                                 double multiplicador, int tamanho) {
+    __m512d m = _mm512_set1_pd(multiplicador);
+    int j = 0;
+    for (; j + 16 <= tamanho; j += 16) {
+        __m512d a0 = _mm512_loadu_pd(linha + j);
+        __m512d a1 = _mm512_loadu_pd(linha + j + 8);
+        a0 = _mm512_fnmadd_pd(m, _mm512_loadu_pd(linhaPivo + j), a0);
+        a1 = _mm512_fnmadd_pd(m, _mm512_loadu_pd(linhaPivo + j + 8), a1);
+        _mm512_storeu_pd(linha + j, a0);
+        _mm512_storeu_pd(linha + j + 8, a1);
+    }
+    for (; j < tamanho; j += 8) {
+        int restante = tamanho - j;
+        __mmask8 mascara = (restante >= 8) ? (__mmask8) 0xFF
+                                           : (__mmask8) ((1u << restante) - 1u);
+        __m512d a = _mm512_maskz_loadu_pd(mascara, linha + j);
+        __m512d p = _mm512_maskz_loadu_pd(mascara, linhaPivo + j);
+        _mm512_mask_storeu_pd(linha + j, mascara, _mm512_fnmadd_pd(m, p, a));
+    }
+}
+
+// ============================================================
+// Micro-kernels 4x8 (ladrilho inteiro em registradores)
+// ============================================================
+__attribute__((target("sse2")))
+static void microAtualizacaoSSE2(double* const* linhasC, const double* painelL,
+                                 const double* painelU, int larguraPainel) {
+    __m128d c[KERNEL_MK_LINHAS][4];
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < 4; j++)
+            c[i][j] = _mm_loadu_pd(linhasC[i] + 2 * j);
+
+    for (int p = 0; p < larguraPainel; p++) {
+        const double* u = painelU + (size_t)p * KERNEL_MK_COLUNAS;
+        __m128d u0 = _mm_loadu_pd(u),     u1 = _mm_loadu_pd(u + 2);
+        __m128d u2 = _mm_loadu_pd(u + 4), u3 = _mm_loadu_pd(u + 6);
+        for (int i = 0; i < KERNEL_MK_LINHAS; i++) {
+            __m128d l = _mm_set1_pd(painelL[(size_t)p * KERNEL_MK_LINHAS + i]);
+            c[i][0] = _mm_sub_pd(c[i][0], _mm_mul_pd(l, u0));
+            c[i][1] = _mm_sub_pd(c[i][1], _mm_mul_pd(l, u1));
+            c[i][2] = _mm_sub_pd(c[i][2], _mm_mul_pd(l, u2));
+            c[i][3] = _mm_sub_pd(c[i][3], _mm_mul_pd(l, u3));
+        }
+    }
+
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < 4; j++)
+            _mm_storeu_pd(linhasC[i] + 2 * j, c[i][j]);
+}
+
+__attribute__((target("avx2,fma")))
+static void microAtualizacaoAVX2(double* const* linhasC, const double* painelL,
+                                 const double* painelU, int larguraPainel) {
+    __m256d c00 = _mm256_loadu_pd(linhasC[0]), c01 = _mm256_loadu_pd(linhasC[0] + 4);
+    __m256d c10 = _mm256_loadu_pd(linhasC[1]), c11 = _mm256_loadu_pd(linhasC[1] + 4);
+    __m256d c20 = _mm256_loadu_pd(linhasC[2]), c21 = _mm256_loadu_pd(linhasC[2] + 4);
+    __m256d c30 = _mm256_loadu_pd(linhasC[3]), c31 = _mm256_loadu_pd(linhasC[3] + 4);
+
+    for (int p = 0; p < larguraPainel; p++) {
+        const double* u = painelU + (size_t)p * KERNEL_MK_COLUNAS;
+        const double* l = painelL + (size_t)p * KERNEL_MK_LINHAS;
+        __m256d u0 = _mm256_loadu_pd(u), u1 = _mm256_loadu_pd(u + 4);
+        __m256d l0 = _mm256_broadcast_sd(l),     l1 = _mm256_broadcast_sd(l + 1);
+        __m256d l2 = _mm256_broadcast_sd(l + 2), l3 = _mm256_broadcast_sd(l + 3);
+        c00 = _mm256_fnmadd_pd(l0, u0, c00); c01 = _mm256_fnmadd_pd(l0, u1, c01);
+        c10 = _mm256_fnmadd_pd(l1, u0, c10); c11 = _mm256_fnmadd_pd(l1, u1, c11);
+        c20 = _mm256_fnmadd_pd(l2, u0, c20); c21 = _mm256_fnmadd_pd(l2, u1, c21);
+        c30 = _mm256_fnmadd_pd(l3, u0, c30); c31 = _mm256_fnmadd_pd(l3, u1, c31);
+    }
+
+    _mm256_storeu_pd(linhasC[0], c00); _mm256_storeu_pd(linhasC[0] + 4, c01);
+    _mm256_storeu_pd(linhasC[1], c10); _mm256_storeu_pd(linhasC[1] + 4, c11);
+    _mm256_storeu_pd(linhasC[2], c20); _mm256_storeu_pd(linhasC[2] + 4, c21);
+    _mm256_storeu_pd(linhasC[3], c30); _mm256_storeu_pd(linhasC[3] + 4, c31);
+}
+
+__attribute__((target("avx512f")))
+static void microAtualizacaoAVX512(double* const* linhasC, const double* painelL,
+                                   const double* painelU, int larguraPainel) {
+    __m512d c0 = _mm512_loadu_pd(linhasC[0]);
+    __m512d c1 = _mm512_loadu_pd(linhasC[1]);
+    __m512d c2 = _mm512_loadu_pd(linhasC[2]);
+    __m512d c3 = _mm512_loadu_pd(linhasC[3]);
+
+    for (int p = 0; p < larguraPainel; p++) {
+        __m512d u = _mm512_loadu_pd(painelU + (size_t)p * KERNEL_MK_COLUNAS);
+        const double* l = painelL + (size_t)p * KERNEL_MK_LINHAS;
+        c0 = _mm512_fnmadd_pd(_mm512_set1_pd(l[0]), u, c0);
+        c1 = _mm512_fnmadd_pd(_mm512_set1_pd(l[1]), u, c1);
+        c2 = _mm512_fnmadd_pd(_mm512_set1_pd(l[2]), u, c2);
+        c3 = _mm512_fnmadd_pd(_mm512_set1_pd(l[3]), u, c3);
+    }
+
+    _mm512_storeu_pd(linhasC[0], c0);
+    _mm512_storeu_pd(linhasC[1], c1);
+    _mm512_storeu_pd(linhasC[2], c2);
+    _mm512_storeu_pd(linhasC[3], c3);
+}
+
+// ============================================================
+// Precisão simples (fatoração em precisão mista)
+// ============================================================
+__attribute__((target("sse2")))
+static void atualizarLinhaFSSE2(float* linha, const float* linhaPivo,
+                                float multiplicador, int tamanho) {
+    __m128 m = _mm_set1_ps(multiplicador);
+    int j = 0;
+    for (; j + 8 <= tamanho; j += 8) {
+        __m128 a0 = _mm_loadu_ps(linha + j);
+        __m128 a1 = _mm_loadu_ps(linha + j + 4);
+        a0 = _mm_sub_ps(a0, _mm_mul_ps(m, _mm_loadu_ps(linhaPivo + j)));
+        a1 = _mm_sub_ps(a1, _mm_mul_ps(m, _mm_loadu_ps(linhaPivo + j + 4)));
+        _mm_storeu_ps(linha + j, a0);
+        _mm_storeu_ps(linha + j + 4, a1);
+    }
+    for (; j < tamanho; j++) {
+        linha[j] -= multiplicador * linhaPivo[j];
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void atualizarLinhaFAVX2(float* linha, const float* linhaPivo,
+                                float multiplicador, int tamanho) {
+    __m256 m = _mm256_set1_ps(multiplicador);
+    int j = 0;
+    for (; j + 16 <= tamanho; j += 16) {
+        __m256 a0 = _mm256_loadu_ps(linha + j);
+        __m256 a1 = _mm256_loadu_ps(linha + j + 8);
+        a0 = _mm256_fnmadd_ps(m, _mm256_loadu_ps(linhaPivo + j), a0);
+        a1 = _mm256_fnmadd_ps(m, _mm256_loadu_ps(linhaPivo + j + 8), a1);
+        _mm256_storeu_ps(linha + j, a0);
+        _mm256_storeu_ps(linha + j + 8, a1);
+    }
+    for (; j + 8 <= tamanho; j += 8) {
+        __m256 a = _mm256_loadu_ps(linha + j);
+        a = _mm256_fnmadd_ps(m, _mm256_loadu_ps(linhaPivo + j), a);
+        _mm256_storeu_ps(linha + j, a);
+    }
+    for (; j < tamanho; j++) {
+        linha[j] = __builtin_fmaf(-multiplicador, linhaPivo[j], linha[j]);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void atualizarLinhaFAVX512(float* linha, const float* linhaPivo,
+                                  float multiplicador, int tamanho) {
+    __m512 m = _mm512_set1_ps(multiplicador);
+    int j = 0;
+    for (; j + 32 <= tamanho; j += 32) {
+        __m512 a0 = _mm512_loadu_ps(linha + j);
+        __m512 a1 = _mm512_loadu_ps(linha + j + 16);
+        a0 = _mm512_fnmadd_ps(m, _mm512_loadu_ps(linhaPivo + j), a0);
+        a1 = _mm512_fnmadd_ps(m, _mm512_loadu_ps(linhaPivo + j + 16), a1);
+        _mm512_storeu_ps(linha + j, a0);
+        _mm512_storeu_ps(linha + j + 16, a1);
+    }
+    for (; j < tamanho; j += 16) {
+        int restante = tamanho - j;
+        __mmask16 mascara = (restante >= 16) ? (__mmask16) 0xFFFF
+                                             : (__mmask16) ((1u << restante) - 1u);
+        __m512 a = _mm512_maskz_loadu_ps(mascara, linha + j);
+        __m512 p = _mm512_maskz_loadu_ps(mascara, linhaPivo + j);
+        _mm512_mask_storeu_ps(linha + j, mascara, _mm512_fnmadd_ps(m, p, a));
+    }
+}
+
+__attribute__((target("sse2")))
+static void microAtualizacaoFSSE2(float* const* linhasC, const float* painelL,
+                                  const float* painelU, int larguraPainel) {
+    __m128 c[KERNEL_MK_LINHAS][4];
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < 4; j++)
+            c[i][j] = _mm_loadu_ps(linhasC[i] + 4 * j);
+
+    for (int p = 0; p < larguraPainel; p++) {
+        const float* u = painelU + (size_t)p * KERNEL_MK_COLUNAS_F;
+        __m128 u0 = _mm_loadu_ps(u),     u1 = _mm_loadu_ps(u + 4);
+        __m128 u2 = _mm_loadu_ps(u + 8), u3 = _mm_loadu_ps(u + 12);
+        for (int i = 0; i < KERNEL_MK_LINHAS; i++) {
+            __m128 l = _mm_set1_ps(painelL[(size_t)p * KERNEL_MK_LINHAS + i]);
+            c[i][0] = _mm_sub_ps(c[i][0], _mm_mul_ps(l, u0));
+            c[i][1] = _mm_sub_ps(c[i][1], _mm_mul_ps(l, u1));
+            c[i][2] = _mm_sub_ps(c[i][2], _mm_mul_ps(l, u2));
+            c[i][3] = _mm_sub_ps(c[i][3], _mm_mul_ps(l, u3));
+        }
+    }
+
+    for (int i = 0; i < KERNEL_MK_LINHAS; i++)
+        for (int j = 0; j < 4; j++)
+            _mm_storeu_ps(linhasC[i] + 4 * j, c[i][j]);
+}
+
+__attribute__((target("avx2,fma")))
+static void microAtualizacaoFAVX2(float* const* linhasC, const float* painelL,
+                                  const float* painelU, int larguraPainel) {
+    __m256 c00 = _mm256_loadu_ps(linhasC[0]), c01 = _mm256_loadu_ps(linhasC[0] + 8);
+    __m256 c10 = _mm256_loadu_ps(linhasC[1]), c11 = _mm256_loadu_ps(linhasC[1] + 8);
+    __m256 c20 = _mm256_loadu_ps(linhasC[2]), c21 = _mm256_loadu_ps(linhasC[2] + 8);
+    __m256 c30 = _mm256_loadu_ps(linhasC[3]), c31 = _mm256_loadu_ps(linhasC[3] + 8);
+
+    for (int p = 0; p < larguraPainel; p++) {
+        const float* u = painelU + (size_t)p * KERNEL_MK_COLUNAS_F;
+        const float* l = painelL + (size_t)p * KERNEL_MK_LINHAS;
+        __m256 u0 = _mm256_loadu_ps(u), u1 = _mm256_loadu_ps(u + 8);
+        __m256 l0 = _mm256_broadcast_ss(l),     l1 = _mm256_broadcast_ss(l + 1);
+        __m256 l2 = _mm256_broadcast_ss(l + 2), l3 = _mm256_broadcast_ss(l + 3);
+        c00 = _mm256_fnmadd_ps(l0, u0, c00); c01 = _mm256_fnmadd_ps(l0, u1, c01);
+        c10 = _mm256_fnmadd_ps(l1, u0, c10); c11 = _mm256_fnmadd_ps(l1, u1, c11);
+        c20 = _mm256_fnmadd_ps(l2, u0, c20); c21 = _mm256_fnmadd_ps(l2, u1, c21);
+        c30 = _mm256_fnmadd_ps(l3, u0, c30); c31 = _mm256_fnmadd_ps(l3, u1, c31);
+    }
+
+    _mm256_storeu_ps(linhasC[0], c00); _mm256_storeu_ps(linhasC[0] + 8, c01);
+    _mm256_storeu_ps(linhasC[1], c10); _mm256_storeu_ps(linhasC[1] + 8, c11);
+    _mm256_storeu_ps(linhasC[2], c20); _mm256_storeu_ps(linhasC[2] + 8, c21);
+    _mm256_storeu_ps(linhasC[3], c30); _mm256_storeu_ps(linhasC[3] + 8, c31);
+}
+
+__attribute__((target("avx512f")))
+static void microAtualizacaoFAVX512(float* const* linhasC, const float* painelL,
+                                    const float* painelU, int larguraPainel) {
+    __m512 c0 = _mm512_loadu_ps(linhasC[0]);
+    __m512 c1 = _mm512_loadu_ps(linhasC[1]);
+    __m512 c2 = _mm512_loadu_ps(linhasC[2]);
+    __m512 c3 = _mm512_loadu_ps(linhasC[3]);
+
+    for (int p = 0; p < larguraPainel; p++) {
+        __m512 u = _mm512_loadu_ps(painelU + (size_t)p * KERNEL_MK_COLUNAS_F);
+        const float* l = painelL + (size_t)p * KERNEL_MK_LINHAS;
+        c0 = _mm512_fnmadd_ps(_mm512_set1_ps(l[0]), u, c0);
+        c1 = _mm512_fnmadd_ps(_mm512_set1_ps(l[1]), u, c1);
+        c2 = _mm512_fnmadd_ps(_mm512_set1_ps(l[2]), u, c2);
+        c3 = _mm512_fnmadd_ps(_mm512_set1_ps(l[3]), u, c3);
+    }
+
+    _mm512_storeu_ps(linhasC[0], c0);
+    _mm512_storeu_ps(linhasC[1], c1);
+    _mm512_storeu_ps(linhasC[2], c2);
+    _mm512_storeu_ps(linhasC[3], c3);
+}
+
+// ============================================================
+// Argmax de |v| com máscara (pistas guardam máximo e índice)
+// ============================================================
+__attribute__((target("sse2")))
+static int argMaxAbsSSE2(const double* valores, const uint64_t* mascara,
+                         int tamanho, double* valorMax) {
+    const __m128d semSinal = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    __m128d maximos = _mm_setzero_pd();
+    __m128d indices = _mm_set1_pd(-1.0);
+    __m128d atual   = _mm_set_pd(1.0, 0.0);
+    const __m128d passo = _mm_set1_pd(2.0);
+    int j = 0;
+    for (; j + 2 <= tamanho; j += 2) {
+        __m128d v = _mm_and_pd(_mm_loadu_pd(valores + j), semSinal);
+        if (mascara) v = _mm_and_pd(v, _mm_loadu_pd((const double*)(mascara + j)));
+        __m128d maior = _mm_cmpgt_pd(v, maximos);
+        maximos = _mm_or_pd(_mm_and_pd(maior, v), _mm_andnot_pd(maior, maximos));
+        indices = _mm_or_pd(_mm_and_pd(maior, atual), _mm_andnot_pd(maior, indices));
+        atual = _mm_add_pd(atual, passo);
+    }
+    double m[2], idx[2];
+    _mm_storeu_pd(m, maximos);
+    _mm_storeu_pd(idx, indices);
+    return combinarPistas(m, idx, 2, valores, mascara, j, tamanho, valorMax);
+}
+
+__attribute__((target("avx2")))
+static int argMaxAbsAVX2(const double* valores, const uint64_t* mascara,
+                         int tamanho, double* valorMax) {
+    const __m256d semSinal = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    __m256d maximos = _mm256_setzero_pd();
+    __m256d indices = _mm256_set1_pd(-1.0);
+    __m256d atual   = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    const __m256d passo = _mm256_set1_pd(4.0);
+    int j = 0;
+    for (; j + 4 <= tamanho; j += 4) {
+        __m256d v = _mm256_and_pd(_mm256_loadu_pd(valores + j), semSinal);
+        if (mascara) v = _mm256_and_pd(v, _mm256_loadu_pd((const double*)(mascara + j)));
+        __m256d maior = _mm256_cmp_pd(v, maximos, _CMP_GT_OQ);
+        maximos = _mm256_blendv_pd(maximos, v, maior);
+        indices = _mm256_blendv_pd(indices, atual, maior);
+        atual = _mm256_add_pd(atual, passo);
+    }
+    double m[4], idx[4];
+    _mm256_storeu_pd(m, maximos);
+    _mm256_storeu_pd(idx, indices);
+    return combinarPistas(m, idx, 4, valores, mascara, j, tamanho, valorMax);
+}
+
+__attribute__((target("avx512f")))
+static int argMaxAbsAVX512(const double* valores, const uint64_t* mascara,
+                           int tamanho, double* valorMax) {
+    __m512d maximos = _mm512_setzero_pd();
+    __m512d indices = _mm512_set1_pd(-1.0);
+    __m512d atual   = _mm512_set_pd(7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0);
+    const __m512d passo = _mm512_set1_pd(8.0);
+    int j = 0;
+    for (; j + 8 <= tamanho; j += 8) {
+        __m512d v = _mm512_abs_pd(_mm512_loadu_pd(valores + j));
+        if (mascara) {
+            __m512i bits = _mm512_and_si512(_mm512_castpd_si512(v),
+                                            _mm512_loadu_si512((const void*)(mascara + j)));
+            v = _mm512_castsi512_pd(bits);
+        }
+        __mmask8 maior = _mm512_cmp_pd_mask(v, maximos, _CMP_GT_OQ);
+        maximos = _mm512_mask_mov_pd(maximos, maior, v);
+        indices = _mm512_mask_mov_pd(indices, maior, atual);
+        atual = _mm512_add_pd(atual, passo);
+    }
+    double m[8], idx[8];
+    _mm512_storeu_pd(m, maximos);
+    _mm512_storeu_pd(idx, indices);
+    return combinarPistas(m, idx, 8, valores, mascara, j, tamanho, valorMax);
+}
+#endif /* KERNELS_X86 */
+
+// ============================================================
+// Detecção e despacho
+// ============================================================
+KernelNivel kernelNivelDetectado(void) {
+#ifdef KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return KERNEL_AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return KERNEL_AVX2;
+    if (__builtin_cpu_supports("sse2")) return KERNEL_SSE2;
+#endif
+    return KERNEL_ESCALAR;
+}
+
+static const TabelaKernels TABELA_ESCALAR = {
+    KERNEL_ESCALAR, atualizarLinhaEscalar, microAtualizacaoEscalar, argMaxAbsEscalar,
+    atualizarLinhaFEscalar, microAtualizacaoFEscalar
+};
+#ifdef KERNELS_X86
+static const TabelaKernels TABELA_SSE2 = {
+    KERNEL_SSE2, atualizarLinhaSSE2, microAtualizacaoSSE2, argMaxAbsSSE2,
+    atualizarLinhaFSSE2, microAtualizacaoFSSE2
+};
+static const TabelaKernels TABELA_AVX2 = {
+    KERNEL_AVX2, atualizarLinhaAVX2, microAtualizacaoAVX2, argMaxAbsAVX2,
+    atualizarLinhaFAVX2, microAtualizacaoFAVX2
+};
+static const TabelaKernels TABELA_AVX512 = {
+    KERNEL_AVX512, atualizarLinhaAVX512, microAtualizacaoAVX512, argMaxAbsAVX512,
+    atualizarLinhaFAVX512, microAtualizacaoFAVX512
+};
+#endif
+
+/* Tabela de um nível já limitado ao detectado */
+static const TabelaKernels* tabelaDoNivel(KernelNivel nivel) {
+#ifdef KERNELS_X86
+    switch (nivel) {
+        case KERNEL_AVX512: return &TABELA_AVX512;
+        case KERNEL_AVX2:   return &TABELA_AVX2;
+        case KERNEL_SSE2:   return &TABELA_SSE2;
+        default:            break;
+    }
+#else
+    (void) nivel;
+#endif
+    return &TABELA_ESCALAR;
+}
+
+static KernelNivel limitarNivel(KernelNivel nivel) {
+    KernelNivel detectado = kernelNivelDetectado();
+    if (nivel > detectado) nivel = detectado;
+    if (nivel < KERNEL_ESCALAR) nivel = KERNEL_ESCALAR;
+    return nivel;
+}
+
+KernelNivel kernelForcarNivel(KernelNivel nivel) {
+    nivel = limitarNivel(nivel);
+    atomic_store_explicit(&g_tabela, tabelaDoNivel(nivel), memory_order_release);
+    return nivel;
+}
+
+/*
+ * Nível inicial: o detectado, ou KERNEL_SIMD=escalar|sse2|avx2|avx512.
+ * O nível é resolvido em variáveis locais e a tabela é publicada por um
+ * único compare-and-swap a partir de NULL: se várias threads chegam aqui
+ * juntas, todas ficam com a mesma tabela (a da primeira), nunca com uma
+ * mistura de ponteiros de níveis diferentes.
+ */
+static const TabelaKernels* inicializarDespacho(void) {
+    KernelNivel nivel = kernelNivelDetectado();
+    const char* escolha = getenv("KERNEL_SIMD");
+    if (escolha) {
+        if      (strcmp(escolha, "escalar") == 0) nivel = KERNEL_ESCALAR;
+        else if (strcmp(escolha, "sse2") == 0)    nivel = KERNEL_SSE2;
+        else if (strcmp(escolha, "avx2") == 0)    nivel = KERNEL_AVX2;
+        else if (strcmp(escolha, "avx512") == 0)  nivel = KERNEL_AVX512;
+    }
+    const TabelaKernels* tabela = tabelaDoNivel(limitarNivel(nivel));
+    const TabelaKernels* esperado = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&g_tabela, &esperado, tabela,
+                                                 memory_order_acq_rel, memory_order_acquire))
+        tabela = esperado;  // já publicada (por outra thread ou por kernelForcarNivel)
+    return tabela;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+/* Resolve o despacho na partida do programa, antes de qualquer thread */
+__attribute__((constructor))
+static void inicializarDespachoNaPartida(void) {
+    (void) inicializarDespacho();
+}
+#endif
+
+static inline const TabelaKernels* tabelaAtiva(void) {
+    const TabelaKernels* tabela = atomic_load_explicit(&g_tabela, memory_order_acquire);
+    return tabela ? tabela : inicializarDespacho();
+}
+
+KernelNivel kernelNivelAtivo(void) {
+    return tabelaAtiva()->nivel;
+}
+
+const char* kernelNome(KernelNivel nivel) {
+    switch (nivel) {
+        case KERNEL_AVX512: return "AVX-512F+FMA";
+        case KERNEL_AVX2:   return "AVX2+FMA";
+        case KERNEL_SSE2:   return "SSE2";
+        default:            return "escalar";
+    }
+}
+
+void kernelAtualizarLinha(double* linha, const double* linhaPivo,
+                          double multiplicador, int tamanho) {
+    tabelaAtiva()->atualizarLinha(linha, linhaPivo, multiplicador, tamanho);
+}
+
+void kernelMicroAtualizacao(double* const* linhasC, const double* painelL,
+                            const double* painelU, int larguraPainel) {
+    tabelaAtiva()->microAtualizacao(linhasC, painelL, painelU, larguraPainel);
+}
+
+int kernelArgMaxAbs(const double* valores, const uint64_t* mascara,
+                    int tamanho, double* valorMax) {
+    return tabelaAtiva()->argMaxAbs(valores, mascara, tamanho, valorMax);
+}
+
+void kernelAtualizarLinhaF(float* linha, const float* linhaPivo,
+                           float multiplicador, int tamanho) {
+    tabelaAtiva()->atualizarLinhaF(linha, linhaPivo, multiplicador, tamanho);
+}
+
+void kernelMicroAtualizacaoF(float* const* linhasC, const float* painelL,
+                             const float* painelU, int larguraPainel) {
+    tabelaAtiva()->microAtualizacaoF(linhasC, painelL, painelU, larguraPainel);
+}
@@ -2,6 +2,45 @@
 #include <windows.h>  // para QueryPerformanceCounter
 #include "utils.h"
 #include "gauss.h"
+#include "matriz_bin.h"
+#include "condicao.h"
+#include "banda.h"
+
+/**
+ * @brief Mostra κ₁(A) estimado e os limites de erro da solução calculada.
+ *
+ * @ref gauss descarta L; aqui A é fatorada de novo com @ref gauss_fatorar
+ * (que guarda L, U e P) e o resto custa O(n²), sem formar A⁻¹.
+ *
+ * @param sistema      [A|b] original (n × (n+1)); não é modificado.
+ * @param ordemMatriz  Ordem n.
+ * @param vetorSolucao Solução x̂ a avaliar.
+ */
+static void diagnosticarCondicao(double** sistema, int ordemMatriz, const double* vetorSolucao) {
+    Matriz* fatores = criarMatriz(ordemMatriz, ordemMatriz);
+    double* vetorB = criarVetorSolucao(ordemMatriz);
+    GaussFatoracao fatoracao;
+    if (fatores && vetorB) {
+        for (int i = 0; i < ordemMatriz; i++) {
+            for (int j = 0; j < ordemMatriz; j++) fatores->linhas[i][j] = sistema[i][j];
+            vetorB[i] = sistema[i][ordemMatriz];
+        }
+        double normaA = condicaoNorma1(sistema, ordemMatriz);
+        if (gauss_fatorar(fatores->linhas, ordemMatriz, 0.0, &fatoracao) == GAUSS_OK) {
+            CondicaoLimites limites;
+            printf("\ncond_1(A) estimado (Hager/Higham): %.6e\n",
+                   condicaoEstimar1(fatoracao.lu, fatoracao.lu, ordemMatriz, normaA));
+            if (condicaoLimitesErro(sistema, fatoracao.lu, fatoracao.lu, fatoracao.permutacao,
+                                    vetorB, vetorSolucao, ordemMatriz, &limites) == 0) {
+                printf("Erro retroativo (componente a componente): %.3e\n", limites.erroRetroativo);
+                printf("Limite do erro relativo ||x - x*||/||x*||: %.3e\n", limites.limiteProgressivo);
+            }
+            gauss_liberarFatoracao(&fatoracao);
+        }
+    }
+    destruirMatriz(fatores);
+    liberarVetorSolucao(vetorB);
+}
 
 /**
  * @brief Programa principal para resolução de sistemas lineares via Método de Gauss com pivotamento parcial.
@@ -11,17 +50,44 @@
  * numérica. O programa mede o tempo de execução, imprime a solução obtida
  * e calcula os erros relativos em comparação à solução exata (1,...,1)^T.
  *
+ * Com um argumento, [A|b] (n × (n+1)) é lido de um arquivo de matriz_bin.h
+ * em vez da Hilbert (mapeado em cópia privada: a eliminação não altera o arquivo).
+ *
  * É possível rodar o método em duas variantes:
  *  - @ref gauss() : versão sem tolerância explícita;
  *  - @ref gauss_com_tolerancia() : versão que interrompe se encontrar pivôs abaixo de um limite dado.
  */
-int main(void) {
+int main(int argc, char** argv) {
     // ============================================
     // ETAPA 1: Gerar sistema linear de teste
-    // Constrói a matriz de Hilbert aumentada [A|b].
+    // Constrói a matriz de Hilbert aumentada [A|b] (ou mapeia a do arquivo).
     // ============================================
     int ordemMatriz = 15;
-    double** matrizExtendida = gerarHilbertAumentada(ordemMatriz);
+    double** matrizExtendida = NULL;
+    MatrizMapeada mapa = { 0 };
+    if (argc > 1) {
+        MatrizBinStatus statusArquivo = matrizBinAbrir(&mapa, argv[1], MATRIZ_BIN_COPIA_PRIVADA, 1);
+        if (statusArquivo != MATRIZ_BIN_OK) {
+            fprintf(stderr, "%s: %s\n", argv[1], matrizBinMensagem(statusArquivo));
+            return 1;
+        }
+        if (mapa.matriz->nColunas != mapa.matriz->nLinhas + 1) {
+            fprintf(stderr, "%s: esperado [A|b] com n linhas e n+1 colunas\n", argv[1]);
+            matrizBinFechar(&mapa);
+            return 1;
+        }
+        ordemMatriz = mapa.matriz->nLinhas;
+        matrizExtendida = mapa.matriz->linhas;
+    } else {
+        matrizExtendida = gerarHilbertAumentada(ordemMatriz);
+    }
+
+    // cópia de [A|b] para o diagnóstico da ETAPA 4 (a eliminação sobrescreve o original)
+    Matriz* original = criarMatriz(ordemMatriz, ordemMatriz + 1);
+    if (original) {
+        for (int i = 0; i < ordemMatriz; i++)
+            for (int j = 0; j <= ordemMatriz; j++) original->linhas[i][j] = matrizExtendida[i][j];
+    }
 
     // ============================================
     // ETAPA 2: Preparar vetor solução
@@ -41,7 +107,12 @@ int main(void) {
     // Pode-se usar:
     //   gauss(...) → sem tolerância
     //   gauss_com_tolerancia(..., 1e-12) → com tolerância explícita
-    GaussStatus status = gauss(matrizExtendida, ordemMatriz, vetorSolucao);
+    // gauss_banda_ou_denso mede a banda de A antes: sistemas tridiagonais ou
+    // em banda estreita (arquivos de discretizações 1-D) vão para Thomas ou
+    // LU em banda; a Hilbert é densa e cai em gauss(...).
+    BandaInfo infoBanda;
+    GaussStatus status = gauss_banda_ou_denso(matrizExtendida, ordemMatriz, vetorSolucao,
+                                              0.0, &infoBanda);
 
     QueryPerformanceCounter(&fim);      // marca fim
     double tempoSegundos = (double)(fim.QuadPart - inicio.QuadPart) / (double)freq.QuadPart;
@@ -51,18 +122,27 @@ int main(void) {
     // ETAPA 4: Exibir resultados
     // Mostra status, solução aproximada e erros relativos.
     // ============================================
+    printf("Banda: kl = %d, ku = %d -> %s\n", infoBanda.inferior, infoBanda.superior,
+           bandaNomeMetodo(infoBanda.metodo));
     imprimirStatus(status);
     if (status == GAUSS_OK) {
         imprimirSolucao(vetorSolucao, ordemMatriz);
-        calcularErroRelativo(vetorSolucao, ordemMatriz);
+        if (!mapa.matriz) calcularErroRelativo(vetorSolucao, ordemMatriz);  // solução exata só na Hilbert
+        if (original) diagnosticarCondicao(original->linhas, ordemMatriz, vetorSolucao);
     }
+    destruirMatriz(original);
 
     printf("\nTempo de execução: %.9f segundos (%.0f ns)\n", tempoSegundos, tempoNanoSeg);
 
     // ============================================
     // ETAPA 5: Liberar memória alocada
     // ============================================
-    liberar(matrizExtendida, ordemMatriz, vetorSolucao);
+    if (mapa.matriz) {
+        matrizBinFechar(&mapa);
+        liberarVetorSolucao(vetorSolucao);
+    } else {
+        liberar(matrizExtendida, ordemMatriz, vetorSolucao);
+    }
 
     // ============================================
     // ETAPA 6: Encerrar com código de status
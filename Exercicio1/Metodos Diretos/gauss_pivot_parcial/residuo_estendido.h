@@ -0,0 +1,49 @@
+#ifndef RESIDUO_ESTENDIDO_H
+#define RESIDUO_ESTENDIDO_H
+
+/**
+ * @file residuo_estendido.h
+ * @brief Aritmética double-double (≈ 106 bits de mantissa) para o resíduo
+ *        do refinamento iterativo.
+ *
+ * Cada número é a soma não avaliada `alto + baixo`, com |baixo| ≤ ulp(alto)/2.
+ * As operações usam as transformações exatas TwoSum (Knuth) e TwoProduct
+ * (via fma), então só dependem de double IEEE — sem `long double`, cujo
+ * tamanho muda de compilador para compilador.
+ *
+ * No refinamento, b − A·x é avaliado assim e só então arredondado para
+ * double: o cancelamento entre b e A·x deixa de apagar os dígitos que a
+ * correção precisa recuperar.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief r = b − a·(x + caudaX), acumulado em double-double e arredondado para double.
+ *
+ * @param linhaA  Linha de A (tamanho @p tamanho).
+ * @param vetorX  Parte alta de x.
+ * @param caudaX  Parte baixa de x (mesmo tamanho), ou NULL se x for só double.
+ * @param b       Componente do lado direito.
+ * @param tamanho Número de termos.
+ */
+double residuoEstendido(const double* linhaA, const double* vetorX, const double* caudaX,
+                        double b, int tamanho);
+
+/**
+ * @brief (x, caudaX) += d em double-double (x guarda o valor arredondado).
+ *
+ * @param vetorX   Parte alta de x, atualizada.
+ * @param caudaX   Parte baixa de x, atualizada.
+ * @param correcao Correção d.
+ * @param tamanho  Número de componentes.
+ */
+void somarCorrecaoEstendida(double* vetorX, double* caudaX, const double* correcao, int tamanho);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESIDUO_ESTENDIDO_H */
@@ -0,0 +1,87 @@
+/**
+ * @file teste_ooc.c
+ * @brief Confere gauss_ooc_com_tolerancia contra gauss_blocado_com_tolerancia
+ *        (blocos de 64) com fatias estreitas.
+ *
+ * Com L = 1, 2 ou 3 colunas por fatia, cada fatia é gravada e relida muitas
+ * vezes, e a pré-carga lê regiões que acabaram de ser gravadas. Os status e
+ * as soluções devem ser idênticos bit a bit (gauss_ooc.h). Retorna 0 se
+ * todos os casos passarem.
+ *
+ * Compile na pasta gauss_pivot_parcial:
+ *   gcc testes/teste_ooc.c gauss.c agendador.c gauss_ooc.c kernels.c residuo_estendido.c utils.c -I. -o teste_ooc -lm -pthread
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gauss.h"
+#include "gauss_ooc.h"
+#include "utils.h"
+
+#define ARQUIVO_TESTE "teste_ooc.bin"
+#define TOLERANCIA    1e-12
+
+/* Menor orçamento (em passos de uma coluna por fatia) que dá fatias de @p largura colunas */
+static int criarComLargura(GaussOoc* ooc, int ordemMatriz, int largura) {
+    size_t passo = (size_t) 3 * ordemMatriz * sizeof(double);
+    for (size_t orcamento = passo; orcamento < ((size_t) 64 << 20); orcamento += passo) {
+        if (!gauss_ooc_criar(ooc, ARQUIVO_TESTE, ordemMatriz, orcamento)) continue;
+        int larguraObtida = ooc->largura;
+        if (larguraObtida == largura) return 1;
+        gauss_ooc_fechar(ooc, 1);
+        if (larguraObtida > largura) return 0;
+    }
+    return 0;
+}
+
+/* [A|b] com entradas em [-1, 1): pivotamento em quase todas as colunas */
+static void preencher(double** matrizEstendida, int ordemMatriz, unsigned semente) {
+    srand(semente);
+    for (int i = 0; i < ordemMatriz; i++)
+        for (int j = 0; j <= ordemMatriz; j++)
+            matrizEstendida[i][j] = 2.0 * rand() / ((double) RAND_MAX + 1.0) - 1.0;
+}
+
+static int testarCaso(int ordemMatriz, int largura) {
+    GaussOoc sistema;
+    if (!criarComLargura(&sistema, ordemMatriz, largura)) {
+        printf("n = %2d, L = %d: orçamento não encontrado\n", ordemMatriz, largura);
+        return 0;
+    }
+
+    double** referencia = criarMatriz(ordemMatriz, ordemMatriz + 1)->linhas;
+    double* solucaoReferencia = (double*) malloc(ordemMatriz * sizeof(double));
+    double* solucaoOoc = (double*) malloc(ordemMatriz * sizeof(double));
+    preencher(referencia, ordemMatriz, (unsigned)(ordemMatriz * 7 + largura));
+    int ok = 1;
+    for (int i = 0; i < ordemMatriz; i++) ok &= gauss_ooc_definirLinha(&sistema, i, referencia[i]);
+
+    GaussStatus statusOoc = gauss_ooc_com_tolerancia(&sistema, solucaoOoc, TOLERANCIA);
+    gauss_ooc_fechar(&sistema, 1);
+    GaussStatus statusReferencia = gauss_blocado_com_tolerancia(referencia, ordemMatriz,
+                                                                solucaoReferencia, 64, TOLERANCIA);
+
+    ok = ok && statusOoc == statusReferencia &&
+         (statusOoc != GAUSS_OK ||
+          memcmp(solucaoOoc, solucaoReferencia, ordemMatriz * sizeof(double)) == 0);
+    if (!ok) printf("n = %2d, L = %d: FALHOU (status %d x %d)\n",
+                    ordemMatriz, largura, statusOoc, statusReferencia);
+
+    liberarMatriz(referencia, ordemMatriz);
+    free(solucaoReferencia);
+    free(solucaoOoc);
+    return ok;
+}
+
+int main(void) {
+    int falhas = 0, casos = 0;
+    for (int ordemMatriz = 1; ordemMatriz <= 64; ordemMatriz++) {
+        // fatias mais largas que [A|b] não existem (n = 1 só tem L = 1 e 2)
+        for (int largura = 1; largura <= 3 && largura <= ordemMatriz + 1; largura++) {
+            casos++;
+            if (!testarCaso(ordemMatriz, largura)) falhas++;
+        }
+    }
+    printf("%d de %d casos idênticos à versão na memória\n", casos - falhas, casos);
+    return falhas ? EXIT_FAILURE : EXIT_SUCCESS;
+}
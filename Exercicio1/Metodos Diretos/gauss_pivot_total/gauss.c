@@ -2,43 +2,102 @@
 #include <stdlib.h>
 #include <math.h>
 #include "gauss.h"
+#include "kernels.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#define GAUSS_PRAGMA(x) _Pragma(#x)
+#else
+#define GAUSS_PRAGMA(x)
+#endif
 
 /* ============================================================
-   Permutação lógica de colunas (pivotamento total sem mover dados)
+   CONFIGURAÇÃO DO PARALELISMO (busca do pivô e atualização)
    ============================================================ */
-static int* permColGlobal = NULL;
-static int   tamanhoPerm  = 0;
+static int g_numThreads = 0;                       /* <= 0: padrão do OpenMP */
+static int g_corteParalelo = GAUSS_CORTE_PARALELO; /* linhas restantes mínimas */
+
+void gaussDefinirThreads(int numThreads) {
+    g_numThreads = numThreads;
+}
+
+void gaussDefinirCorteParalelo(int linhasMinimas) {
+    g_corteParalelo = linhasMinimas;
+}
+
+int gaussNumThreads(void) {
+#ifdef _OPENMP
+    return (g_numThreads > 0) ? g_numThreads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+#ifdef _OPENMP
+/* Vale a pena abrir a região paralela para @p linhasRestantes linhas? */
+static int usarParalelo(int linhasRestantes) {
+    if (gaussNumThreads() <= 1 || linhasRestantes < g_corteParalelo) return 0;
+    (void) kernelNivelAtivo(); /* resolve o despacho SIMD antes de abrir as threads */
+    return 1;
+}
+#endif
 
 /* ============================================================
-   AUXILIARES (escopo interno)
+   Contexto legado: usado apenas pelas funções sem contexto
+   (eliminacao / substituicaoRegressiva), que dependem de estado
+   entre as duas chamadas. NÃO é reentrante.
    ============================================================ */
+static GaussTotalContexto g_contextoLegado = { NULL, NULL, NULL, 0 };
 
-/**
- * @brief Inicializa a permutação de colunas como identidade.
- * @param ordemMatriz Ordem da matriz.
- * @return 1 em caso de sucesso, 0 em falha de alocação.
- */
-static int inicializarPermutacaoColunas(int ordemMatriz) {
-    permColGlobal = (int*) malloc(ordemMatriz * sizeof(int));
-    if (!permColGlobal) return 0;
-    tamanhoPerm = ordemMatriz;
-    for (int coluna = 0; coluna < ordemMatriz; coluna++) {
-        permColGlobal[coluna] = coluna; /* identidade */
+/* ============================================================
+   CONTEXTO (permutação lógica de colunas, pertencente ao chamador)
+   ============================================================ */
+
+int criarContextoTotal(GaussTotalContexto* contexto, int ordemMatriz) {
+    contexto->permColunas   = (int*) malloc(ordemMatriz * sizeof(int));
+    contexto->posicaoColuna = (int*) malloc(ordemMatriz * sizeof(int));
+    contexto->mascaraAtiva  = (uint64_t*) malloc(ordemMatriz * sizeof(uint64_t));
+    contexto->ordem = ordemMatriz;
+    if (!contexto->permColunas || !contexto->posicaoColuna || !contexto->mascaraAtiva) {
+        liberarContextoTotal(contexto);
+        return 0;
     }
+    reiniciarContextoTotal(contexto);
     return 1;
 }
 
-/**
- * @brief Libera a permutação lógica de colunas.
- */
-static void liberarPermutacao(void) {
-    if (permColGlobal) free(permColGlobal);
-    permColGlobal = NULL;
-    tamanhoPerm = 0;
+void reiniciarContextoTotal(GaussTotalContexto* contexto) {
+    for (int coluna = 0; coluna < contexto->ordem; coluna++) {
+        contexto->permColunas[coluna]   = coluna; /* identidade */
+        contexto->posicaoColuna[coluna] = coluna;
+        contexto->mascaraAtiva[coluna]  = KERNEL_MASCARA_ATIVA;
+    }
 }
 
+void liberarContextoTotal(GaussTotalContexto* contexto) {
+    if (!contexto) return;
+    free(contexto->permColunas);
+    free(contexto->posicaoColuna);
+    free(contexto->mascaraAtiva);
+    contexto->permColunas   = NULL;
+    contexto->posicaoColuna = NULL;
+    contexto->mascaraAtiva  = NULL;
+    contexto->ordem = 0;
+}
+
+/* ============================================================
+   AUXILIARES (escopo interno)
+   ============================================================ */
+
 /**
  * @brief Encontra o pivô global (em valor absoluto) na submatriz (pivotamento total).
+ *
+ * Cada linha é varrida de forma contígua pelas colunas reais com o argmax SIMD
+ * (colunas já eliminadas ficam fora via máscara). As linhas são divididas entre
+ * as threads e os candidatos combinados por redução: maior |valor|; em empate,
+ * menor linha e, dentro da linha, menor coluna real.
+ *
+ * @param contexto        Contexto com a permutação e a máscara de colunas ativas.
  * @param matrizEstendida Matriz [A|b].
  * @param ordemMatriz     Ordem da matriz A.
  * @param colunaPivo      Índice k da etapa corrente (submatriz k..n-1).
@@ -46,37 +105,150 @@ static void liberarPermutacao(void) {
  * @param colunaPivoAtual (saída) coluna lógica escolhida (índice no vetor de permutação).
  * @param maxAbs          (saída) valor absoluto máximo encontrado.
  */
-static void encontrarPivoTotal(double** matrizEstendida,
+static void encontrarPivoTotal(const GaussTotalContexto* contexto,
+                               double** matrizEstendida,
                                int ordemMatriz,
                                int colunaPivo,
                                int* linhaPivo,
                                int* colunaPivoAtual,
                                double* maxAbs) {
-    *linhaPivo = colunaPivo;
-    *colunaPivoAtual = colunaPivo;
-    *maxAbs = 0.0;
+    double melhorValor = 0.0;
+    int melhorLinha = -1;
+    int melhorColunaReal = -1;
+
+    GAUSS_PRAGMA(omp parallel num_threads(gaussNumThreads()) \
+                 if(usarParalelo(ordemMatriz - colunaPivo)))
+    {
+        double valorLocal = 0.0;
+        int linhaLocal = -1;
+        int colunaLocal = -1;
+
+        GAUSS_PRAGMA(omp for schedule(static) nowait)
+        for (int linha = colunaPivo; linha < ordemMatriz; linha++) {
+            double valor;
+            int colunaReal = kernelArgMaxAbs(matrizEstendida[linha], contexto->mascaraAtiva,
+                                             ordemMatriz, &valor);
+            if (colunaReal >= 0 && valor > valorLocal) {
+                valorLocal = valor;
+                linhaLocal = linha;
+                colunaLocal = colunaReal;
+            }
+        }
 
-    for (int linha = colunaPivo; linha < ordemMatriz; linha++) {
-        for (int colunaAtual = colunaPivo; colunaAtual < ordemMatriz; colunaAtual++) {
-            int colunaReal = permColGlobal[colunaAtual];
-            double valor = fabs(matrizEstendida[linha][colunaReal]);
-            if (valor > *maxAbs) {
-                *maxAbs = valor;
-                *linhaPivo = linha;
-                *colunaPivoAtual = colunaAtual;
+        GAUSS_PRAGMA(omp critical(gauss_pivo_total))
+        {
+            if (linhaLocal >= 0 &&
+                (valorLocal > melhorValor ||
+                 (valorLocal == melhorValor && linhaLocal < melhorLinha))) {
+                melhorValor = valorLocal;
+                melhorLinha = linhaLocal;
+                melhorColunaReal = colunaLocal;
             }
         }
     }
+
+    if (melhorLinha < 0) { /* submatriz nula */
+        *linhaPivo = colunaPivo;
+        *colunaPivoAtual = colunaPivo;
+        *maxAbs = 0.0;
+        return;
+    }
+    *linhaPivo = melhorLinha;
+    *colunaPivoAtual = contexto->posicaoColuna[melhorColunaReal];
+    *maxAbs = melhorValor;
+}
+
+/**
+ * @brief Maior |valor| da coluna real @p colunaReal nas linhas k..n-1.
+ * @return Linha do máximo (a primeira em empate); @p maxAbs recebe o valor.
+ */
+static int maxColunaTorre(double** matrizEstendida, int ordemMatriz, int colunaPivo,
+                          int colunaReal, double* maxAbs) {
+    int melhorLinha = colunaPivo;
+    double melhorValor = 0.0;
+    for (int linha = colunaPivo; linha < ordemMatriz; linha++) {
+        double valor = fabs(matrizEstendida[linha][colunaReal]);
+        if (valor > melhorValor) {
+            melhorValor = valor;
+            melhorLinha = linha;
+        }
+    }
+    *maxAbs = melhorValor;
+    return melhorLinha;
+}
+
+/**
+ * @brief Encontra um pivô por pivotamento "torre" (rook pivoting).
+ *
+ * Parte da coluna lógica k e alterna buscas de máximo em coluna e em linha
+ * (restritas à submatriz ativa) até achar um elemento que seja o maior, em
+ * módulo, tanto na sua linha quanto na sua coluna. O valor cresce
+ * estritamente a cada troca, então o laço termina; na prática bastam
+ * poucas buscas (custo O(n) por busca contra O(n²) da busca total).
+ *
+ * Se a busca terminar em zero (coluna e linha iniciais nulas), recorre à
+ * busca total para distinguir uma submatriz realmente nula.
+ *
+ * @param buscas (saída) número de buscas em linha/coluna feitas na etapa.
+ * @return 1 se recorreu à busca total, 0 caso contrário.
+ */
+static int encontrarPivoTorre(const GaussTotalContexto* contexto,
+                              double** matrizEstendida,
+                              int ordemMatriz,
+                              int colunaPivo,
+                              int* linhaPivo,
+                              int* colunaPivoAtual,
+                              double* maxAbs,
+                              int* buscas) {
+    int colunaReal = contexto->permColunas[colunaPivo];
+    double valor;
+    int linha = maxColunaTorre(matrizEstendida, ordemMatriz, colunaPivo, colunaReal, &valor);
+    int numBuscas = 1;
+
+    for (;;) {
+        /* Busca na linha: o candidato ainda é o maior da sua linha? */
+        double valorLinha;
+        int colunaLinha = kernelArgMaxAbs(matrizEstendida[linha], contexto->mascaraAtiva,
+                                          ordemMatriz, &valorLinha);
+        numBuscas++;
+        if (colunaLinha < 0 || !(valorLinha > valor)) break;
+        colunaReal = colunaLinha;
+        valor = valorLinha;
+
+        /* Busca na coluna: o novo candidato é o maior da sua coluna? */
+        double valorColuna;
+        int linhaColuna = maxColunaTorre(matrizEstendida, ordemMatriz, colunaPivo,
+                                         colunaReal, &valorColuna);
+        numBuscas++;
+        if (!(valorColuna > valor)) break;
+        linha = linhaColuna;
+        valor = valorColuna;
+    }
+
+    if (valor == 0.0) {
+        encontrarPivoTotal(contexto, matrizEstendida, ordemMatriz, colunaPivo,
+                           linhaPivo, colunaPivoAtual, maxAbs);
+        *buscas = numBuscas + 1;
+        return 1;
+    }
+
+    *linhaPivo = linha;
+    *colunaPivoAtual = contexto->posicaoColuna[colunaReal];
+    *maxAbs = valor;
+    *buscas = numBuscas;
+    return 0;
 }
 
 /**
  * @brief Troca linhas fisicamente e “troca” colunas via permutação lógica.
+ * @param contexto        Contexto com a permutação lógica de colunas.
  * @param matrizEstendida Matriz [A|b].
  * @param colunaPivo      Índice k da etapa.
  * @param linhaPivo       Linha escolhida para o pivô.
  * @param colunaPivoAtual Coluna lógica escolhida para o pivô.
  */
-static void trocarLinhaEColuna(double** matrizEstendida,
+static void trocarLinhaEColuna(GaussTotalContexto* contexto,
+                               double** matrizEstendida,
                                int colunaPivo,
                                int linhaPivo,
                                int colunaPivoAtual) {
@@ -88,136 +260,106 @@ static void trocarLinhaEColuna(double** matrizEstendida,
     }
     /* Troca de COLUNAS via permutação lógica (não move dados) */
     if (colunaPivoAtual != colunaPivo) {
-        int tmpCol = permColGlobal[colunaPivo];
-        permColGlobal[colunaPivo] = permColGlobal[colunaPivoAtual];
-        permColGlobal[colunaPivoAtual] = tmpCol;
+        int tmpCol = contexto->permColunas[colunaPivo];
+        contexto->permColunas[colunaPivo] = contexto->permColunas[colunaPivoAtual];
+        contexto->permColunas[colunaPivoAtual] = tmpCol;
+        contexto->posicaoColuna[contexto->permColunas[colunaPivo]] = colunaPivo;
+        contexto->posicaoColuna[contexto->permColunas[colunaPivoAtual]] = colunaPivoAtual;
     }
+    /* A coluna do pivô sai das próximas buscas */
+    contexto->mascaraAtiva[contexto->permColunas[colunaPivo]] = 0;
 }
 
-/* ============================================================
-   ELIMINAÇÃO — SEM TOLERÂNCIA
-   ============================================================ */
-
 /**
- * @brief Executa a fase de eliminação com pivotamento total (sem tolerância).
+ * @brief Núcleo comum das eliminações (com e sem tolerância, total ou torre).
  *
- * @param matrizEstendida Matriz [A|b] de entrada, modificada para [U|c].
- * @param ordemMatriz     Ordem da matriz.
- * @return GAUSS_OK ou GAUSS_SINGULAR.
- */
-GaussStatus eliminacao(double** matrizEstendida, int ordemMatriz) {
-    if (!inicializarPermutacaoColunas(ordemMatriz)) {
-        return GAUSS_SINGULAR; /* sem enum específico para memória */
-    }
-
-    for (int colunaPivo = 0; colunaPivo < ordemMatriz - 1; colunaPivo++) {
-        int linhaPivo, colunaPivoAtual;
-        double maxAbs;
-
-        encontrarPivoTotal(matrizEstendida, ordemMatriz, colunaPivo,
-                           &linhaPivo, &colunaPivoAtual, &maxAbs);
-
-        if (maxAbs == 0.0) { /* submatriz é zero → singular */
-            liberarPermutacao();
-            return GAUSS_SINGULAR;
-        }
-
-        trocarLinhaEColuna(matrizEstendida, colunaPivo, linhaPivo, colunaPivoAtual);
-
-        int colunaRealPivo = permColGlobal[colunaPivo];
-        double pivo = matrizEstendida[colunaPivo][colunaRealPivo];
-        if (pivo == 0.0) { /* pivô exato zero */
-            liberarPermutacao();
-            return GAUSS_SINGULAR;
-        }
-
-        for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
-            double multiplicador = matrizEstendida[linha][colunaRealPivo] / pivo;
-
-            for (int colunaAtual = colunaPivo; colunaAtual < ordemMatriz; colunaAtual++) {
-                int colunaReal = permColGlobal[colunaAtual];
-                matrizEstendida[linha][colunaReal] -= multiplicador * matrizEstendida[colunaPivo][colunaReal];
-            }
-            matrizEstendida[linha][ordemMatriz] -= multiplicador * matrizEstendida[colunaPivo][ordemMatriz];
-        }
-    }
-
-    /* Último pivô será resolvido na regressiva. */
-    return GAUSS_OK;
-}
-
-/* ============================================================
-   ELIMINAÇÃO — COM TOLERÂNCIA
-   ============================================================ */
-
-/**
- * @brief Executa a fase de eliminação com pivotamento total (com tolerância).
+ * Sem tolerância, só aborta com pivô exatamente zero; com tolerância, aborta
+ * se |pivô| < tolerancia.
  *
- * @param matrizEstendida Matriz [A|b] de entrada, modificada para [U|c].
- * @param ordemMatriz     Ordem da matriz.
- * @param tolerancia      Valor usado para checar pivôs muito pequenos.
- * @return GAUSS_OK ou GAUSS_SINGULAR.
+ * @param torre        1 para pivotamento torre, 0 para busca total.
+ * @param estatisticas (opcional, só torre) contagem de buscas por etapa.
  */
-GaussStatus eliminacao_com_tolerancia(double** matrizEstendida, int ordemMatriz, double tolerancia) {
-    if (!inicializarPermutacaoColunas(ordemMatriz)) {
+static GaussStatus eliminacaoNucleo(GaussTotalContexto* contexto,
+                                    double** matrizEstendida, int ordemMatriz,
+                                    int checarTolerancia, double tolerancia,
+                                    int torre, GaussTorreEstatisticas* estatisticas) {
+    if (contexto->ordem != ordemMatriz) {
         return GAUSS_SINGULAR;
     }
+    reiniciarContextoTotal(contexto);
+    if (estatisticas) {
+        estatisticas->etapas = 0;
+        estatisticas->totalBuscas = 0;
+        estatisticas->maxBuscas = 0;
+        estatisticas->recursosBuscaTotal = 0;
+    }
 
     for (int colunaPivo = 0; colunaPivo < ordemMatriz - 1; colunaPivo++) {
         int linhaPivo, colunaPivoAtual;
         double maxAbs;
 
-        encontrarPivoTotal(matrizEstendida, ordemMatriz, colunaPivo,
-                           &linhaPivo, &colunaPivoAtual, &maxAbs);
+        if (torre) {
+            int buscas;
+            int recorreu = encontrarPivoTorre(contexto, matrizEstendida, ordemMatriz, colunaPivo,
+                                              &linhaPivo, &colunaPivoAtual, &maxAbs, &buscas);
+            if (estatisticas) {
+                if (estatisticas->buscasPorEtapa) {
+                    estatisticas->buscasPorEtapa[colunaPivo] = buscas;
+                }
+                estatisticas->etapas++;
+                estatisticas->totalBuscas += buscas;
+                if (buscas > estatisticas->maxBuscas) estatisticas->maxBuscas = buscas;
+                estatisticas->recursosBuscaTotal += recorreu;
+            }
+        } else {
+            encontrarPivoTotal(contexto, matrizEstendida, ordemMatriz, colunaPivo,
+                               &linhaPivo, &colunaPivoAtual, &maxAbs);
+        }
 
-        if (fabs(maxAbs) < tolerancia) {
-            liberarPermutacao();
-            return GAUSS_SINGULAR;
+        if (checarTolerancia ? (fabs(maxAbs) < tolerancia) : (maxAbs == 0.0)) {
+            return GAUSS_SINGULAR; /* submatriz (quase) nula */
         }
 
-        trocarLinhaEColuna(matrizEstendida, colunaPivo, linhaPivo, colunaPivoAtual);
+        trocarLinhaEColuna(contexto, matrizEstendida, colunaPivo, linhaPivo, colunaPivoAtual);
 
-        int colunaRealPivo = permColGlobal[colunaPivo];
+        const int* permColunas = contexto->permColunas;
+        int colunaRealPivo = permColunas[colunaPivo];
         double pivo = matrizEstendida[colunaPivo][colunaRealPivo];
-        if (fabs(pivo) < tolerancia) {
-            liberarPermutacao();
+        if (checarTolerancia ? (fabs(pivo) < tolerancia) : (pivo == 0.0)) {
             return GAUSS_SINGULAR;
         }
 
+        GAUSS_PRAGMA(omp parallel for schedule(static) num_threads(gaussNumThreads()) \
+                     if(usarParalelo(ordemMatriz - colunaPivo - 1)))
         for (int linha = colunaPivo + 1; linha < ordemMatriz; linha++) {
             double multiplicador = matrizEstendida[linha][colunaRealPivo] / pivo;
 
             for (int colunaAtual = colunaPivo; colunaAtual < ordemMatriz; colunaAtual++) {
-                int colunaReal = permColGlobal[colunaAtual];
+                int colunaReal = permColunas[colunaAtual];
                 matrizEstendida[linha][colunaReal] -= multiplicador * matrizEstendida[colunaPivo][colunaReal];
             }
             matrizEstendida[linha][ordemMatriz] -= multiplicador * matrizEstendida[colunaPivo][ordemMatriz];
         }
     }
 
+    /* Último pivô será resolvido na regressiva. */
     return GAUSS_OK;
 }
 
-/* ============================================================
-   SUBSTITUIÇÃO REGRESSIVA — SEM TOLERÂNCIA
-   ============================================================ */
-
 /**
- * @brief Executa a substituição regressiva após a eliminação (sem tolerância).
- *
- * @param matrizEstendida Matriz [U|c] após a eliminação.
- * @param ordemMatriz     Ordem da matriz.
- * @param vetorSolucao    Vetor solução (saída).
- * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
+ * @brief Núcleo comum das substituições regressivas (com e sem tolerância).
  */
-GaussStatus substituicaoRegressiva(double** matrizEstendida, int ordemMatriz, double* vetorSolucao) {
-    if (!permColGlobal || tamanhoPerm != ordemMatriz) {
+static GaussStatus substituicaoNucleo(const GaussTotalContexto* contexto,
+                                      double** matrizEstendida, int ordemMatriz,
+                                      double* vetorSolucao,
+                                      int checarTolerancia, double tolerancia) {
+    if (!contexto->permColunas || contexto->ordem != ordemMatriz) {
         return GAUSS_SINGULAR;
     }
+    const int* permColunas = contexto->permColunas;
 
     double* xPerm = (double*) malloc(ordemMatriz * sizeof(double));
     if (!xPerm) {
-        liberarPermutacao();
         return GAUSS_SINGULAR;
     }
 
@@ -225,119 +367,186 @@ GaussStatus substituicaoRegressiva(double** matrizEstendida, int ordemMatriz, do
         double soma = 0.0;
 
         for (int colunaAtual = linha + 1; colunaAtual < ordemMatriz; colunaAtual++) {
-            int colunaReal = permColGlobal[colunaAtual];
+            int colunaReal = permColunas[colunaAtual];
             soma += matrizEstendida[linha][colunaReal] * xPerm[colunaAtual];
         }
 
-        int colunaDiag = permColGlobal[linha];
+        int colunaDiag = permColunas[linha];
         double diag = matrizEstendida[linha][colunaDiag];
         double rhs  = matrizEstendida[linha][ordemMatriz] - soma;
 
-        if (diag == 0.0) {
+        int diagNula = checarTolerancia ? (fabs(diag) < tolerancia) : (diag == 0.0);
+        if (diagNula) {
+            int rhsNulo = checarTolerancia ? (fabs(rhs) < tolerancia) : (rhs == 0.0);
             free(xPerm);
-            if (rhs == 0.0) { liberarPermutacao(); return GAUSS_SINGULAR; }       /* indeterminado */
-            else            { liberarPermutacao(); return GAUSS_INCONSISTENTE; } /* sem solução   */
+            return rhsNulo ? GAUSS_SINGULAR       /* indeterminado */
+                           : GAUSS_INCONSISTENTE; /* sem solução   */
         }
 
         xPerm[linha] = rhs / diag;
     }
 
     for (int colunaAtual = 0; colunaAtual < ordemMatriz; colunaAtual++) {
-        int colunaOriginal = permColGlobal[colunaAtual];
+        int colunaOriginal = permColunas[colunaAtual];
         vetorSolucao[colunaOriginal] = xPerm[colunaAtual];
     }
 
     free(xPerm);
-    liberarPermutacao();
     return GAUSS_OK;
 }
 
 /* ============================================================
-   SUBSTITUIÇÃO REGRESSIVA — COM TOLERÂNCIA
+   ELIMINAÇÃO / SUBSTITUIÇÃO — COM CONTEXTO (reentrantes)
    ============================================================ */
 
-/**
- * @brief Executa a substituição regressiva após a eliminação (com tolerância).
- *
- * @param matrizEstendida Matriz [U|c] após a eliminação.
- * @param ordemMatriz     Ordem da matriz.
- * @param vetorSolucao    Vetor solução (saída).
- * @param tolerancia      Valor usado para checar pivôs muito pequenos.
- * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
- */
-GaussStatus substituicaoRegressiva_com_tolerancia(double** matrizEstendida, int ordemMatriz, double* vetorSolucao, double tolerancia) {
-    if (!permColGlobal || tamanhoPerm != ordemMatriz) {
-        return GAUSS_SINGULAR;
-    }
+GaussStatus eliminacao_contexto(GaussTotalContexto* contexto,
+                                double** matrizEstendida, int ordemMatriz) {
+    return eliminacaoNucleo(contexto, matrizEstendida, ordemMatriz, 0, 0.0, 0, NULL);
+}
 
-    double* xPerm = (double*) malloc(ordemMatriz * sizeof(double));
-    if (!xPerm) {
-        liberarPermutacao();
-        return GAUSS_SINGULAR;
-    }
+GaussStatus eliminacao_com_tolerancia_contexto(GaussTotalContexto* contexto,
+                                               double** matrizEstendida, int ordemMatriz,
+                                               double tolerancia) {
+    return eliminacaoNucleo(contexto, matrizEstendida, ordemMatriz, 1, tolerancia, 0, NULL);
+}
 
-    for (int linha = ordemMatriz - 1; linha >= 0; linha--) {
-        double soma = 0.0;
+GaussStatus substituicaoRegressiva_contexto(const GaussTotalContexto* contexto,
+                                            double** matrizEstendida, int ordemMatriz,
+                                            double* vetorSolucao) {
+    return substituicaoNucleo(contexto, matrizEstendida, ordemMatriz, vetorSolucao, 0, 0.0);
+}
 
-        for (int colunaAtual = linha + 1; colunaAtual < ordemMatriz; colunaAtual++) {
-            int colunaReal = permColGlobal[colunaAtual];
-            soma += matrizEstendida[linha][colunaReal] * xPerm[colunaAtual];
-        }
+GaussStatus substituicaoRegressiva_com_tolerancia_contexto(const GaussTotalContexto* contexto,
+                                                           double** matrizEstendida,
+                                                           int ordemMatriz,
+                                                           double* vetorSolucao,
+                                                           double tolerancia) {
+    return substituicaoNucleo(contexto, matrizEstendida, ordemMatriz, vetorSolucao,
+                              1, tolerancia);
+}
 
-        int colunaDiag = permColGlobal[linha];
-        double diag = matrizEstendida[linha][colunaDiag];
-        double rhs  = matrizEstendida[linha][ordemMatriz] - soma;
+/* ============================================================
+   PIVOTAMENTO TORRE (ROOK)
+   ============================================================ */
 
-        if (fabs(diag) < tolerancia) {
-            free(xPerm);
-            if (fabs(rhs) < tolerancia) { liberarPermutacao(); return GAUSS_SINGULAR; }
-            else                        { liberarPermutacao(); return GAUSS_INCONSISTENTE; }
-        }
+GaussStatus eliminacao_torre_contexto(GaussTotalContexto* contexto,
+                                      double** matrizEstendida, int ordemMatriz,
+                                      GaussTorreEstatisticas* estatisticas) {
+    return eliminacaoNucleo(contexto, matrizEstendida, ordemMatriz, 0, 0.0, 1, estatisticas);
+}
 
-        xPerm[linha] = rhs / diag;
+GaussStatus eliminacao_torre_com_tolerancia_contexto(GaussTotalContexto* contexto,
+                                                     double** matrizEstendida, int ordemMatriz,
+                                                     double tolerancia,
+                                                     GaussTorreEstatisticas* estatisticas) {
+    return eliminacaoNucleo(contexto, matrizEstendida, ordemMatriz, 1, tolerancia, 1, estatisticas);
+}
+
+GaussStatus gauss_torre(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                        GaussTorreEstatisticas* estatisticas) {
+    GaussTotalContexto contexto;
+    if (!criarContextoTotal(&contexto, ordemMatriz)) return GAUSS_SINGULAR;
+
+    GaussStatus status = eliminacao_torre_contexto(&contexto, matrizEstendida, ordemMatriz,
+                                                   estatisticas);
+    if (status == GAUSS_OK) {
+        status = substituicaoRegressiva_contexto(&contexto, matrizEstendida,
+                                                 ordemMatriz, vetorSolucao);
     }
+    liberarContextoTotal(&contexto);
+    return status;
+}
 
-    for (int colunaAtual = 0; colunaAtual < ordemMatriz; colunaAtual++) {
-        int colunaOriginal = permColGlobal[colunaAtual];
-        vetorSolucao[colunaOriginal] = xPerm[colunaAtual];
+GaussStatus gauss_torre_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                       double* vetorSolucao, double tolerancia,
+                                       GaussTorreEstatisticas* estatisticas) {
+    GaussTotalContexto contexto;
+    if (!criarContextoTotal(&contexto, ordemMatriz)) return GAUSS_SINGULAR;
+
+    GaussStatus status = eliminacao_torre_com_tolerancia_contexto(&contexto, matrizEstendida,
+                                                                  ordemMatriz, tolerancia,
+                                                                  estatisticas);
+    if (status == GAUSS_OK) {
+        status = substituicaoRegressiva_com_tolerancia_contexto(&contexto, matrizEstendida,
+                                                                ordemMatriz, vetorSolucao,
+                                                                tolerancia);
     }
+    liberarContextoTotal(&contexto);
+    return status;
+}
 
-    free(xPerm);
-    liberarPermutacao();
-    return GAUSS_OK;
+/* ============================================================
+   ELIMINAÇÃO / SUBSTITUIÇÃO — SEM CONTEXTO (compatibilidade)
+   ============================================================ */
+
+GaussStatus eliminacao(double** matrizEstendida, int ordemMatriz) {
+    liberarContextoTotal(&g_contextoLegado);
+    if (!criarContextoTotal(&g_contextoLegado, ordemMatriz)) {
+        return GAUSS_SINGULAR; /* sem enum específico para memória */
+    }
+    GaussStatus status = eliminacao_contexto(&g_contextoLegado, matrizEstendida, ordemMatriz);
+    if (status != GAUSS_OK) liberarContextoTotal(&g_contextoLegado);
+    return status;
+}
+
+GaussStatus eliminacao_com_tolerancia(double** matrizEstendida, int ordemMatriz, double tolerancia) {
+    liberarContextoTotal(&g_contextoLegado);
+    if (!criarContextoTotal(&g_contextoLegado, ordemMatriz)) {
+        return GAUSS_SINGULAR;
+    }
+    GaussStatus status = eliminacao_com_tolerancia_contexto(&g_contextoLegado, matrizEstendida,
+                                                            ordemMatriz, tolerancia);
+    if (status != GAUSS_OK) liberarContextoTotal(&g_contextoLegado);
+    return status;
+}
+
+GaussStatus substituicaoRegressiva(double** matrizEstendida, int ordemMatriz, double* vetorSolucao) {
+    GaussStatus status = substituicaoRegressiva_contexto(&g_contextoLegado, matrizEstendida,
+                                                         ordemMatriz, vetorSolucao);
+    liberarContextoTotal(&g_contextoLegado);
+    return status;
+}
+
+GaussStatus substituicaoRegressiva_com_tolerancia(double** matrizEstendida, int ordemMatriz, double* vetorSolucao, double tolerancia) {
+    GaussStatus status = substituicaoRegressiva_com_tolerancia_contexto(&g_contextoLegado,
+                                                                        matrizEstendida,
+                                                                        ordemMatriz,
+                                                                        vetorSolucao,
+                                                                        tolerancia);
+    liberarContextoTotal(&g_contextoLegado);
+    return status;
 }
 
 /* ============================================================
-   WRAPPERS: GAUSS COMPLETO (TOTAL)
+   WRAPPERS: GAUSS COMPLETO (TOTAL) — contexto local, reentrantes
    ============================================================ */
 
-/**
- * @brief Resolve Ax = b pelo método de Gauss com pivotamento total (sem tolerância).
- *
- * @param matrizEstendida Matriz [A|b] (n × (n+1)).
- * @param ordemMatriz     Ordem da matriz A.
- * @param vetorSolucao    Vetor solução (saída), tamanho n.
- * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
- */
 GaussStatus gauss(double** matrizEstendida, int ordemMatriz, double* vetorSolucao) {
-    GaussStatus status = eliminacao(matrizEstendida, ordemMatriz);
-    if (status != GAUSS_OK) return status;
-    return substituicaoRegressiva(matrizEstendida, ordemMatriz, vetorSolucao);
+    GaussTotalContexto contexto;
+    if (!criarContextoTotal(&contexto, ordemMatriz)) return GAUSS_SINGULAR;
+
+    GaussStatus status = eliminacao_contexto(&contexto, matrizEstendida, ordemMatriz);
+    if (status == GAUSS_OK) {
+        status = substituicaoRegressiva_contexto(&contexto, matrizEstendida,
+                                                 ordemMatriz, vetorSolucao);
+    }
+    liberarContextoTotal(&contexto);
+    return status;
 }
 
-/**
- * @brief Resolve Ax = b pelo método de Gauss com pivotamento total (com tolerância).
- *
- * @param matrizEstendida Matriz [A|b] (n × (n+1)).
- * @param ordemMatriz     Ordem da matriz A.
- * @param vetorSolucao    Vetor solução (saída), tamanho n.
- * @param tolerancia      Valor usado para checar pivôs muito pequenos.
- * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
- */
 GaussStatus gauss_com_tolerancia(double** matrizEstendida, int ordemMatriz, double* vetorSolucao, double tolerancia) {
-    GaussStatus status = eliminacao_com_tolerancia(matrizEstendida, ordemMatriz, tolerancia);
-    if (status != GAUSS_OK) return status;
-    return substituicaoRegressiva_com_tolerancia(matrizEstendida, ordemMatriz, vetorSolucao, tolerancia);
+    GaussTotalContexto contexto;
+    if (!criarContextoTotal(&contexto, ordemMatriz)) return GAUSS_SINGULAR;
+
+    GaussStatus status = eliminacao_com_tolerancia_contexto(&contexto, matrizEstendida,
+                                                            ordemMatriz, tolerancia);
+    if (status == GAUSS_OK) {
+        status = substituicaoRegressiva_com_tolerancia_contexto(&contexto, matrizEstendida,
+                                                                ordemMatriz, vetorSolucao,
+                                                                tolerancia);
+    }
+    liberarContextoTotal(&contexto);
+    return status;
 }
 
 /* ============================================================
@@ -360,3 +569,31 @@ void imprimirStatus(GaussStatus status){
         puts("Status desconhecido.");
     }
 }
+
+/**
+ * @brief Imprime a contagem de buscas do pivotamento torre.
+ *
+ * @param estatisticas Estatísticas preenchidas por gauss_torre*().
+ */
+void imprimirEstatisticasTorre(const GaussTorreEstatisticas* estatisticas) {
+    if (!estatisticas || estatisticas->etapas == 0) {
+        puts("Pivotamento torre: nenhuma etapa.");
+        return;
+    }
+    printf("Pivotamento torre: %d etapas, %ld buscas (média %.2f, máximo %d por etapa)",
+           estatisticas->etapas, estatisticas->totalBuscas,
+           (double) estatisticas->totalBuscas / estatisticas->etapas,
+           estatisticas->maxBuscas);
+    if (estatisticas->recursosBuscaTotal > 0) {
+        printf(", %d com busca total", estatisticas->recursosBuscaTotal);
+    }
+    putchar('\n');
+
+    if (estatisticas->buscasPorEtapa) {
+        printf("Buscas por etapa:");
+        for (int etapa = 0; etapa < estatisticas->etapas; etapa++) {
+            printf(" %d", estatisticas->buscasPorEtapa[etapa]);
+        }
+        putchar('\n');
+    }
+}
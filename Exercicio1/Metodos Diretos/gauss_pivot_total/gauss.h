@@ -1,6 +1,8 @@
 #ifndef GAUSS_H
 #define GAUSS_H
 
+#include <stdint.h>
+
 /**
  * @brief Códigos de retorno das rotinas de Gauss.
  */
@@ -10,10 +12,99 @@ typedef enum {
     GAUSS_INCONSISTENTE = 2/**< Linha ~0 em A e b != 0 → sistema sem solução */
 } GaussStatus;
 
+/* ============================================================
+   CONTEXTO DO PIVOTAMENTO TOTAL
+   ============================================================ */
+
+/**
+ * @brief Estado da permutação lógica de colunas de uma eliminação.
+ *
+ * Pertence ao chamador: cada resolução usa o seu, o que torna as rotinas
+ * *_contexto reentrantes (várias resoluções em paralelo, uma por contexto).
+ */
+typedef struct {
+    int* permColunas;       /**< permColunas[k] = coluna real na posição lógica k */
+    int* posicaoColuna;     /**< inversa: posicaoColuna[real] = posição lógica */
+    uint64_t* mascaraAtiva; /**< por coluna real: ativa (todos os bits) ou eliminada (0) */
+    int ordem;              /**< ordem da matriz para a qual foi criado */
+} GaussTotalContexto;
+
+/**
+ * @brief Aloca um contexto para matrizes de ordem @p ordemMatriz.
+ * @return 1 em caso de sucesso, 0 em falha de alocação.
+ */
+int criarContextoTotal(GaussTotalContexto* contexto, int ordemMatriz);
+
+/**
+ * @brief Volta o contexto à permutação identidade (todas as colunas ativas).
+ */
+void reiniciarContextoTotal(GaussTotalContexto* contexto);
+
+/**
+ * @brief Libera os vetores do contexto (seguro com contexto já liberado).
+ */
+void liberarContextoTotal(GaussTotalContexto* contexto);
+
+/* ============================================================
+   EXECUÇÃO PARALELA (OpenMP)
+   ============================================================ */
+
+/** Número mínimo de linhas restantes para abrir uma região paralela. */
+#ifndef GAUSS_CORTE_PARALELO
+#define GAUSS_CORTE_PARALELO 256
+#endif
+
+/**
+ * @brief Define o número de threads (<= 0 volta ao padrão do OpenMP).
+ */
+void gaussDefinirThreads(int numThreads);
+
+/**
+ * @brief Define o corte (linhas restantes) abaixo do qual tudo roda em série.
+ */
+void gaussDefinirCorteParalelo(int linhasMinimas);
+
+/**
+ * @brief Número de threads efetivamente usado (1 sem OpenMP).
+ */
+int gaussNumThreads(void);
+
 /* ============================================================
    FASE 1: ELIMINAÇÃO COM PIVOTAMENTO TOTAL
    ============================================================ */
 
+/*
+ * As versões sem contexto guardam a permutação num contexto interno entre
+ * eliminacao() e substituicaoRegressiva() e, por isso, NÃO são reentrantes.
+ * Prefira as versões *_contexto (ou gauss/gauss_com_tolerancia, que usam um
+ * contexto local). Em empates de |pivô| vence a menor linha e, nela, a menor
+ * coluna real.
+ */
+
+/**
+ * @brief Eliminação com pivotamento total usando o contexto do chamador (sem tolerância).
+ *
+ * @param contexto        Contexto criado com criarContextoTotal() para a mesma ordem.
+ * @param matrizEstendida Matriz [A|b] de entrada, modificada para [U|c].
+ * @param ordemMatriz     Ordem da matriz.
+ * @return GAUSS_OK ou GAUSS_SINGULAR.
+ */
+GaussStatus eliminacao_contexto(GaussTotalContexto* contexto,
+                                double** matrizEstendida, int ordemMatriz);
+
+/**
+ * @brief Eliminação com pivotamento total usando o contexto do chamador (com tolerância).
+ *
+ * @param contexto        Contexto criado com criarContextoTotal() para a mesma ordem.
+ * @param matrizEstendida Matriz [A|b] de entrada, modificada para [U|c].
+ * @param ordemMatriz     Ordem da matriz.
+ * @param tolerancia      Valor usado para checar pivôs muito pequenos.
+ * @return GAUSS_OK ou GAUSS_SINGULAR.
+ */
+GaussStatus eliminacao_com_tolerancia_contexto(GaussTotalContexto* contexto,
+                                               double** matrizEstendida, int ordemMatriz,
+                                               double tolerancia);
+
 /**
  * @brief Executa a fase de eliminação com pivotamento total (sem tolerância).
  *
@@ -37,6 +128,35 @@ GaussStatus eliminacao_com_tolerancia(double** matrizEstendida, int ordemMatriz,
    FASE 2: SUBSTITUIÇÃO REGRESSIVA
    ============================================================ */
 
+/**
+ * @brief Substituição regressiva com o contexto da eliminação (sem tolerância).
+ *
+ * @param contexto        Contexto usado na eliminação.
+ * @param matrizEstendida Matriz [U|c] após a eliminação.
+ * @param ordemMatriz     Ordem da matriz.
+ * @param vetorSolucao    Vetor solução (saída), na ordem original das incógnitas.
+ * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
+ */
+GaussStatus substituicaoRegressiva_contexto(const GaussTotalContexto* contexto,
+                                            double** matrizEstendida, int ordemMatriz,
+                                            double* vetorSolucao);
+
+/**
+ * @brief Substituição regressiva com o contexto da eliminação (com tolerância).
+ *
+ * @param contexto        Contexto usado na eliminação.
+ * @param matrizEstendida Matriz [U|c] após a eliminação.
+ * @param ordemMatriz     Ordem da matriz.
+ * @param vetorSolucao    Vetor solução (saída), na ordem original das incógnitas.
+ * @param tolerancia      Valor usado para checar pivôs muito pequenos.
+ * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
+ */
+GaussStatus substituicaoRegressiva_com_tolerancia_contexto(const GaussTotalContexto* contexto,
+                                                           double** matrizEstendida,
+                                                           int ordemMatriz,
+                                                           double* vetorSolucao,
+                                                           double tolerancia);
+
 /**
  * @brief Executa a substituição regressiva após a eliminação (sem tolerância).
  *
@@ -83,6 +203,83 @@ GaussStatus gauss(double** matrizEstendida, int ordemMatriz, double* vetorSoluca
  */
 GaussStatus gauss_com_tolerancia(double** matrizEstendida, int ordemMatriz, double* vetorSolucao, double tolerancia);
 
+/* ============================================================
+   PIVOTAMENTO TORRE (ROOK)
+   ============================================================ */
+
+/*
+ * Alternativa mais barata ao pivotamento total: em cada etapa alterna buscas
+ * de máximo em coluna e em linha até achar um elemento que domine ambas.
+ * Cada busca custa O(n) (e não O(n²)), e a estabilidade fica próxima à do
+ * pivotamento total. A solução é devolvida na ordem original das incógnitas
+ * (mesma substituição regressiva do pivotamento total).
+ */
+
+/**
+ * @brief Instrumentação do pivotamento torre (uma busca = uma varredura de linha ou coluna).
+ */
+typedef struct {
+    int* buscasPorEtapa;    /**< (opcional) n-1 posições, preenchidas por etapa; NULL ignora */
+    int etapas;             /**< etapas de eliminação executadas */
+    long totalBuscas;       /**< soma das buscas de todas as etapas */
+    int maxBuscas;          /**< maior número de buscas numa etapa */
+    int recursosBuscaTotal; /**< etapas que recorreram à busca total (linha e coluna iniciais nulas) */
+} GaussTorreEstatisticas;
+
+/**
+ * @brief Eliminação com pivotamento torre usando o contexto do chamador (sem tolerância).
+ *
+ * @param contexto        Contexto criado com criarContextoTotal() para a mesma ordem.
+ * @param matrizEstendida Matriz [A|b] de entrada, modificada para [U|c].
+ * @param ordemMatriz     Ordem da matriz.
+ * @param estatisticas    (opcional) contagem de buscas; NULL ignora.
+ * @return GAUSS_OK ou GAUSS_SINGULAR.
+ */
+GaussStatus eliminacao_torre_contexto(GaussTotalContexto* contexto,
+                                      double** matrizEstendida, int ordemMatriz,
+                                      GaussTorreEstatisticas* estatisticas);
+
+/**
+ * @brief Eliminação com pivotamento torre usando o contexto do chamador (com tolerância).
+ *
+ * @param contexto        Contexto criado com criarContextoTotal() para a mesma ordem.
+ * @param matrizEstendida Matriz [A|b] de entrada, modificada para [U|c].
+ * @param ordemMatriz     Ordem da matriz.
+ * @param tolerancia      Valor usado para checar pivôs muito pequenos.
+ * @param estatisticas    (opcional) contagem de buscas; NULL ignora.
+ * @return GAUSS_OK ou GAUSS_SINGULAR.
+ */
+GaussStatus eliminacao_torre_com_tolerancia_contexto(GaussTotalContexto* contexto,
+                                                     double** matrizEstendida, int ordemMatriz,
+                                                     double tolerancia,
+                                                     GaussTorreEstatisticas* estatisticas);
+
+/**
+ * @brief Resolve Ax = b por Gauss com pivotamento torre (sem tolerância).
+ *
+ * @param matrizEstendida Matriz [A|b] (n × (n+1)).
+ * @param ordemMatriz     Ordem da matriz A.
+ * @param vetorSolucao    Vetor solução (saída), tamanho n.
+ * @param estatisticas    (opcional) contagem de buscas; NULL ignora.
+ * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
+ */
+GaussStatus gauss_torre(double** matrizEstendida, int ordemMatriz, double* vetorSolucao,
+                        GaussTorreEstatisticas* estatisticas);
+
+/**
+ * @brief Resolve Ax = b por Gauss com pivotamento torre (com tolerância).
+ *
+ * @param matrizEstendida Matriz [A|b] (n × (n+1)).
+ * @param ordemMatriz     Ordem da matriz A.
+ * @param vetorSolucao    Vetor solução (saída), tamanho n.
+ * @param tolerancia      Valor usado para checar pivôs muito pequenos.
+ * @param estatisticas    (opcional) contagem de buscas; NULL ignora.
+ * @return GAUSS_OK, GAUSS_SINGULAR ou GAUSS_INCONSISTENTE.
+ */
+GaussStatus gauss_torre_com_tolerancia(double** matrizEstendida, int ordemMatriz,
+                                       double* vetorSolucao, double tolerancia,
+                                       GaussTorreEstatisticas* estatisticas);
+
 /**
  * @brief Imprime em texto o status retornado pelas rotinas.
  *
@@ -90,4 +287,11 @@ GaussStatus gauss_com_tolerancia(double** matrizEstendida, int ordemMatriz, doub
  */
 void imprimirStatus(GaussStatus status);
 
+/**
+ * @brief Imprime a contagem de buscas do pivotamento torre.
+ *
+ * @param estatisticas Estatísticas preenchidas por gauss_torre*().
+ */
+void imprimirEstatisticasTorre(const GaussTorreEstatisticas* estatisticas);
+
 #endif
@@ -0,0 +1,129 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+/**
+ * @file kernels.h
+ * @brief Núcleo vetorizado da atualização de linha usado nas eliminações:
+ *        linha[j] -= multiplicador * linhaPivo[j].
+ *
+ * A implementação (escalar, SSE2, AVX2+FMA ou AVX-512) é escolhida uma única
+ * vez, na partida do programa, conforme o processador (CPUID), e publicada
+ * como um conjunto só: chamadas concorrentes nunca veem níveis misturados. Um único binário
+ * roda em toda a frota e usa o melhor conjunto de instruções disponível.
+ *
+ * As versões com FMA arredondam uma vez por termo (a*b+c exato), portanto podem
+ * diferir da escalar na última casa. Para resultados reprodutíveis entre
+ * máquinas, force o nível escalar com @ref kernelForcarNivel(KERNEL_ESCALAR)
+ * ou com a variável de ambiente `KERNEL_SIMD=escalar`.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Níveis de implementação do núcleo, do mais simples ao mais largo.
+ */
+typedef enum {
+    KERNEL_ESCALAR = 0, /**< Laço escalar portátil (referência). */
+    KERNEL_SSE2    = 1, /**< 2 doubles por instrução. */
+    KERNEL_AVX2    = 2, /**< 4 doubles por instrução, com FMA. */
+    KERNEL_AVX512  = 3  /**< 8 doubles por instrução, com FMA e cauda mascarada. */
+} KernelNivel;
+
+/**
+ * @brief Maior nível suportado pelo processador/sistema atual.
+ */
+KernelNivel kernelNivelDetectado(void);
+
+/**
+ * @brief Nível em uso pelas rotinas (detectado ou forçado).
+ */
+KernelNivel kernelNivelAtivo(void);
+
+/**
+ * @brief Força um nível de implementação.
+ *
+ * Níveis acima do detectado são rebaixados para o detectado. A troca é
+ * atômica (todas as rotinas passam ao novo nível juntas), mas eliminações
+ * já em andamento podem misturar os dois níveis nos resultados: chame-a
+ * antes de iniciá-las.
+ *
+ * @param nivel Nível desejado.
+ * @return Nível efetivamente ativado.
+ */
+KernelNivel kernelForcarNivel(KernelNivel nivel);
+
+/**
+ * @brief Nome legível do nível (ex.: "AVX2+FMA").
+ */
+const char* kernelNome(KernelNivel nivel);
+
+/**
+ * @brief linha[j] -= multiplicador * linhaPivo[j], para j = 0..tamanho-1.
+ *
+ * @param linha         Linha a ser atualizada (não pode sobrepor @p linhaPivo).
+ * @param linhaPivo     Linha do pivô.
+ * @param multiplicador Fator de eliminação.
+ * @param tamanho       Número de elementos (>= 0).
+ */
+void kernelAtualizarLinha(double* linha, const double* linhaPivo,
+                          double multiplicador, int tamanho);
+
+/** Dimensões do ladrilho de @ref kernelMicroAtualizacao. */
+#define KERNEL_MK_LINHAS  4
+#define KERNEL_MK_COLUNAS 8
+
+/**
+ * @brief Micro-kernel da atualização em blocos: C[4][8] -= L[4][kb] * U[kb][8].
+ *
+ * @param linhasC       KERNEL_MK_LINHAS ponteiros para o início do ladrilho em cada linha de C.
+ * @param painelL       L empacotado: painelL[p * KERNEL_MK_LINHAS + i].
+ * @param painelU       U empacotado: painelU[p * KERNEL_MK_COLUNAS + j].
+ * @param larguraPainel kb (número de termos do produto).
+ */
+void kernelMicroAtualizacao(double* const* linhasC, const double* painelL,
+                            const double* painelU, int larguraPainel);
+
+/**
+ * @brief Versão em precisão simples de @ref kernelAtualizarLinha
+ *        (usada pela fatoração em precisão mista).
+ */
+void kernelAtualizarLinhaF(float* linha, const float* linhaPivo,
+                           float multiplicador, int tamanho);
+
+/** Colunas do ladrilho de @ref kernelMicroAtualizacaoF (mesmos 64 bytes por linha da versão double). */
+#define KERNEL_MK_COLUNAS_F 16
+
+/**
+ * @brief Micro-kernel em precisão simples: C[4][16] -= L[4][kb] * U[kb][16].
+ *
+ * Mesmo empacotamento de @ref kernelMicroAtualizacao, com
+ * painelU[p * KERNEL_MK_COLUNAS_F + j].
+ */
+void kernelMicroAtualizacaoF(float* const* linhasC, const float* painelL,
+                             const float* painelU, int larguraPainel);
+
+/** Valor de máscara que mantém o elemento na busca de @ref kernelArgMaxAbs. */
+#define KERNEL_MASCARA_ATIVA UINT64_MAX
+
+/**
+ * @brief Busca o primeiro índice j com o maior |valores[j]| entre os elementos ativos.
+ *
+ * @param valores  Vetor contíguo a inspecionar.
+ * @param mascara  mascara[j] = KERNEL_MASCARA_ATIVA mantém o elemento j, 0 o ignora
+ *                 (NULL considera todos ativos).
+ * @param tamanho  Número de elementos.
+ * @param valorMax Saída: maior |valores[j]| ativo (0.0 se nenhum for > 0).
+ * @return Índice do máximo (o menor, em caso de empate) ou -1 se nenhum |valor| > 0.
+ */
+int kernelArgMaxAbs(const double* valores, const uint64_t* mascara,
+                    int tamanho, double* valorMax);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KERNELS_H */
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <windows.h>   // Para QueryPerformanceCounter
 #include "utils.h"
 #include "gauss.h"
@@ -38,6 +39,30 @@ int main(void) {
 
     printf("\nTempo de execução: %.10f segundos\n", tempoSegundos);
 
+    // ============================================
+    // ETAPA 4b: Mesmo sistema com pivotamento torre (rook) + buscas por etapa
+    // ============================================
+    double** matrizTorre = gerarHilbertAumentada(ordemMatriz);
+    double* solucaoTorre = criarVetorSolucao(ordemMatriz);
+    int* buscasPorEtapa = (int*) malloc(ordemMatriz * sizeof(int));
+    GaussTorreEstatisticas estatisticas = { buscasPorEtapa, 0, 0, 0, 0 };
+
+    QueryPerformanceCounter(&inicio);
+    GaussStatus statusTorre = gauss_torre(matrizTorre, ordemMatriz, solucaoTorre, &estatisticas);
+    QueryPerformanceCounter(&fim);
+    tempoSegundos = (double)(fim.QuadPart - inicio.QuadPart) / freq.QuadPart;
+
+    printf("\n--- Pivotamento torre ---\n");
+    imprimirStatus(statusTorre);
+    if (statusTorre == GAUSS_OK) {
+        calcularErroRelativo(solucaoTorre, ordemMatriz);
+    }
+    imprimirEstatisticasTorre(&estatisticas);
+    printf("Tempo de execução: %.10f segundos\n", tempoSegundos);
+
+    free(buscasPorEtapa);
+    liberar(matrizTorre, ordemMatriz, solucaoTorre);
+
     // ============================================
     // ETAPA 5: Liberar memória
     // ============================================
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "gaussseidel.h"
+#include "esparsa.h"
 
 // ============================================================
 // Método de Gauss-Seidel
@@ -48,6 +49,57 @@ GaussSeidelStatus gaussSeidel(double** matrizEstendida, int ordemMatriz,
     return GS_NAO_CONVERGIU;
 }
 
+// ============================================================
+// Gauss-Seidel esparso (CSR): mesma varredura, só sobre os não nulos
+// ============================================================
+GaussSeidelStatus gaussSeidelEsparso(const MatrizCSR* matrizA, const double* vetorB,
+                                     double* vetorSolucao, double tolerancia, long long int maxIter) {
+    int ordemMatriz = matrizA->nLinhas;
+    const long long* inicioLinha = matrizA->inicioLinha;
+    const int* colunas = matrizA->colunas;
+    const double* valores = matrizA->valores;
+
+    // --- Etapa 1: chute inicial (x^(0) = b_i / a_ii) ---
+    for (int i = 0; i < ordemMatriz; i++) {
+        double aii = csrDiagonal(matrizA, i);
+        if (fabs(aii) < tolerancia) {
+            return GS_SINGULAR; // pivô inválido
+        }
+        vetorSolucao[i] = vetorB[i] / aii;
+    }
+
+    // --- Etapa 2: iterações de Gauss-Seidel ---
+    for (long long int k = 0; k < maxIter; k++) {
+        double normaInf = 0.0;
+
+        for (int i = 0; i < ordemMatriz; i++) {
+            double soma = vetorB[i];
+            double aii = 0.0;
+
+            // colunas em ordem crescente: x[j] já atualizado se j < i
+            for (long long p = inicioLinha[i]; p < inicioLinha[i + 1]; p++) {
+                int j = colunas[p];
+                if (j == i) { aii = valores[p]; continue; }
+                soma -= valores[p] * vetorSolucao[j];
+            }
+
+            double novoXi = soma / aii;
+
+            double diff = fabs(novoXi - vetorSolucao[i]);
+            if (diff > normaInf) normaInf = diff;
+
+            vetorSolucao[i] = novoXi;
+        }
+
+        if (normaInf < tolerancia) {
+            printf("%lld interacoes\n",k );
+            return GS_OK;
+        }
+    }
+
+    return GS_NAO_CONVERGIU;
+}
+
 // ============================================================
 // Impressão do status
 // ============================================================
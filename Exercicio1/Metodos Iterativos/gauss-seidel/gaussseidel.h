@@ -1,6 +1,8 @@
 #ifndef GAUSS_SEIDEL_H
 #define GAUSS_SEIDEL_H
 
+#include "esparsa.h"
+
 /**
  * @brief Códigos de retorno para o método de Gauss-Seidel.
  */
@@ -23,6 +25,20 @@ typedef enum {
 GaussSeidelStatus gaussSeidel(double** matrizEstendida, int ordemMatriz,
                               double* vetorSolucao, double tolerancia, long long int maxIter);
 
+/**
+ * @brief Gauss-Seidel com A em CSR (@ref MatrizCSR): mesma varredura,
+ *        critério de parada e status de @ref gaussSeidel, com O(nnz) por iteração.
+ *
+ * @param matrizA      A (n × n) em CSR.
+ * @param vetorB       b (n).
+ * @param vetorSolucao Vetor solução (saída), tamanho n.
+ * @param tolerancia   Critério de parada relativo (norma do erro).
+ * @param maxIter      Número máximo de iterações.
+ * @return GS_OK, GS_SINGULAR ou GS_NAO_CONVERGIU.
+ */
+GaussSeidelStatus gaussSeidelEsparso(const MatrizCSR* matrizA, const double* vetorB,
+                                     double* vetorSolucao, double tolerancia, long long int maxIter);
+
 /**
  * @brief Imprime em texto o status retornado pelo Gauss-Seidel.
  *
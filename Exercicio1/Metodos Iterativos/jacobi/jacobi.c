@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "jacobi.h"
+#include "esparsa.h"
 
 #ifndef REL_EPS_MIN
 #define REL_EPS_MIN 1e-30  // evita divisão por zero na razão relativa
@@ -90,6 +91,72 @@ JacobiStatus jacobi(double** matrizEstendida, int ordemMatriz,
     return JACOBI_NAO_CONVERGIU;
 }
 
+// ============================================================
+// JACOBI esparso (CSR) — mesmas etapas e critério de parada;
+// cada varredura custa O(nnz) em vez de O(n²)
+// ============================================================
+JacobiStatus jacobiEsparso(const MatrizCSR* matrizA, const double* vetorB,
+                           double* vetorSolucao, double tolerancia, long long int maxIter) {
+    int ordemMatriz = matrizA->nLinhas;
+    const long long* inicioLinha = matrizA->inicioLinha;
+    const int* colunas = matrizA->colunas;
+    const double* valores = matrizA->valores;
+
+    // --- Etapa 1: alocar vetores de trabalho ---
+    double* xAtual   = (double*) malloc(ordemMatriz * sizeof(double));
+    double* xProximo = (double*) malloc(ordemMatriz * sizeof(double));
+    if (!xAtual || !xProximo) {
+        free(xAtual); free(xProximo);
+        return JACOBI_SINGULAR;
+    }
+
+    // --- Etapa 2: chute inicial x^(0) = b_i / a_ii ---
+    double normaAnt = 0.0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        xAtual[i] = vetorB[i] / csrDiagonal(matrizA, i);
+        double a = fabs(xAtual[i]);
+        if (a > normaAnt) normaAnt = a;
+    }
+
+    // --- Etapa 3: iterações, só sobre os não nulos de cada linha ---
+    for (long long int k = 1; k <= maxIter; k++) {
+        double normaAtual = 0.0;
+        for (int i = 0; i < ordemMatriz; i++) {
+            double soma = vetorB[i];
+            double aii = 0.0;
+            for (long long p = inicioLinha[i]; p < inicioLinha[i + 1]; p++) {
+                int j = colunas[p];
+                if (j == i) { aii = valores[p]; continue; }
+                soma -= valores[p] * xAtual[j];
+            }
+            xProximo[i] = soma / aii;
+            double a = fabs(xProximo[i]);
+            if (a > normaAtual) normaAtual = a;
+        }
+
+        double denom = fmax(fmax(normaAtual, normaAnt), REL_EPS_MIN);
+        double rel_err = fabs(normaAtual - normaAnt) / denom;
+
+        if (rel_err < tolerancia) {
+            for (int i = 0; i < ordemMatriz; i++) vetorSolucao[i] = xProximo[i];
+            free(xAtual); free(xProximo);
+            printf("%lld iteracores \n",k);
+            return JACOBI_OK;
+        }
+
+        // troca os papéis dos vetores em vez de copiar
+        double* temporario = xAtual;
+        xAtual = xProximo;
+        xProximo = temporario;
+        normaAnt = normaAtual;
+    }
+
+    // --- Etapa 4: não convergiu em maxIter; devolve último x aproximado ---
+    for (int i = 0; i < ordemMatriz; i++) vetorSolucao[i] = xAtual[i];
+    free(xAtual); free(xProximo);
+    return JACOBI_NAO_CONVERGIU;
+}
+
 // ============================================================
 // Utilitário: imprimir status do Jacobi
 // ============================================================
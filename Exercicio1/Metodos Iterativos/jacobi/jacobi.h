@@ -1,6 +1,8 @@
 #ifndef JACOBI_H
 #define JACOBI_H
 
+#include "esparsa.h"
+
 /**
  * @brief Códigos de retorno do método de Jacobi.
  */
@@ -29,6 +31,20 @@ typedef enum {
 JacobiStatus jacobi(double** matrizEstendida, int ordemMatriz,
                     double* vetorSolucao, double tolerancia, long long int maxIter);
 
+/**
+ * @brief Jacobi com A em CSR (@ref MatrizCSR): mesma fórmula, chute inicial,
+ *        critério de parada e status de @ref jacobi, com O(nnz) por iteração.
+ *
+ * @param matrizA      A (n × n) em CSR.
+ * @param vetorB       b (n).
+ * @param vetorSolucao Vetor solução (saída), tamanho n.
+ * @param tolerancia   Tolerância para o critério de parada.
+ * @param maxIter      Número máximo de iterações.
+ * @return JACOBI_OK, JACOBI_SINGULAR ou JACOBI_NAO_CONVERGIU.
+ */
+JacobiStatus jacobiEsparso(const MatrizCSR* matrizA, const double* vetorB,
+                           double* vetorSolucao, double tolerancia, long long int maxIter);
+
 /**
  * @brief Imprime em texto o status retornado pelo método de Jacobi.
  *
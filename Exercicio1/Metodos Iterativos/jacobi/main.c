@@ -1,15 +1,32 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <windows.h>   // para QueryPerformanceCounter
 #include "utils.h"
 #include "jacobi.h"
+#include "leitura.h"
+#include "esparsa.h"
 #include <limits.h>  // para LLONG_MAX
 
-int main(void) {
+int main(int argc, char** argv) {
     // ============================================
     // ETAPA 1: Ler sistema do arquivo
+    // entrada.txt ou MatrixMarket (leitura.h), direto em CSR (esparsa.h);
+    // sem argumento, Hilbert densa
     // ============================================
     int ordemMatriz=2;
-    double** matrizExtendida = gerarHilbertAumentada(ordemMatriz);
+    double** matrizExtendida = NULL;
+    MatrizCSR* matrizA = NULL;   // com arquivo: A em CSR (O(nnz) por iteração)
+    double* vetorB = NULL;
+    if (argc > 1) {
+        LeituraStatus statusLeitura = lerSistemaCSR(argv[1], &matrizA, &vetorB);
+        if (statusLeitura != LEITURA_OK) {
+            fprintf(stderr, "%s: %s\n", argv[1], leituraMensagem(statusLeitura));
+            return 1;
+        }
+        ordemMatriz = matrizA->nLinhas;
+    } else {
+        matrizExtendida = gerarHilbertAumentada(ordemMatriz);
+    }
 
     // ============================================
     // ETAPA 2: Preparar vetor solução
@@ -29,8 +46,9 @@ int main(void) {
     QueryPerformanceFrequency(&freq);
     QueryPerformanceCounter(&inicio);
 
-    JacobiStatus status = jacobi(matrizExtendida, ordemMatriz,
-                                 vetorSolucao, tolerancia, maxIter);
+    JacobiStatus status = matrizA
+        ? jacobiEsparso(matrizA, vetorB, vetorSolucao, tolerancia, maxIter)
+        : jacobi(matrizExtendida, ordemMatriz, vetorSolucao, tolerancia, maxIter);
 
     QueryPerformanceCounter(&fim);
     double tempoSegundos = (double)(fim.QuadPart - inicio.QuadPart) / (double)freq.QuadPart;
@@ -41,7 +59,7 @@ int main(void) {
     imprimirStatusJacobi(status);
     if (status == JACOBI_OK) {
         imprimirSolucao(vetorSolucao, ordemMatriz);
-        calcularErroRelativo(vetorSolucao, ordemMatriz);
+        if (argc <= 1) calcularErroRelativo(vetorSolucao, ordemMatriz);  // solução exata só na Hilbert
     }
 
     printf("\nTempo de execução: %.10f segundos\n", tempoSegundos);
@@ -49,7 +67,13 @@ int main(void) {
     // ============================================
     // ETAPA 6: Liberar memória
     // ============================================
-    liberar(matrizExtendida, ordemMatriz, vetorSolucao);
+    if (matrizA) {
+        destruirMatrizCSR(matrizA);
+        free(vetorB);
+        liberarVetorSolucao(vetorSolucao);
+    } else {
+        liberar(matrizExtendida, ordemMatriz, vetorSolucao);
+    }
 
     // ============================================
     // ETAPA 7: Encerrar com código de status
@@ -0,0 +1,90 @@
+#ifndef ESPARSA_H
+#define ESPARSA_H
+
+/**
+ * @file esparsa.h
+ * @brief Matriz esparsa no formato CSR (*compressed sparse row*) para os
+ *        métodos iterativos.
+ *
+ * Os métodos densos percorrem as n colunas de cada linha a cada varredura:
+ * n² operações, mesmo quando a linha tem 5 não nulos (Poisson 2-D com 5
+ * pontos). No CSR, cada linha guarda só os seus não nulos, e uma varredura
+ * custa O(nnz): com n = 10⁶, 5·10⁶ operações em vez de 10¹².
+ *
+ * Os não nulos da linha i ficam em `inicioLinha[i] .. inicioLinha[i+1]-1`,
+ * com as colunas em ordem crescente e sem repetições. Nessa ordem, as
+ * versões esparsas somam os mesmos termos que as densas (os zeros não
+ * alteram a soma) e dão os mesmos resultados.
+ */
+
+#include "leitura.h"
+
+/**
+ * @brief Matriz esparsa nLinhas × nColunas em CSR.
+ */
+typedef struct {
+    int        nLinhas;
+    int        nColunas;
+    long long  nnz;          /**< Número de não nulos armazenados. */
+    long long* inicioLinha;  /**< nLinhas + 1 posições; inicioLinha[nLinhas] = nnz. */
+    int*       colunas;      /**< Coluna de cada não nulo (crescente dentro da linha). */
+    double*    valores;      /**< Valor de cada não nulo. */
+} MatrizCSR;
+
+/**
+ * @brief Monta A em CSR a partir da matriz estendida densa [A|b].
+ *
+ * Só os elementos a_ij != 0 são guardados.
+ *
+ * @param matrizEstendida [A|b] (n × (n+1)); não é alterada.
+ * @param ordemMatriz     Ordem n.
+ * @param vetorB          Saída opcional (NULL): recebe b (n).
+ * @return Matriz (libere com @ref destruirMatrizCSR) ou NULL em falha de alocação.
+ */
+MatrizCSR* csrDeSistema(double** matrizEstendida, int ordemMatriz, double* vetorB);
+
+/**
+ * @brief Monta uma matriz CSR a partir de triplas (i, j, valor).
+ *
+ * As triplas podem vir em qualquer ordem; entradas repetidas são somadas
+ * (como em @ref lerSistema).
+ *
+ * @return Matriz nLinhas × nColunas ou NULL em falha de alocação.
+ */
+MatrizCSR* csrDeTriplas(const Triplas* triplas);
+
+/**
+ * @brief Lê um sistema A x = b direto em CSR, sem montar a matriz densa.
+ *
+ * Aceita os mesmos arquivos de @ref lerSistema, com as mesmas regras:
+ * MatrixMarket n × (n+1) é [A|b]; n × n é A, e b recebe a soma de cada
+ * linha (solução exata (1,...,1)). Arquivos no formato de `entrada.txt`
+ * são densos por natureza: são lidos por @ref lerSistema e comprimidos.
+ *
+ * @param caminho     Arquivo de entrada.
+ * @param matrizA     Saída: A (n × n) em CSR.
+ * @param vetorB      Saída: b (n), alocado com malloc (libere com free).
+ * @return LEITURA_OK ou o motivo da falha (as saídas ficam NULL).
+ */
+LeituraStatus lerSistemaCSR(const char* caminho, MatrizCSR** matrizA, double** vetorB);
+
+/**
+ * @brief Elemento a_ii (0 se a linha não guarda a diagonal).
+ */
+double csrDiagonal(const MatrizCSR* matrizA, int linha);
+
+/**
+ * @brief y = A·x.
+ *
+ * @param matrizA CSR nLinhas × nColunas.
+ * @param vetorX  nColunas valores.
+ * @param vetorY  Saída: nLinhas valores (não pode ser @p vetorX).
+ */
+void csrMultiplicar(const MatrizCSR* matrizA, const double* vetorX, double* vetorY);
+
+/**
+ * @brief Libera a matriz (NULL é ignorado).
+ */
+void destruirMatrizCSR(MatrizCSR* matrizA);
+
+#endif /* ESPARSA_H */
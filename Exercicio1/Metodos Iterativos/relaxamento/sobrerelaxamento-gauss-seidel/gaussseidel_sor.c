@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "gaussseidel_sor.h"
+#include "esparsa.h"
 
 #ifndef REL_EPS_MIN
 #define REL_EPS_MIN 1e-30  // evita divisão por zero no cálculo de erro relativo
@@ -84,6 +85,73 @@ GaussSeidelSORStatus gaussSeidelSOR(double** matrizEstendida, int ordemMatriz,
     return SOR_NAO_CONVERGIU;
 }
 
+// ============================================================
+// SOR esparso (CSR): mesmas etapas, só sobre os não nulos
+// ============================================================
+GaussSeidelSORStatus gaussSeidelSOREsparso(const MatrizCSR* matrizA, const double* vetorB,
+                                           double* vetorSolucao, double omega,
+                                           double tolerancia, long long int maxIter) {
+    int ordemMatriz = matrizA->nLinhas;
+    const long long* inicioLinha = matrizA->inicioLinha;
+    const int* colunas = matrizA->colunas;
+    const double* valores = matrizA->valores;
+
+    // --- Etapa 0: validar parâmetros ---
+    if (!(omega > 0.0 && omega < 2.0)) {
+        return SOR_PARAM_INVALIDO;
+    }
+
+    // --- Etapa 1: chute inicial x^(0) = b_i / a_ii (e checagem da diagonal) ---
+    double normaAnt = 0.0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        double aii = csrDiagonal(matrizA, i);
+        if (fabs(aii) < tolerancia) {
+            return SOR_SINGULAR; // pivô inválido
+        }
+        vetorSolucao[i] = vetorB[i] / aii;
+        double a = fabs(vetorSolucao[i]);
+        if (a > normaAnt) normaAnt = a;
+    }
+
+    // --- Etapa 2: iterações SOR ---
+    for (long long int k = 1; k <= maxIter; k++) {
+        double normaAtual = 0.0;
+        for (int i = 0; i < ordemMatriz; i++) {
+            double soma = vetorB[i];
+            double aii = 0.0;
+
+            // colunas em ordem crescente: x_j já atualizado se j < i
+            for (long long p = inicioLinha[i]; p < inicioLinha[i + 1]; p++) {
+                int j = colunas[p];
+                if (j == i) { aii = valores[p]; continue; }
+                soma -= valores[p] * vetorSolucao[j];
+            }
+
+            double x_gs = soma / aii;
+            vetorSolucao[i] = (1.0 - omega) * vetorSolucao[i] + omega * x_gs;
+
+            double a = fabs(vetorSolucao[i]);
+            if (a > normaAtual) normaAtual = a;
+        }
+
+        double denom = fmax(fmax(normaAtual, normaAnt), REL_EPS_MIN);
+        double rel_err = fabs(normaAtual - normaAnt) / denom;
+
+        if (rel_err < tolerancia) {
+            printf("%lld interacoes\n",k-1 );
+            return SOR_OK;
+        }
+
+        normaAnt = normaAtual;
+
+        if (normaAtual > 1e12) {
+            return SOR_NAO_CONVERGIU;
+        }
+    }
+
+    return SOR_NAO_CONVERGIU;
+}
+
 // ============================================================
 // Impressão do status
 // ============================================================
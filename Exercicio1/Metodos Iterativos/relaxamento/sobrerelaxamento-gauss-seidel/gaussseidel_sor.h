@@ -1,6 +1,8 @@
 #ifndef GAUSS_SEIDEL_SOR_H
 #define GAUSS_SEIDEL_SOR_H
 
+#include "esparsa.h"
+
 /**
  * @brief Códigos de retorno para o método Gauss-Seidel com Sobre-Relaxamento (SOR).
  */
@@ -34,6 +36,22 @@ GaussSeidelSORStatus gaussSeidelSOR(double** matrizEstendida, int ordemMatriz,
                                     double* vetorSolucao, double omega,
                                     double tolerancia, long long int maxIter);
 
+/**
+ * @brief SOR com A em CSR (@ref MatrizCSR): mesma atualização, critério de
+ *        parada e status de @ref gaussSeidelSOR, com O(nnz) por iteração.
+ *
+ * @param matrizA      A (n × n) em CSR.
+ * @param vetorB       b (n).
+ * @param vetorSolucao Vetor solução (saída), tamanho n.
+ * @param omega        Fator de relaxamento, 0 < omega < 2.
+ * @param tolerancia   Tolerância para critério de parada relativo.
+ * @param maxIter      Número máximo de iterações.
+ * @return SOR_OK, SOR_SINGULAR, SOR_NAO_CONVERGIU ou SOR_PARAM_INVALIDO.
+ */
+GaussSeidelSORStatus gaussSeidelSOREsparso(const MatrizCSR* matrizA, const double* vetorB,
+                                           double* vetorSolucao, double omega,
+                                           double tolerancia, long long int maxIter);
+
 /**
  * @brief Imprime em texto o status retornado pelo SOR.
  *
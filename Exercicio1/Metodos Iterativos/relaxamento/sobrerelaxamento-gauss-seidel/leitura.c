@@ -0,0 +1,687 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L  /* mmap, fstat */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <math.h>
+#include "leitura.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#define LEITURA_PRAGMA(x) _Pragma(#x)
+#else
+#define LEITURA_PRAGMA(x)
+#endif
+
+// ============================================================
+// ARQUIVO MAPEADO (somente leitura)
+// ============================================================
+typedef struct {
+    const char* dados;
+    size_t      tamanho;
+#ifdef _WIN32
+    HANDLE      arquivo;
+    HANDLE      mapeamento;
+#endif
+} Arquivo;
+
+static LeituraStatus mapearArquivo(Arquivo* arquivo, const char* caminho) {
+    memset(arquivo, 0, sizeof(*arquivo));
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(caminho, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return LEITURA_ERRO_ES;
+    LARGE_INTEGER tamanho;
+    if (!GetFileSizeEx(handle, &tamanho) || tamanho.QuadPart == 0) {
+        CloseHandle(handle);
+        return LEITURA_ERRO_ES;
+    }
+    HANDLE mapeamento = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    const char* dados = mapeamento ? (const char*) MapViewOfFile(mapeamento, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!dados) {
+        if (mapeamento) CloseHandle(mapeamento);
+        CloseHandle(handle);
+        return LEITURA_ERRO_ES;
+    }
+    arquivo->arquivo = handle;
+    arquivo->mapeamento = mapeamento;
+    arquivo->dados = dados;
+    arquivo->tamanho = (size_t) tamanho.QuadPart;
+#else
+    int descritor = open(caminho, O_RDONLY);
+    if (descritor < 0) return LEITURA_ERRO_ES;
+    struct stat info;
+    if (fstat(descritor, &info) != 0 || info.st_size == 0) {
+        close(descritor);
+        return LEITURA_ERRO_ES;
+    }
+    void* dados = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, descritor, 0);
+    close(descritor); /* o mapeamento continua válido */
+    if (dados == MAP_FAILED) return LEITURA_ERRO_ES;
+    arquivo->dados = (const char*) dados;
+    arquivo->tamanho = (size_t) info.st_size;
+#endif
+    return LEITURA_OK;
+}
+
+static void desmapearArquivo(Arquivo* arquivo) {
+    if (!arquivo->dados) return;
+#ifdef _WIN32
+    UnmapViewOfFile(arquivo->dados);
+    CloseHandle(arquivo->mapeamento);
+    CloseHandle(arquivo->arquivo);
+#else
+    munmap((void*) arquivo->dados, arquivo->tamanho);
+#endif
+    memset(arquivo, 0, sizeof(*arquivo));
+}
+
+// ============================================================
+// CONVERSÃO DE NÚMEROS
+//   Caminho rápido (Clinger): mantissa <= 2^53 e |expoente| <= 22
+//   são exatos em double, então m * 10^e (ou m / 10^-e) é o double
+//   mais próximo, como em strtod. Mantissas de até 19 dígitos (o
+//   "%.17g" de costume) usam m = mh + ml e produtos exatos de Dekker;
+//   só os casos a um fio do meio entre dois doubles, os expoentes
+//   grandes, inf e nan vão para strtod.
+// ============================================================
+static const double POTENCIAS_DE_10[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* Espaço, quebras de linha, tabulações e demais caracteres de controle separam números */
+static inline int ehEspaco(char c) {
+    return (unsigned char) c <= ' ';
+}
+
+/*
+ * a * b = produto + erro, exatamente. Com FMA no alvo usa fma (o compilador
+ * poderia contrair as contas de Dekker em FMA e estragar a exatidão); sem,
+ * Dekker/Veltkamp.
+ */
+static double produtoExato(double a, double b, double* erro) {
+    double produto = a * b;
+#ifdef FP_FAST_FMA
+    *erro = fma(a, b, -produto);
+#else
+    const double divisor = 134217729.0; /* 2^27 + 1 */
+    double ta = divisor * a, tb = divisor * b;
+    double aAlto = ta - (ta - a), aBaixo = a - aAlto;
+    double bAlto = tb - (tb - b), bBaixo = b - bAlto;
+    *erro = ((aAlto * bAlto - produto) + aAlto * bBaixo + aBaixo * bAlto) + aBaixo * bBaixo;
+#endif
+    return produto;
+}
+
+/*
+ * m · 10^e (|e| <= 22, m < 2^64) como principal + correcao, com erro de no
+ * máximo |correcao| · 2^-50. Arredonda se o resultado não estiver perto de um
+ * ponto médio entre dois doubles; 0 se estiver (quem chama usa strtod).
+ */
+static int escalarMantissa(uint64_t mantissa, int expoente, double* valor) {
+    double alto = (double) mantissa;
+    /* mantissa - alto é exata: cabe em 11 bits (em módulo) */
+    double baixo = (alto >= 18446744073709551616.0)
+                 ? -(double)(UINT64_MAX - mantissa) - 1.0
+                 : (double)(int64_t)(mantissa - (uint64_t) alto);
+    double potencia = POTENCIAS_DE_10[expoente < 0 ? -expoente : expoente];
+    double principal, correcao;
+    if (expoente >= 0) {
+        double erroAlto, erroBaixo;
+        principal = produtoExato(alto, potencia, &erroAlto);
+        double baixoEscalado = produtoExato(baixo, potencia, &erroBaixo);
+        correcao = (erroAlto + baixoEscalado) + erroBaixo;
+    } else {
+        double erro;
+        principal = alto / potencia;
+        double produto = produtoExato(principal, potencia, &erro);
+        double resto = (alto - produto) - erro; /* exato */
+        correcao = (resto + baixo) / potencia;
+    }
+
+    double resultado = principal + correcao;
+    double cauda = (principal - resultado) + correcao; /* principal + correcao = resultado + cauda */
+    // meio ulp do resultado (normal: |m · 10^e| >= 1e-22), direto dos bits
+    uint64_t bits, bitsMeioUlp;
+    memcpy(&bits, &resultado, sizeof(bits));
+    uint64_t expoenteBinario = (bits >> 52) & 0x7ff;
+    bitsMeioUlp = (expoenteBinario - 53) << 52;
+    double meioUlp;
+    memcpy(&meioUlp, &bitsMeioUlp, sizeof(meioUlp));
+    double margem = fabs(correcao) * 0x1p-50;
+    // perto de um ponto médio, ou potência de 2 (ulp diferente abaixo): strtod decide
+    if (fabs(cauda) + margem >= meioUlp || (bits & 0xfffffffffffffull) == 0) return 0;
+    *valor = resultado;
+    return 1;
+}
+
+/* Converte o token [inicio, fim) inteiro; 0 se não for um número */
+static int converterToken(const char* inicio, const char* fim, double* valor) {
+    const char* p = inicio;
+    int negativo = 0;
+    if (p < fim && (*p == '+' || *p == '-')) negativo = (*p++ == '-');
+
+    uint64_t mantissa = 0;
+    int digitos = 0, expoente = 0, algumDigito = 0, excedeu = 0;
+    for (int fracao = 0; fracao < 2; fracao++) {
+        for (; p < fim && *p >= '0' && *p <= '9'; p++) {
+            int digito = *p - '0';
+            algumDigito = 1;
+            if (mantissa != 0 || digito != 0) {
+                if (digitos == 19) {
+                    excedeu = 1;
+                    continue;
+                }
+                mantissa = mantissa * 10 + (uint64_t) digito;
+                digitos++;
+            }
+            expoente -= fracao;
+        }
+        if (fracao == 0) {
+            if (p < fim && *p == '.') p++;
+            else break;
+        }
+    }
+    if (algumDigito && p < fim && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        int sinal = 1, valorExpoente = 0, digitosExpoente = 0;
+        if (q < fim && (*q == '+' || *q == '-')) sinal = (*q++ == '-') ? -1 : 1;
+        for (; q < fim && *q >= '0' && *q <= '9'; q++, digitosExpoente++) {
+            if (valorExpoente < 100000) valorExpoente = valorExpoente * 10 + (*q - '0');
+        }
+        if (digitosExpoente > 0) {
+            expoente += sinal * valorExpoente;
+            p = q;
+        }
+    }
+
+    if (algumDigito && p == fim && !excedeu && expoente >= -22 && expoente <= 22) {
+        double resultado;
+        if (mantissa <= (UINT64_C(1) << 53)) {
+            resultado = (double) mantissa;
+            resultado = (expoente < 0) ? resultado / POTENCIAS_DE_10[-expoente]
+                                       : resultado * POTENCIAS_DE_10[expoente];
+            *valor = negativo ? -resultado : resultado;
+            return 1;
+        }
+        if (escalarMantissa(mantissa, expoente, &resultado)) {
+            *valor = negativo ? -resultado : resultado;
+            return 1;
+        }
+    }
+
+    // caminho lento: dígitos demais, expoente grande, inf, nan ou lixo
+    char copia[128];
+    size_t tamanho = (size_t)(fim - inicio);
+    if (tamanho >= sizeof(copia)) return 0;
+    memcpy(copia, inicio, tamanho);
+    copia[tamanho] = '\0';
+    char* fimConvertido;
+    *valor = strtod(copia, &fimConvertido);
+    return fimConvertido == copia + tamanho;
+}
+
+/* Próximo token a partir de *p: devolve o início e avança *p até o fim dele (NULL se acabou) */
+static const char* proximoToken(const char** p, const char* fim) {
+    const char* q = *p;
+    while (q < fim && ehEspaco(*q)) q++;
+    if (q >= fim) {
+        *p = fim;
+        return NULL;
+    }
+    const char* inicio = q;
+    while (q < fim && !ehEspaco(*q)) q++;
+    *p = q;
+    return inicio;
+}
+
+/* Lê um inteiro em [minimo, maximo] */
+static int lerInteiro(const char** p, const char* fim, long long minimo, long long maximo,
+                      long long* valor) {
+    const char* token = proximoToken(p, fim);
+    double numero;
+    if (!token || !converterToken(token, *p, &numero)) return 0;
+    if (!(numero >= (double) minimo && numero <= (double) maximo) || numero != (double)(long long) numero) return 0;
+    *valor = (long long) numero;
+    return 1;
+}
+
+static size_t contarNumeros(const char* p, const char* fim) {
+    size_t total = 0;
+    int dentro = 0;
+    for (; p < fim; p++) {
+        int espaco = ehEspaco(*p);
+        total += (!espaco && !dentro);
+        dentro = !espaco;
+    }
+    return total;
+}
+
+/*
+ * Converte os números de [p, fim) a partir da posição lógica @p primeiro;
+ * a posição k vai para destino[(k / largura) * passo + k % largura].
+ * 0 se algum token for inválido ou se houver mais de @p limite.
+ */
+static int converterNumeros(const char* p, const char* fim, double* destino,
+                            size_t primeiro, size_t limite, int largura, int passo,
+                            size_t* convertidos) {
+    size_t k = primeiro;
+    size_t linha = primeiro / (size_t) largura;
+    int coluna = (int)(primeiro % (size_t) largura);
+    const char* token;
+    while ((token = proximoToken(&p, fim)) != NULL) {
+        if (k >= limite) return 0;
+        if (!converterToken(token, p, &destino[linha * (size_t) passo + (size_t) coluna])) return 0;
+        k++;
+        if (++coluna == largura) {
+            coluna = 0;
+            linha++;
+        }
+    }
+    *convertidos = k - primeiro;
+    return 1;
+}
+
+/*
+ * Converte exatamente @p quantidade números de [inicio, fim) (layout de
+ * converterNumeros). Texto grande: pedaços cortados em espaços, contados e
+ * convertidos em paralelo.
+ */
+static LeituraStatus converterTexto(const char* inicio, const char* fim, double* destino,
+                                    size_t quantidade, int largura, int passo) {
+    int pedacos = 1;
+#ifdef _OPENMP
+    if ((size_t)(fim - inicio) >= LEITURA_CORTE_PARALELO) pedacos = omp_get_max_threads();
+#endif
+    if (pedacos <= 1) {
+        size_t convertidos;
+        if (!converterNumeros(inicio, fim, destino, 0, quantidade, largura, passo, &convertidos) ||
+            convertidos != quantidade) {
+            return LEITURA_FORMATO;
+        }
+        return LEITURA_OK;
+    }
+
+    const char** cortes = (const char**) malloc((size_t)(pedacos + 1) * sizeof(const char*));
+    size_t* primeiros = (size_t*) malloc((size_t)(pedacos + 1) * sizeof(size_t));
+    if (!cortes || !primeiros) {
+        free(cortes);
+        free(primeiros);
+        return LEITURA_MEMORIA;
+    }
+
+    // (1) cortes em espaços, para nenhum número ficar dividido
+    cortes[0] = inicio;
+    cortes[pedacos] = fim;
+    for (int pedaco = 1; pedaco < pedacos; pedaco++) {
+        const char* corte = inicio + (size_t)(fim - inicio) / (size_t) pedacos * (size_t) pedaco;
+        if (corte < cortes[pedaco - 1]) corte = cortes[pedaco - 1];
+        while (corte < fim && !ehEspaco(*corte)) corte++;
+        cortes[pedaco] = corte;
+    }
+
+    // (2) contagem por pedaço e posição inicial de cada um
+    primeiros[0] = 0;
+    LEITURA_PRAGMA(omp parallel for schedule(static, 1) num_threads(pedacos))
+    for (int pedaco = 0; pedaco < pedacos; pedaco++) {
+        primeiros[pedaco + 1] = contarNumeros(cortes[pedaco], cortes[pedaco + 1]);
+    }
+    for (int pedaco = 0; pedaco < pedacos; pedaco++) primeiros[pedaco + 1] += primeiros[pedaco];
+
+    // (3) conversão direto para a posição final
+    LeituraStatus status = LEITURA_FORMATO;
+    if (primeiros[pedacos] == quantidade) {
+        int valido = 1;
+        LEITURA_PRAGMA(omp parallel for schedule(static, 1) num_threads(pedacos) reduction(&&:valido))
+        for (int pedaco = 0; pedaco < pedacos; pedaco++) {
+            size_t convertidos;
+            valido = converterNumeros(cortes[pedaco], cortes[pedaco + 1], destino, primeiros[pedaco],
+                                      primeiros[pedaco + 1], largura, passo, &convertidos) && valido;
+        }
+        if (valido) status = LEITURA_OK;
+    }
+
+    free(cortes);
+    free(primeiros);
+    return status;
+}
+
+// ============================================================
+// FORMATO entrada.txt: n, seguido de n·(n+1) valores
+// ============================================================
+static LeituraStatus lerSistemaEntrada(const Arquivo* arquivo, double*** sistema, int* ordemMatriz) {
+    const char* p = arquivo->dados;
+    const char* fim = arquivo->dados + arquivo->tamanho;
+    long long ordem;
+    if (!lerInteiro(&p, fim, 1, INT_MAX - 1, &ordem)) return LEITURA_FORMATO;
+
+    Matriz* matriz = criarMatriz((int) ordem, (int) ordem + 1);
+    if (!matriz) return LEITURA_MEMORIA;
+
+    LeituraStatus status = converterTexto(p, fim, matriz->dados, (size_t) ordem * (size_t)(ordem + 1),
+                                          (int) ordem + 1, matriz->passo);
+    if (status != LEITURA_OK) {
+        destruirMatriz(matriz);
+        return status;
+    }
+    *sistema = matriz->linhas;
+    *ordemMatriz = (int) ordem;
+    return LEITURA_OK;
+}
+
+// ============================================================
+// FORMATO MatrixMarket
+//   %%MatrixMarket matrix <coordinate|array> <real|integer|pattern>
+//                         <general|symmetric|skew-symmetric>
+//   % comentários
+//   M N [nnz]
+//   entradas (i j [v], índices a partir de 1) ou valores por colunas
+// ============================================================
+typedef enum { MM_REAL, MM_INTEIRO, MM_PADRAO } CampoMM;
+typedef enum { MM_GERAL, MM_SIMETRICA, MM_ANTISSIMETRICA } SimetriaMM;
+
+typedef struct {
+    int         coordenadas;  /* 1: coordinate; 0: array */
+    CampoMM     campo;
+    SimetriaMM  simetria;
+    long long   nLinhas, nColunas, nnz;
+    const char* corpo;        /* primeiro byte após a linha de dimensões */
+} CabecalhoMM;
+
+/* Recebe cada elemento (i, j, v) já expandido pela simetria */
+typedef void (*VisitanteMM)(void* contexto, int linha, int coluna, double valor);
+
+static int palavraIgual(const char* inicio, const char* fim, const char* palavra) {
+    size_t tamanho = strlen(palavra);
+    if ((size_t)(fim - inicio) != tamanho) return 0;
+    for (size_t i = 0; i < tamanho; i++) {
+        char c = inicio[i];
+        if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+        if (c != palavra[i]) return 0;
+    }
+    return 1;
+}
+
+static int ehMatrixMarket(const Arquivo* arquivo) {
+    static const char assinatura[] = "%%MatrixMarket";
+    return arquivo->tamanho >= sizeof(assinatura) - 1 &&
+           memcmp(arquivo->dados, assinatura, sizeof(assinatura) - 1) == 0;
+}
+
+static LeituraStatus lerCabecalhoMM(const Arquivo* arquivo, CabecalhoMM* cabecalho) {
+    const char* fim = arquivo->dados + arquivo->tamanho;
+    const char* fimLinha = memchr(arquivo->dados, '\n', arquivo->tamanho);
+    if (!fimLinha) fimLinha = fim;
+
+    // (1) linha de identificação: 5 palavras
+    const char* palavras[5];
+    const char* fimPalavras[5];
+    const char* p = arquivo->dados;
+    for (int i = 0; i < 5; i++) {
+        palavras[i] = proximoToken(&p, fimLinha);
+        fimPalavras[i] = p;
+        if (!palavras[i]) return LEITURA_FORMATO;
+    }
+    if (!palavraIgual(palavras[1], fimPalavras[1], "matrix")) return LEITURA_FORMATO;
+
+    if (palavraIgual(palavras[2], fimPalavras[2], "coordinate")) cabecalho->coordenadas = 1;
+    else if (palavraIgual(palavras[2], fimPalavras[2], "array")) cabecalho->coordenadas = 0;
+    else return LEITURA_FORMATO;
+
+    if (palavraIgual(palavras[3], fimPalavras[3], "real")) cabecalho->campo = MM_REAL;
+    else if (palavraIgual(palavras[3], fimPalavras[3], "integer")) cabecalho->campo = MM_INTEIRO;
+    else if (palavraIgual(palavras[3], fimPalavras[3], "pattern") && cabecalho->coordenadas) cabecalho->campo = MM_PADRAO;
+    else return LEITURA_FORMATO; /* complex não é suportado */
+
+    if (palavraIgual(palavras[4], fimPalavras[4], "general")) cabecalho->simetria = MM_GERAL;
+    else if (palavraIgual(palavras[4], fimPalavras[4], "symmetric")) cabecalho->simetria = MM_SIMETRICA;
+    else if (palavraIgual(palavras[4], fimPalavras[4], "skew-symmetric")) cabecalho->simetria = MM_ANTISSIMETRICA;
+    else return LEITURA_FORMATO;
+
+    // (2) comentários e linhas em branco até a linha de dimensões
+    p = fimLinha;
+    for (;;) {
+        while (p < fim && ehEspaco(*p)) p++;
+        if (p >= fim) return LEITURA_FORMATO;
+        if (*p != '%') break;
+        fimLinha = memchr(p, '\n', (size_t)(fim - p));
+        p = fimLinha ? fimLinha : fim;
+    }
+    fimLinha = memchr(p, '\n', (size_t)(fim - p));
+    if (!fimLinha) fimLinha = fim;
+
+    if (!lerInteiro(&p, fimLinha, 1, INT_MAX, &cabecalho->nLinhas) ||
+        !lerInteiro(&p, fimLinha, 1, INT_MAX, &cabecalho->nColunas)) {
+        return LEITURA_FORMATO;
+    }
+    cabecalho->nnz = 0;
+    if (cabecalho->coordenadas && !lerInteiro(&p, fimLinha, 0, LLONG_MAX / 4, &cabecalho->nnz)) {
+        return LEITURA_FORMATO;
+    }
+    if (proximoToken(&p, fimLinha)) return LEITURA_FORMATO;
+    if (cabecalho->simetria != MM_GERAL && cabecalho->nLinhas != cabecalho->nColunas) return LEITURA_FORMATO;
+    cabecalho->corpo = fimLinha;
+    return LEITURA_OK;
+}
+
+/* Entrega o elemento e, fora da diagonal de uma matriz simétrica, o espelhado */
+static void visitarComSimetria(const CabecalhoMM* cabecalho, VisitanteMM visitar, void* contexto,
+                               int linha, int coluna, double valor) {
+    visitar(contexto, linha, coluna, valor);
+    if (linha != coluna && cabecalho->simetria != MM_GERAL) {
+        visitar(contexto, coluna, linha, cabecalho->simetria == MM_SIMETRICA ? valor : -valor);
+    }
+}
+
+/* Converte o corpo inteiro: índices e valores (coordinate) ou só valores (array) */
+static LeituraStatus converterCorpoMM(const Arquivo* arquivo, const CabecalhoMM* cabecalho,
+                                      double** valoresSaida) {
+    const char* fim = arquivo->dados + arquivo->tamanho;
+    long long n = cabecalho->nColunas;
+    int porEntrada = 1;
+    size_t quantidade;
+    if (cabecalho->coordenadas) {
+        porEntrada = (cabecalho->campo == MM_PADRAO) ? 2 : 3;
+        quantidade = (size_t) cabecalho->nnz * (size_t) porEntrada;
+    } else if (cabecalho->simetria == MM_GERAL) {
+        quantidade = (size_t) cabecalho->nLinhas * (size_t) n;
+    } else if (cabecalho->simetria == MM_SIMETRICA) {
+        quantidade = (size_t) n * (size_t)(n + 1) / 2;
+    } else {
+        quantidade = (size_t) n * (size_t)(n - 1) / 2;
+    }
+
+    double* valores = (double*) malloc((quantidade > 0 ? quantidade : 1) * sizeof(double));
+    if (!valores) return LEITURA_MEMORIA;
+    LeituraStatus status = converterTexto(cabecalho->corpo, fim, valores, quantidade, porEntrada, porEntrada);
+
+    // índices inteiros dentro das dimensões
+    for (long long k = 0; cabecalho->coordenadas && k < cabecalho->nnz && status == LEITURA_OK; k++) {
+        double i = valores[k * porEntrada], j = valores[k * porEntrada + 1];
+        if (!(i >= 1 && i <= (double) cabecalho->nLinhas && j >= 1 && j <= (double) cabecalho->nColunas) ||
+            i != (double)(long long) i || j != (double)(long long) j) {
+            status = LEITURA_FORMATO;
+        }
+    }
+    if (status != LEITURA_OK) {
+        free(valores);
+        return status;
+    }
+    *valoresSaida = valores;
+    return LEITURA_OK;
+}
+
+/* Entrega cada elemento convertido por converterCorpoMM a @p visitar */
+static void percorrerMM(const CabecalhoMM* cabecalho, const double* valores,
+                        VisitanteMM visitar, void* contexto) {
+    if (cabecalho->coordenadas) {
+        int porEntrada = (cabecalho->campo == MM_PADRAO) ? 2 : 3;
+        for (long long k = 0; k < cabecalho->nnz; k++) {
+            const double* entrada = valores + k * porEntrada;
+            double valor = (porEntrada == 3) ? entrada[2] : 1.0;
+            visitarComSimetria(cabecalho, visitar, contexto, (int) entrada[0] - 1, (int) entrada[1] - 1, valor);
+        }
+        return;
+    }
+    // array, por colunas; nas simétricas, só o triângulo inferior (sem a diagonal, se antissimétrica)
+    size_t k = 0;
+    for (long long coluna = 0; coluna < cabecalho->nColunas; coluna++) {
+        long long linhaIni = (cabecalho->simetria == MM_GERAL) ? 0
+                           : (cabecalho->simetria == MM_SIMETRICA) ? coluna : coluna + 1;
+        for (long long linha = linhaIni; linha < cabecalho->nLinhas; linha++) {
+            visitarComSimetria(cabecalho, visitar, contexto, (int) linha, (int) coluna, valores[k++]);
+        }
+    }
+}
+
+// ---------- visitantes ----------
+static void somarNaMatriz(void* contexto, int linha, int coluna, double valor) {
+    double** matriz = (double**) contexto;
+    matriz[linha][coluna] += valor;
+}
+
+static void contarNaoNulos(void* contexto, int linha, int coluna, double valor) {
+    (void) linha;
+    (void) coluna;
+    if (valor != 0.0) (*(long long*) contexto)++;
+}
+
+static void anexarTripla(void* contexto, int linha, int coluna, double valor) {
+    Triplas* triplas = (Triplas*) contexto;
+    if (valor == 0.0) return;
+    triplas->linhas[triplas->nnz] = linha;
+    triplas->colunas[triplas->nnz] = coluna;
+    triplas->valores[triplas->nnz] = valor;
+    triplas->nnz++;
+}
+
+static void contarTodas(void* contexto, int linha, int coluna, double valor) {
+    (void) linha;
+    (void) coluna;
+    (void) valor;
+    (*(long long*) contexto)++;
+}
+
+static void anexarTodas(void* contexto, int linha, int coluna, double valor) {
+    Triplas* triplas = (Triplas*) contexto;
+    triplas->linhas[triplas->nnz] = linha;
+    triplas->colunas[triplas->nnz] = coluna;
+    triplas->valores[triplas->nnz] = valor;
+    triplas->nnz++;
+}
+
+static LeituraStatus lerSistemaMM(const Arquivo* arquivo, double*** sistema, int* ordemMatriz) {
+    CabecalhoMM cabecalho;
+    LeituraStatus status = lerCabecalhoMM(arquivo, &cabecalho);
+    if (status != LEITURA_OK) return status;
+
+    long long ordem = cabecalho.nLinhas;
+    int comVetor = (cabecalho.nColunas == ordem + 1);
+    if (!comVetor && cabecalho.nColunas != ordem) return LEITURA_DIMENSOES;
+
+    Matriz* matriz = criarMatriz((int) ordem, (int) ordem + 1);
+    if (!matriz) return LEITURA_MEMORIA;
+    double** linhas = matriz->linhas;
+    for (long long i = 0; i < ordem; i++) memset(linhas[i], 0, (size_t)(ordem + 1) * sizeof(double));
+
+    double* valores;
+    status = converterCorpoMM(arquivo, &cabecalho, &valores);
+    if (status != LEITURA_OK) {
+        destruirMatriz(matriz);
+        return status;
+    }
+    percorrerMM(&cabecalho, valores, somarNaMatriz, linhas);
+    free(valores);
+
+    // só A: b = soma de cada linha (solução exata (1,...,1))
+    if (!comVetor) {
+        for (long long i = 0; i < ordem; i++) {
+            double soma = 0.0;
+            for (long long j = 0; j < ordem; j++) soma += linhas[i][j];
+            linhas[i][ordem] = soma;
+        }
+    }
+    *sistema = linhas;
+    *ordemMatriz = (int) ordem;
+    return LEITURA_OK;
+}
+
+// ============================================================
+// API PÚBLICA
+// ============================================================
+double** lerSistema(const char* caminho, int* ordemMatriz, LeituraStatus* status) {
+    Arquivo arquivo;
+    double** sistema = NULL;
+    LeituraStatus resultado = mapearArquivo(&arquivo, caminho);
+    if (resultado == LEITURA_OK) {
+        resultado = ehMatrixMarket(&arquivo) ? lerSistemaMM(&arquivo, &sistema, ordemMatriz)
+                                             : lerSistemaEntrada(&arquivo, &sistema, ordemMatriz);
+        desmapearArquivo(&arquivo);
+    }
+    if (status) *status = resultado;
+    return sistema;
+}
+
+LeituraStatus lerTriplasMatrixMarket(const char* caminho, Triplas* triplas) {
+    memset(triplas, 0, sizeof(*triplas));
+    Arquivo arquivo;
+    LeituraStatus status = mapearArquivo(&arquivo, caminho);
+    if (status != LEITURA_OK) return status;
+
+    CabecalhoMM cabecalho;
+    double* valores = NULL;
+    status = ehMatrixMarket(&arquivo) ? lerCabecalhoMM(&arquivo, &cabecalho) : LEITURA_FORMATO;
+    if (status == LEITURA_OK) status = converterCorpoMM(&arquivo, &cabecalho, &valores);
+    desmapearArquivo(&arquivo);
+
+    if (status == LEITURA_OK) {
+        // array: só os não nulos; coordinate: todas as entradas declaradas
+        long long total = 0;
+        percorrerMM(&cabecalho, valores, cabecalho.coordenadas ? contarTodas : contarNaoNulos, &total);
+        size_t capacidade = (size_t)(total > 0 ? total : 1);
+        triplas->nLinhas = (int) cabecalho.nLinhas;
+        triplas->nColunas = (int) cabecalho.nColunas;
+        triplas->linhas = (int*) malloc(capacidade * sizeof(int));
+        triplas->colunas = (int*) malloc(capacidade * sizeof(int));
+        triplas->valores = (double*) malloc(capacidade * sizeof(double));
+        if (triplas->linhas && triplas->colunas && triplas->valores) {
+            percorrerMM(&cabecalho, valores, cabecalho.coordenadas ? anexarTodas : anexarTripla, triplas);
+        } else {
+            status = LEITURA_MEMORIA;
+        }
+        free(valores);
+    }
+    if (status != LEITURA_OK) liberarTriplas(triplas);
+    return status;
+}
+
+void liberarTriplas(Triplas* triplas) {
+    if (!triplas) return;
+    free(triplas->linhas);
+    free(triplas->colunas);
+    free(triplas->valores);
+    memset(triplas, 0, sizeof(*triplas));
+}
+
+const char* leituraMensagem(LeituraStatus status) {
+    switch (status) {
+        case LEITURA_OK:        return "ok";
+        case LEITURA_ERRO_ES:   return "arquivo inexistente, vazio ou ilegivel";
+        case LEITURA_FORMATO:   return "formato invalido";
+        case LEITURA_DIMENSOES: return "dimensoes nao formam um sistema (n x n ou n x (n+1))";
+        case LEITURA_MEMORIA:   return "memoria insuficiente";
+    }
+    return "desconhecido";
+}
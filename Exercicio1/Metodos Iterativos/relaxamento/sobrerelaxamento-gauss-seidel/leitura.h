@@ -0,0 +1,90 @@
+#ifndef LEITURA_H
+#define LEITURA_H
+
+/**
+ * @file leitura.h
+ * @brief Leitura rápida de sistemas em texto: o formato de `entrada.txt`
+ *        (ordem n seguida das linhas de [A|b]) e arquivos MatrixMarket
+ *        (`coordinate` e `array`).
+ *
+ * O arquivo é mapeado em memória (`mmap` / `MapViewOfFile`) e os números são
+ * convertidos por um analisador próprio, sem `fscanf` nem cópia para buffers
+ * intermediários: números com até 19 dígitos significativos e expoente
+ * decimal pequeno (o caso comum) são convertidos com exatidão por uma
+ * multiplicação ou divisão; os demais (e `inf`/`nan`) passam por `strtod`.
+ * O separador decimal é sempre o ponto.
+ *
+ * Com OpenMP (-fopenmp), arquivos grandes são divididos em pedaços por
+ * quebras de linha e convertidos em paralelo: uma passada conta os números
+ * de cada pedaço, a segunda converte cada pedaço direto para a posição final.
+ */
+
+#include "utils.h"
+
+/** Tamanho (bytes) a partir do qual a conversão é dividida entre as threads. */
+#ifndef LEITURA_CORTE_PARALELO
+#define LEITURA_CORTE_PARALELO (1 << 20)
+#endif
+
+/**
+ * @brief Códigos de retorno da leitura.
+ */
+typedef enum {
+    LEITURA_OK = 0,
+    LEITURA_ERRO_ES,     /**< Arquivo inexistente, vazio ou não mapeável. */
+    LEITURA_FORMATO,     /**< Número inválido, cabeçalho desconhecido ou quantidade de valores errada. */
+    LEITURA_DIMENSOES,   /**< Dimensões que não formam um sistema (nem n × n nem n × (n+1)). */
+    LEITURA_MEMORIA      /**< Falha de alocação. */
+} LeituraStatus;
+
+/**
+ * @brief Matriz esparsa em triplas (i, j, valor), índices a partir de 0.
+ *
+ * Entradas simétricas (`symmetric` / `skew-symmetric`) já vêm expandidas
+ * para os dois triângulos; entradas repetidas são mantidas como estão.
+ */
+typedef struct {
+    int       nLinhas;
+    int       nColunas;
+    long long nnz;       /**< Número de triplas. */
+    int*      linhas;
+    int*      colunas;
+    double*   valores;
+} Triplas;
+
+/**
+ * @brief Lê um sistema [A|b] de @p caminho, detectando o formato.
+ *
+ * - `entrada.txt`: a ordem n seguida de n·(n+1) valores (quebras de linha livres).
+ * - MatrixMarket: uma matriz n × (n+1) é [A|b]; uma n × n é A, e b recebe a
+ *   soma de cada linha (como em @ref gerarHilbertAumentada, a solução exata
+ *   é (1,...,1)). Entradas repetidas em `coordinate` são somadas.
+ *
+ * @param caminho     Arquivo de entrada.
+ * @param ordemMatriz Saída: ordem n.
+ * @param status      Saída opcional (NULL) com o motivo da falha.
+ * @return [A|b] alocada com @ref criarMatriz (libere com @ref liberarMatriz), ou NULL.
+ */
+double** lerSistema(const char* caminho, int* ordemMatriz, LeituraStatus* status);
+
+/**
+ * @brief Lê um arquivo MatrixMarket (`coordinate` ou `array`) como triplas.
+ *
+ * Campos `real`, `integer` e `pattern` (valor 1.0); `complex` não é aceito.
+ * Em `array`, só os elementos não nulos viram triplas.
+ *
+ * @return LEITURA_OK ou o motivo da falha (@p triplas fica zerada).
+ */
+LeituraStatus lerTriplasMatrixMarket(const char* caminho, Triplas* triplas);
+
+/**
+ * @brief Libera os vetores das triplas.
+ */
+void liberarTriplas(Triplas* triplas);
+
+/**
+ * @brief Mensagem legível para um código de retorno.
+ */
+const char* leituraMensagem(LeituraStatus status);
+
+#endif /* LEITURA_H */
@@ -1,10 +1,13 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <windows.h>   // QueryPerformanceCounter / Frequency
 #include "utils.h"
 #include<limits.h>
 #include "gaussseidel_sor.h"
+#include "leitura.h"
+#include "esparsa.h"
 
-int main(void) {
+int main(int argc, char** argv) {
     // ============================================
     // ETAPA 1: Gerar sistema de teste (Hilbert)
     // ============================================
@@ -12,6 +15,19 @@ int main(void) {
     double tolerancia = 1e-12;
     long long int maxIter = LLONG_MAX; 
 
+    // com argumento: entrada.txt ou MatrixMarket (leitura.h), lido uma vez
+    // direto em CSR (esparsa.h); os métodos esparsos não alteram A nem b
+    MatrizCSR* matrizA = NULL;
+    double* vetorB = NULL;
+    if (argc > 1) {
+        LeituraStatus statusLeitura = lerSistemaCSR(argv[1], &matrizA, &vetorB);
+        if (statusLeitura != LEITURA_OK) {
+            fprintf(stderr, "%s: %s\n", argv[1], leituraMensagem(statusLeitura));
+            return 1;
+        }
+        ordemMatriz = matrizA->nLinhas;
+    }
+
     // ============================================
     // ETAPA 2: Loop sobre valores de omega
     // ============================================
@@ -19,8 +35,8 @@ int main(void) {
         printf("\n============================\n");
         printf("Teste com omega = %.1f\n", omega);
 
-        // gerar nova matriz a cada execução (pois é modificada no processo)
-        double** matrizExtendida = gerarHilbertAumentada(ordemMatriz);
+        // Hilbert: gerar nova matriz a cada rodada (pois é modificada no processo)
+        double** matrizExtendida = matrizA ? NULL : gerarHilbertAumentada(ordemMatriz);
         double* vetorSolucao = criarVetorSolucao(ordemMatriz);
 
         // medir tempo
@@ -28,10 +44,9 @@ int main(void) {
         QueryPerformanceFrequency(&freq);
         QueryPerformanceCounter(&inicio);
 
-        GaussSeidelSORStatus status = gaussSeidelSOR(
-            matrizExtendida, ordemMatriz, vetorSolucao,
-            omega, tolerancia, maxIter
-        );
+        GaussSeidelSORStatus status = matrizA
+            ? gaussSeidelSOREsparso(matrizA, vetorB, vetorSolucao, omega, tolerancia, maxIter)
+            : gaussSeidelSOR(matrizExtendida, ordemMatriz, vetorSolucao, omega, tolerancia, maxIter);
 
         QueryPerformanceCounter(&fim);
         double tempoSegundos = (double)(fim.QuadPart - inicio.QuadPart) / (double)freq.QuadPart;
@@ -40,14 +55,18 @@ int main(void) {
         imprimirStatusGaussSeidelSOR(status);
         if (status == SOR_OK) {
             imprimirSolucao(vetorSolucao, ordemMatriz);
-            calcularErroRelativo(vetorSolucao,ordemMatriz);
+            if (argc <= 1) calcularErroRelativo(vetorSolucao,ordemMatriz);  // solução exata só na Hilbert
         }
 
         printf("Tempo de execução: %.10f segundos\n", tempoSegundos);
 
         // liberar memória
-        liberar(matrizExtendida, ordemMatriz, vetorSolucao);
+        if (matrizA) liberarVetorSolucao(vetorSolucao);
+        else liberar(matrizExtendida, ordemMatriz, vetorSolucao);
     }
 
+    destruirMatrizCSR(matrizA);
+    free(vetorB);
+
     return 0;
 }
@@ -0,0 +1,222 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esparsa.h"
+
+// ============================================================
+// CRIAÇÃO E LIBERAÇÃO
+// ============================================================
+static MatrizCSR* criarMatrizCSR(int nLinhas, int nColunas, long long nnz) {
+    MatrizCSR* matriz = (MatrizCSR*) malloc(sizeof(MatrizCSR));
+    if (!matriz) return NULL;
+    size_t capacidade = (size_t)(nnz > 0 ? nnz : 1);
+    matriz->nLinhas = nLinhas;
+    matriz->nColunas = nColunas;
+    matriz->nnz = nnz;
+    matriz->inicioLinha = (long long*) calloc((size_t) nLinhas + 1, sizeof(long long));
+    matriz->colunas = (int*) malloc(capacidade * sizeof(int));
+    matriz->valores = (double*) malloc(capacidade * sizeof(double));
+    if (!matriz->inicioLinha || !matriz->colunas || !matriz->valores) {
+        destruirMatrizCSR(matriz);
+        return NULL;
+    }
+    return matriz;
+}
+
+void destruirMatrizCSR(MatrizCSR* matrizA) {
+    if (!matrizA) return;
+    free(matrizA->inicioLinha);
+    free(matrizA->colunas);
+    free(matrizA->valores);
+    free(matrizA);
+}
+
+// ============================================================
+// CONVERSÕES
+// ============================================================
+MatrizCSR* csrDeSistema(double** matrizEstendida, int ordemMatriz, double* vetorB) {
+    // (1) conta os não nulos de A
+    long long nnz = 0;
+    for (int i = 0; i < ordemMatriz; i++)
+        for (int j = 0; j < ordemMatriz; j++)
+            if (matrizEstendida[i][j] != 0.0) nnz++;
+
+    MatrizCSR* matriz = criarMatrizCSR(ordemMatriz, ordemMatriz, nnz);
+    if (!matriz) return NULL;
+
+    // (2) copia linha a linha, já em ordem de coluna
+    long long posicao = 0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        const double* linha = matrizEstendida[i];
+        for (int j = 0; j < ordemMatriz; j++) {
+            if (linha[j] == 0.0) continue;
+            matriz->colunas[posicao] = j;
+            matriz->valores[posicao] = linha[j];
+            posicao++;
+        }
+        matriz->inicioLinha[i + 1] = posicao;
+        if (vetorB) vetorB[i] = linha[ordemMatriz];
+    }
+    return matriz;
+}
+
+MatrizCSR* csrDeTriplas(const Triplas* triplas) {
+    MatrizCSR* matriz = criarMatrizCSR(triplas->nLinhas, triplas->nColunas, triplas->nnz);
+    if (!matriz) return NULL;
+    long long* inicio = matriz->inicioLinha;
+
+    // (1) distribui as triplas pelas linhas (contagem + soma de prefixos),
+    //     preservando a ordem de chegada dentro de cada linha
+    for (long long k = 0; k < triplas->nnz; k++) inicio[triplas->linhas[k] + 1]++;
+    for (int i = 0; i < matriz->nLinhas; i++) inicio[i + 1] += inicio[i];
+
+    long long* proxima = (long long*) malloc(((size_t) matriz->nLinhas + 1) * sizeof(long long));
+    if (!proxima) {
+        destruirMatrizCSR(matriz);
+        return NULL;
+    }
+    memcpy(proxima, inicio, ((size_t) matriz->nLinhas + 1) * sizeof(long long));
+    for (long long k = 0; k < triplas->nnz; k++) {
+        long long destino = proxima[triplas->linhas[k]]++;
+        matriz->colunas[destino] = triplas->colunas[k];
+        matriz->valores[destino] = triplas->valores[k];
+    }
+    free(proxima);
+
+    // (2) ordena cada linha por coluna (inserção: estável, e linear nas linhas
+    //     que já chegam ordenadas, o caso comum nos arquivos MatrixMarket)
+    //     e soma as repetições, compactando no lugar
+    long long escrita = 0;
+    for (int i = 0; i < matriz->nLinhas; i++) {
+        long long primeiro = inicio[i], ultimo = inicio[i + 1];
+        for (long long p = primeiro + 1; p < ultimo; p++) {
+            int coluna = matriz->colunas[p];
+            double valor = matriz->valores[p];
+            long long q = p - 1;
+            while (q >= primeiro && matriz->colunas[q] > coluna) {
+                matriz->colunas[q + 1] = matriz->colunas[q];
+                matriz->valores[q + 1] = matriz->valores[q];
+                q--;
+            }
+            matriz->colunas[q + 1] = coluna;
+            matriz->valores[q + 1] = valor;
+        }
+
+        inicio[i] = escrita;
+        for (long long p = primeiro; p < ultimo; p++) {
+            if (escrita > inicio[i] && matriz->colunas[escrita - 1] == matriz->colunas[p]) {
+                matriz->valores[escrita - 1] += matriz->valores[p];
+            } else {
+                matriz->colunas[escrita] = matriz->colunas[p];
+                matriz->valores[escrita] = matriz->valores[p];
+                escrita++;
+            }
+        }
+    }
+    inicio[matriz->nLinhas] = escrita;
+    matriz->nnz = escrita;
+    return matriz;
+}
+
+// ============================================================
+// LEITURA DE ARQUIVO
+// ============================================================
+static int arquivoMatrixMarket(const char* caminho) {
+    static const char assinatura[] = "%%MatrixMarket";
+    char inicio[sizeof(assinatura) - 1];
+    FILE* arquivo = fopen(caminho, "rb");
+    if (!arquivo) return 0;
+    size_t lidos = fread(inicio, 1, sizeof(inicio), arquivo);
+    fclose(arquivo);
+    return lidos == sizeof(inicio) && memcmp(inicio, assinatura, sizeof(inicio)) == 0;
+}
+
+/* Separa a coluna n de um CSR n × (n+1) em b (ou b = soma das linhas, se n × n) */
+static void separarLadoDireito(MatrizCSR* matriz, double* vetorB) {
+    int ordem = matriz->nLinhas;
+    int comVetor = (matriz->nColunas == ordem + 1);
+    long long escrita = 0;
+    for (int i = 0; i < ordem; i++) {
+        long long primeiro = matriz->inicioLinha[i], ultimo = matriz->inicioLinha[i + 1];
+        double soma = 0.0;
+        vetorB[i] = 0.0;
+        matriz->inicioLinha[i] = escrita;
+        for (long long p = primeiro; p < ultimo; p++) {
+            if (matriz->colunas[p] == ordem) {   // só com comVetor: b_i (última da linha)
+                vetorB[i] = matriz->valores[p];
+                continue;
+            }
+            soma += matriz->valores[p];
+            matriz->colunas[escrita] = matriz->colunas[p];
+            matriz->valores[escrita] = matriz->valores[p];
+            escrita++;
+        }
+        if (!comVetor) vetorB[i] = soma;
+    }
+    matriz->inicioLinha[ordem] = escrita;
+    matriz->nnz = escrita;
+    matriz->nColunas = ordem;
+}
+
+LeituraStatus lerSistemaCSR(const char* caminho, MatrizCSR** matrizA, double** vetorB) {
+    *matrizA = NULL;
+    *vetorB = NULL;
+
+    // entrada.txt: denso por natureza; lê e comprime
+    if (!arquivoMatrixMarket(caminho)) {
+        int ordemMatriz;
+        LeituraStatus status;
+        double** sistema = lerSistema(caminho, &ordemMatriz, &status);
+        if (!sistema) return status;
+        double* b = (double*) malloc((size_t) ordemMatriz * sizeof(double));
+        MatrizCSR* matriz = b ? csrDeSistema(sistema, ordemMatriz, b) : NULL;
+        liberarMatriz(sistema, ordemMatriz);
+        if (!matriz) {
+            free(b);
+            return LEITURA_MEMORIA;
+        }
+        *matrizA = matriz;
+        *vetorB = b;
+        return LEITURA_OK;
+    }
+
+    // MatrixMarket: triplas -> CSR, sem passar pela matriz densa
+    Triplas triplas;
+    LeituraStatus status = lerTriplasMatrixMarket(caminho, &triplas);
+    if (status != LEITURA_OK) return status;
+    if (triplas.nColunas != triplas.nLinhas && triplas.nColunas != triplas.nLinhas + 1) {
+        liberarTriplas(&triplas);
+        return LEITURA_DIMENSOES;
+    }
+
+    MatrizCSR* matriz = csrDeTriplas(&triplas);
+    liberarTriplas(&triplas);
+    double* b = matriz ? (double*) malloc(((size_t) matriz->nLinhas + 1) * sizeof(double)) : NULL;
+    if (!b) {
+        destruirMatrizCSR(matriz);
+        return LEITURA_MEMORIA;
+    }
+    separarLadoDireito(matriz, b);
+    *matrizA = matriz;
+    *vetorB = b;
+    return LEITURA_OK;
+}
+
+// ============================================================
+// OPERAÇÕES
+// ============================================================
+double csrDiagonal(const MatrizCSR* matrizA, int linha) {
+    for (long long p = matrizA->inicioLinha[linha]; p < matrizA->inicioLinha[linha + 1]; p++) {
+        if (matrizA->colunas[p] == linha) return matrizA->valores[p];
+    }
+    return 0.0;
+}
+
+void csrMultiplicar(const MatrizCSR* matrizA, const double* vetorX, double* vetorY) {
+    for (int i = 0; i < matrizA->nLinhas; i++) {
+        double soma = 0.0;
+        for (long long p = matrizA->inicioLinha[i]; p < matrizA->inicioLinha[i + 1]; p++)
+            soma += matrizA->valores[p] * vetorX[matrizA->colunas[p]];
+        vetorY[i] = soma;
+    }
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include "jacobi.h"
+#include "esparsa.h"
 
 #ifndef REL_EPS_MIN
 #define REL_EPS_MIN 1e-30  // evita divisão por zero na razão relativa
@@ -114,6 +115,103 @@ JacobiStatus jacobi(double** matrizEstendida, int ordemMatriz,
                            1.0, tolerancia, maxIter);
 }
 
+// ============================================================
+// JACOBI (weighted) esparso (CSR): mesmas etapas, só sobre os não nulos
+// ============================================================
+JacobiStatus jacobi_weighted_esparso(const MatrizCSR* matrizA, const double* vetorB,
+                                     double* vetorSolucao, double omega,
+                                     double tolerancia, long long int maxIter)
+{
+    int ordemMatriz = matrizA->nLinhas;
+    const long long* inicioLinha = matrizA->inicioLinha;
+    const int* colunas = matrizA->colunas;
+    const double* valores = matrizA->valores;
+
+    // --- validação do parâmetro ω ---
+    if (!(omega > 0.0 && omega < 2.0)) {
+        return JACOBI_PARAM_INVALIDO;
+    }
+
+    // --- alocar vetores de trabalho ---
+    double* xAtual   = (double*) malloc(ordemMatriz * sizeof(double));
+    double* xProximo = (double*) malloc(ordemMatriz * sizeof(double));
+    if (!xAtual || !xProximo) {
+        free(xAtual); free(xProximo);
+        return JACOBI_SINGULAR; // sinaliza falha de alocação como "singular"
+    }
+
+    // --- chute inicial x^(0) = b_i / a_ii + checagem da diagonal ---
+    double normaAnt = 0.0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        double aii = csrDiagonal(matrizA, i);
+        if (fabs(aii) < tolerancia) {
+            free(xAtual); free(xProximo);
+            return JACOBI_SINGULAR; // evita divisão por ~0
+        }
+        xAtual[i] = vetorB[i] / aii;
+        double a = fabs(xAtual[i]);
+        if (a > normaAnt) normaAnt = a;
+    }
+
+    // --- iterações ---
+    for (long long int k = 1; k <= maxIter; k++) {
+        double normaAtual = 0.0;
+        for (int i = 0; i < ordemMatriz; i++) {
+            double soma = vetorB[i];
+            double aii = 0.0;
+            for (long long p = inicioLinha[i]; p < inicioLinha[i + 1]; p++) {
+                int j = colunas[p];
+                if (j == i) { aii = valores[p]; continue; }
+                soma -= valores[p] * xAtual[j];
+            }
+            double xjac = soma / aii;
+            xProximo[i] = (1.0 - omega) * xAtual[i] + omega * xjac;
+
+            double a = fabs(xProximo[i]);
+            if (a > normaAtual) normaAtual = a;
+        }
+
+        double denom = fmax(fmax(normaAtual, normaAnt), REL_EPS_MIN);
+        double rel_err = fabs(normaAtual - normaAnt) / denom;
+        if (rel_err < tolerancia) {
+            for (int i = 0; i < ordemMatriz; i++) {
+                vetorSolucao[i] = xProximo[i];
+            }
+            printf("%lld interacoes\n", k - 1);
+            free(xAtual); free(xProximo);
+            return JACOBI_OK;
+        }
+
+        // guarda de divergência simples
+        if (normaAtual > 1e12) {
+            for (int i = 0; i < ordemMatriz; i++) {
+                vetorSolucao[i] = xAtual[i];
+            }
+            free(xAtual); free(xProximo);
+            return JACOBI_NAO_CONVERGIU;
+        }
+
+        // prepara próxima iteração (troca os vetores em vez de copiar)
+        double* temporario = xAtual;
+        xAtual = xProximo;
+        xProximo = temporario;
+        normaAnt = normaAtual;
+    }
+
+    // --- não convergiu em maxIter; devolve último x ---
+    for (int i = 0; i < ordemMatriz; i++) vetorSolucao[i] = xAtual[i];
+    free(xAtual); free(xProximo);
+    return JACOBI_NAO_CONVERGIU;
+}
+
+// Wrapper: Jacobi clássico esparso (ω = 1.0)
+JacobiStatus jacobiEsparso(const MatrizCSR* matrizA, const double* vetorB,
+                           double* vetorSolucao, double tolerancia, long long int maxIter)
+{
+    return jacobi_weighted_esparso(matrizA, vetorB, vetorSolucao,
+                                   1.0, tolerancia, maxIter);
+}
+
 // Status
 void imprimirStatusJacobi(JacobiStatus status) {
     if (status == JACOBI_OK) {
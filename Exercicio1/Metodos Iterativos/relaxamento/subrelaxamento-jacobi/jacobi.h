@@ -2,6 +2,8 @@
 #ifndef JACOBI_H
 #define JACOBI_H
 
+#include "esparsa.h"
+
 typedef enum {
     JACOBI_OK = 0,
     JACOBI_NAO_CONVERGIU = 1,
@@ -19,6 +21,16 @@ JacobiStatus jacobi(double** matrizEstendida, int ordemMatriz,
                     double* vetorSolucao, double tolerancia,
                     long long int maxIter);
 
+// Versões com A em CSR (esparsa.h): mesmas fórmulas, critério de parada
+// e status, com O(nnz) por iteração em vez de O(n²)
+JacobiStatus jacobi_weighted_esparso(const MatrizCSR* matrizA, const double* vetorB,
+                                     double* vetorSolucao, double omega,
+                                     double tolerancia, long long int maxIter);
+
+JacobiStatus jacobiEsparso(const MatrizCSR* matrizA, const double* vetorB,
+                           double* vetorSolucao, double tolerancia,
+                           long long int maxIter);
+
 void imprimirStatusJacobi(JacobiStatus status);
 
 #endif
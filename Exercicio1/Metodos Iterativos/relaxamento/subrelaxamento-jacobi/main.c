@@ -1,11 +1,14 @@
 // main_jacobi_relaxado.c
 #include <stdio.h>
+#include <stdlib.h>
 #include <windows.h>   // QueryPerformanceCounter / Frequency
 #include <limits.h>
 #include "utils.h"
 #include "jacobi.h"
+#include "leitura.h"
+#include "esparsa.h"
 
-int main(void) {
+int main(int argc, char** argv) {
     // ============================================
     // ETAPA 1: Sistema-teste (Hilbert)
     // ============================================
@@ -13,6 +16,19 @@ int main(void) {
     double tolerancia = 1e-12;
     long long int maxIter = LONG_MAX;
 
+    // com argumento: entrada.txt ou MatrixMarket (leitura.h), lido uma vez
+    // direto em CSR (esparsa.h); os métodos esparsos não alteram A nem b
+    MatrizCSR* matrizA = NULL;
+    double* vetorB = NULL;
+    if (argc > 1) {
+        LeituraStatus statusLeitura = lerSistemaCSR(argv[1], &matrizA, &vetorB);
+        if (statusLeitura != LEITURA_OK) {
+            fprintf(stderr, "%s: %s\n", argv[1], leituraMensagem(statusLeitura));
+            return 1;
+        }
+        ordemMatriz = matrizA->nLinhas;
+    }
+
     // ============================================
     // ETAPA 2: Loop sobre valores de omega (sub-relaxamento)
     // mesmos pontos do estudo do sobre-relaxamento: 0.1 ... 0.9
@@ -21,8 +37,8 @@ int main(void) {
         printf("\n============================\n");
         printf("Jacobi (weighted) com omega = %.2f\n", omega);
 
-        // gerar nova matriz a cada rodada (pois é modificada no processo)
-        double** matrizExtendida = gerarHilbertAumentada(ordemMatriz);
+        // Hilbert: gerar nova matriz a cada rodada (pois é modificada no processo)
+        double** matrizExtendida = matrizA ? NULL : gerarHilbertAumentada(ordemMatriz);
         double*  vetorSolucao    = criarVetorSolucao(ordemMatriz);
 
         // medir tempo
@@ -30,10 +46,9 @@ int main(void) {
         QueryPerformanceFrequency(&freq);
         QueryPerformanceCounter(&inicio);
 
-        JacobiStatus status = jacobi_weighted(
-            matrizExtendida, ordemMatriz, vetorSolucao,
-            omega, tolerancia, maxIter
-        );
+        JacobiStatus status = matrizA
+            ? jacobi_weighted_esparso(matrizA, vetorB, vetorSolucao, omega, tolerancia, maxIter)
+            : jacobi_weighted(matrizExtendida, ordemMatriz, vetorSolucao, omega, tolerancia, maxIter);
 
         QueryPerformanceCounter(&fim);
         double tempoSegundos = (double)(fim.QuadPart - inicio.QuadPart) / (double)freq.QuadPart;
@@ -42,13 +57,17 @@ int main(void) {
         imprimirStatusJacobi(status);
         if (status == JACOBI_OK) {
             imprimirSolucao(vetorSolucao, ordemMatriz);
-            calcularErroRelativo(vetorSolucao, ordemMatriz);
+            if (argc <= 1) calcularErroRelativo(vetorSolucao, ordemMatriz);  // solução exata só na Hilbert
         }
         printf("Tempo de execução: %.10f segundos\n", tempoSegundos);
 
         // liberar memória
-        liberar(matrizExtendida, ordemMatriz, vetorSolucao);
+        if (matrizA) liberarVetorSolucao(vetorSolucao);
+        else liberar(matrizExtendida, ordemMatriz, vetorSolucao);
     }
 
+    destruirMatrizCSR(matrizA);
+    free(vetorB);
+
     return 0;
 }
@@ -0,0 +1,105 @@
+/**
+ * @file bench_lu.c
+ * @brief Compara a LU clássica (luDecomposicaoVariante com LU_VARIANTE_DIREITA,
+ *        sem depender de LU_VARIANTE) com luRecursiva (cache-oblivious).
+ *
+ * Uso: bench_lu [nMin] [nMax]   (padrão: 256 8192, dobrando n a cada passo)
+ *
+ * Para cada n, gera uma matriz diagonal dominante (LU sem pivotamento estável),
+ * mede as duas fatorações e confere se L e U coincidem (diferença relativa máxima).
+ * Compile com `make bench` na pasta LU.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <sys/time.h>
+#endif
+#include "utils.h"
+#include "lu.h"
+#include "kernels.h"
+
+static double agora(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, t;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (double) t.QuadPart / freq.QuadPart;
+#else
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    return t.tv_sec + t.tv_usec / 1e6;
+#endif
+}
+
+static void preencherDiagonalDominante(double** matriz, int ordemMatriz) {
+    unsigned semente = 12345u;
+    for (int i = 0; i < ordemMatriz; i++) {
+        for (int j = 0; j < ordemMatriz; j++) {
+            semente = semente * 1103515245u + 12345u;
+            matriz[i][j] = ((semente >> 8) & 0xFFFF) / 65536.0 - 0.5;
+        }
+        matriz[i][i] += ordemMatriz;
+    }
+}
+
+static double diferencaRelativa(double** a, double** b, int ordemMatriz) {
+    double maxDif = 0.0, maxRef = 0.0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        for (int j = 0; j < ordemMatriz; j++) {
+            double dif = fabs(a[i][j] - b[i][j]);
+            if (dif > maxDif) maxDif = dif;
+            if (fabs(b[i][j]) > maxRef) maxRef = fabs(b[i][j]);
+        }
+    }
+    return (maxRef > 0.0) ? maxDif / maxRef : maxDif;
+}
+
+int main(int argc, char** argv) {
+    int nMin = (argc > 1) ? atoi(argv[1]) : 256;
+    int nMax = (argc > 2) ? atoi(argv[2]) : 8192;
+    double tolerancia = 1e-12;
+
+    printf("Núcleo SIMD: %s\n", kernelNome(kernelNivelAtivo()));
+    printf("%6s %12s %9s %12s %9s %8s %10s %10s\n", "n", "classica(s)", "GFLOP/s",
+           "recursiva(s)", "GFLOP/s", "ganho", "dif(L)", "dif(U)");
+
+    for (int n = nMin; n <= nMax; n *= 2) {
+        double** matrizA  = alocarMatriz(n);
+        double** matrizL1 = alocarMatriz(n);
+        double** matrizU1 = alocarMatriz(n);
+        double** matrizL2 = alocarMatriz(n);
+        double** matrizU2 = alocarMatriz(n);
+        if (!matrizA || !matrizL1 || !matrizU1 || !matrizL2 || !matrizU2) {
+            printf("%6d sem memória\n", n);
+            break;
+        }
+        preencherDiagonalDominante(matrizA, n);
+
+        double inicio = agora();
+        luDecomposicaoVariante(matrizA, n, matrizL1, matrizU1, tolerancia, LU_VARIANTE_DIREITA);
+        double tempoClassica = agora() - inicio;
+
+        inicio = agora();
+        luRecursiva(matrizA, n, matrizL2, matrizU2, tolerancia);
+        double tempoRecursiva = agora() - inicio;
+
+        double flops = 2.0 / 3.0 * (double) n * n * n;
+        printf("%6d %12.4f %9.2f %12.4f %9.2f %7.2fx %10.2e %10.2e\n", n,
+               tempoClassica, flops / tempoClassica / 1e9,
+               tempoRecursiva, flops / tempoRecursiva / 1e9,
+               tempoClassica / tempoRecursiva,
+               diferencaRelativa(matrizL2, matrizL1, n),
+               diferencaRelativa(matrizU2, matrizU1, n));
+        fflush(stdout);
+
+        liberarMatriz(matrizA, n);
+        liberarMatriz(matrizL1, n);
+        liberarMatriz(matrizU1, n);
+        liberarMatriz(matrizL2, n);
+        liberarMatriz(matrizU2, n);
+    }
+    return 0;
+}
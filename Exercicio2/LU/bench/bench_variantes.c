@@ -0,0 +1,157 @@
+/**
+ * @file bench_variantes.c
+ * @brief Compara as variantes de luDecomposicaoVariante (direita, esquerda,
+ *        Crout e recursiva): tempo, GFLOP/s e bytes movidos.
+ *
+ * Uso: bench_variantes [nMin] [nMax] [passo]   (padrão: 250 1500 250)
+ *
+ * Cada variante fatora a mesma matriz diagonal dominante no lugar
+ * (luDecomposicaoCompactaVariante). "lidos" e "escritos" vêm de um modelo de
+ * tráfego: contam os elementos que os laços internos leem e escrevem,
+ * supondo que só as linhas da iteração corrente ficam no cache (o pior caso
+ * quando A não cabe nele). Na recursiva o tráfego depende do nível da
+ * recursão e não é estimado. "dif" é a diferença relativa máxima para a
+ * direita. Compile com `make bench-variantes` na pasta LU.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <sys/time.h>
+#endif
+#include "utils.h"
+#include "lu.h"
+#include "kernels.h"
+
+static double agora(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, t;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (double) t.QuadPart / freq.QuadPart;
+#else
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    return t.tv_sec + t.tv_usec / 1e6;
+#endif
+}
+
+static void preencherDiagonalDominante(double** matriz, int ordemMatriz) {
+    unsigned semente = 12345u;
+    for (int i = 0; i < ordemMatriz; i++) {
+        for (int j = 0; j < ordemMatriz; j++) {
+            semente = semente * 1103515245u + 12345u;
+            matriz[i][j] = ((semente >> 8) & 0xFFFF) / 65536.0 - 0.5;
+        }
+        matriz[i][i] += ordemMatriz;
+    }
+}
+
+static double diferencaRelativa(double** a, double** b, int ordemMatriz) {
+    double maxDif = 0.0, maxRef = 0.0;
+    for (int i = 0; i < ordemMatriz; i++) {
+        for (int j = 0; j < ordemMatriz; j++) {
+            double dif = fabs(a[i][j] - b[i][j]);
+            if (dif > maxDif) maxDif = dif;
+            if (fabs(b[i][j]) > maxRef) maxRef = fabs(b[i][j]);
+        }
+    }
+    return (maxRef > 0.0) ? maxDif / maxRef : maxDif;
+}
+
+/**
+ * @brief Modelo de tráfego (em elementos) dos laços de cada variante.
+ * @return 0 se a variante não tem modelo (recursiva).
+ */
+static int modeloTrafego(LUVariante variante, int n, double* lidos, double* escritos) {
+    double r = 0.0, w = 0.0;
+    switch (variante) {
+        case LU_VARIANTE_DIREITA:
+            // passo k: linha do pivô + cada linha abaixo lida e escrita a partir de k
+            for (int k = 0; k < n - 1; k++) {
+                r += (double)(n - k) * (n - k);
+                w += (double)(n - k - 1) * (n - k);
+            }
+            break;
+        case LU_VARIANTE_ESQUERDA:
+            // linha i: lida e escrita uma vez; lê as linhas 0..i-1 de U a partir de k
+            for (int i = 0; i < n; i++) {
+                r += n;
+                w += n;
+                for (int k = 0; k < i; k++) r += n - k;
+            }
+            break;
+        case LU_VARIANTE_CROUT:
+            // passo k: linha k (uma vez) + linhas 0..k-1 de U a partir de k;
+            // coluna k de U copiada; cada linha abaixo lê l_i[0..k] e escreve l_ik
+            for (int k = 0; k < n; k++) {
+                r += n + (double) k * (n - k) + k + (double)(n - k - 1) * (k + 1);
+                w += (n - k) + (n - k - 1);
+            }
+            break;
+        default:
+            return 0;
+    }
+    *lidos = r;
+    *escritos = w;
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    int nMin  = (argc > 1) ? atoi(argv[1]) : 250;
+    int nMax  = (argc > 2) ? atoi(argv[2]) : 1500;
+    int passo = (argc > 3) ? atoi(argv[3]) : 250;
+    if (passo < 1) passo = 1;
+    double tolerancia = 1e-12;
+    const LUVariante variantes[] = { LU_VARIANTE_DIREITA, LU_VARIANTE_ESQUERDA,
+                                      LU_VARIANTE_CROUT, LU_VARIANTE_RECURSIVA };
+    const int nVariantes = (int)(sizeof(variantes) / sizeof(variantes[0]));
+
+    printf("Núcleo SIMD: %s\n", kernelNome(kernelNivelAtivo()));
+    printf("%6s %-10s %10s %9s %11s %11s %9s %10s\n", "n", "variante", "tempo(s)", "GFLOP/s",
+           "lidos(GB)", "escrit.(GB)", "GB/s", "dif");
+
+    for (int n = nMin; n <= nMax; n += passo) {
+        double** matrizA = alocarMatriz(n);
+        double** referencia = alocarMatriz(n);
+        double** fatores = alocarMatriz(n);
+        preencherDiagonalDominante(matrizA, n);
+
+        int melhor = 0;
+        double melhorTempo = INFINITY;
+        for (int v = 0; v < nVariantes; v++) {
+            double** destino = (v == 0) ? referencia : fatores;
+            copiarMatriz(destino, matrizA, n);
+
+            double inicio = agora();
+            luDecomposicaoCompactaVariante(destino, n, tolerancia, variantes[v]);
+            double tempo = agora() - inicio;
+            if (tempo < melhorTempo) { melhorTempo = tempo; melhor = v; }
+
+            double flops = 2.0 / 3.0 * (double) n * n * n;
+            double dif = (v == 0) ? 0.0 : diferencaRelativa(fatores, referencia, n);
+            double lidos, escritos;
+            if (modeloTrafego(variantes[v], n, &lidos, &escritos)) {
+                double gbLidos = lidos * sizeof(double) / 1e9;
+                double gbEscritos = escritos * sizeof(double) / 1e9;
+                printf("%6d %-10s %10.4f %9.2f %11.3f %11.3f %9.2f %10.2e\n", n,
+                       luNomeVariante(variantes[v]), tempo, flops / tempo / 1e9,
+                       gbLidos, gbEscritos, (gbLidos + gbEscritos) / tempo, dif);
+            } else {
+                printf("%6d %-10s %10.4f %9.2f %11s %11s %9s %10.2e\n", n,
+                       luNomeVariante(variantes[v]), tempo, flops / tempo / 1e9,
+                       "-", "-", "-", dif);
+            }
+            fflush(stdout);
+        }
+        printf("%6d mais rápida: %s (LU_VARIANTE=%s)\n\n", n,
+               luNomeVariante(variantes[melhor]), luNomeVariante(variantes[melhor]));
+
+        liberarMatriz(matrizA, n);
+        liberarMatriz(referencia, n);
+        liberarMatriz(fatores, n);
+    }
+    return 0;
+}
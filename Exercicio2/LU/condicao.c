@@ -0,0 +1,264 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "condicao.h"
+#include "residuo_estendido.h"
+
+/* Produtos por B / Bᵀ no estimador (o LAPACK usa o mesmo limite) */
+#define CONDICAO_MAX_ITERACOES 5
+
+// ============================================================
+// Estimador de ||B||₁ (Hager 1984, Higham 1988 — xLACN2)
+// ============================================================
+static int indiceMaximoAbs(const double* vetor, int ordem) {
+    int indice = 0;
+    for (int i = 1; i < ordem; i++)
+        if (fabs(vetor[i]) > fabs(vetor[indice])) indice = i;
+    return indice;
+}
+
+static double somaAbs(const double* vetor, int ordem) {
+    double soma = 0.0;
+    for (int i = 0; i < ordem; i++) soma += fabs(vetor[i]);
+    return soma;
+}
+
+double condicaoEstimarNorma1(CondicaoOperador operador, void* contexto, int ordem) {
+    if (ordem <= 0) return 0.0;
+    double* vetorX = (double*) malloc(ordem * sizeof(double));
+    double* sinais = (double*) malloc(ordem * sizeof(double));
+    if (!vetorX || !sinais) { free(vetorX); free(sinais); return -1.0; }
+
+    // (1) x = (1/n, ..., 1/n): ||Bx||₁ é a média das somas de coluna
+    for (int i = 0; i < ordem; i++) vetorX[i] = 1.0 / ordem;
+    operador(contexto, 0, vetorX);
+    double estimativa = somaAbs(vetorX, ordem);
+
+    if (ordem > 1) {
+        // (2) subgradiente: z = Bᵀ sinal(Bx) aponta a coluna mais promissora
+        for (int i = 0; i < ordem; i++) {
+            sinais[i] = (vetorX[i] >= 0.0) ? 1.0 : -1.0;
+            vetorX[i] = sinais[i];
+        }
+        operador(contexto, 1, vetorX);
+        int coluna = indiceMaximoAbs(vetorX, ordem);
+
+        // (3) testa a coluna e_j; para quando a estimativa ou os sinais estacionam
+        for (int iteracao = 2; iteracao <= CONDICAO_MAX_ITERACOES; iteracao++) {
+            memset(vetorX, 0, ordem * sizeof(double));
+            vetorX[coluna] = 1.0;
+            operador(contexto, 0, vetorX);
+            double anterior = estimativa;
+            double atual = somaAbs(vetorX, ordem);
+            if (atual > estimativa) estimativa = atual;
+
+            int repetido = 1;
+            for (int i = 0; i < ordem && repetido; i++)
+                if (((vetorX[i] >= 0.0) ? 1.0 : -1.0) != sinais[i]) repetido = 0;
+            if (repetido || atual <= anterior) break;
+
+            for (int i = 0; i < ordem; i++) {
+                sinais[i] = (vetorX[i] >= 0.0) ? 1.0 : -1.0;
+                vetorX[i] = sinais[i];
+            }
+            operador(contexto, 1, vetorX);
+            int colunaAnterior = coluna;
+            coluna = indiceMaximoAbs(vetorX, ordem);
+            if (fabs(vetorX[colunaAnterior]) == fabs(vetorX[coluna])) break;
+        }
+
+        // (4) vetor alternado de Higham: protege contra os casos em que o
+        //     subgradiente engana (matrizes com muitas colunas de peso parecido)
+        double sinal = 1.0;
+        for (int i = 0; i < ordem; i++) {
+            vetorX[i] = sinal * (1.0 + (double) i / (ordem - 1));
+            sinal = -sinal;
+        }
+        operador(contexto, 0, vetorX);
+        double alternativa = 2.0 * somaAbs(vetorX, ordem) / (3.0 * ordem);
+        if (alternativa > estimativa) estimativa = alternativa;
+    }
+
+    free(vetorX);
+    free(sinais);
+    return estimativa;
+}
+
+// ============================================================
+// Substituições no lugar com L (diag. unitária) e U
+// (só acesso por linhas, inclusive nas transpostas)
+// ============================================================
+static void resolverL(double** fatorL, double* vetor, int ordem) {
+    for (int i = 1; i < ordem; i++) {
+        const double* linha = fatorL[i];
+        double soma = vetor[i];
+        for (int j = 0; j < i; j++) soma -= linha[j] * vetor[j];
+        vetor[i] = soma;
+    }
+}
+
+static void resolverU(double** fatorU, double* vetor, int ordem) {
+    for (int i = ordem - 1; i >= 0; i--) {
+        const double* linha = fatorU[i];
+        double soma = vetor[i];
+        for (int j = i + 1; j < ordem; j++) soma -= linha[j] * vetor[j];
+        vetor[i] = soma / linha[i];
+    }
+}
+
+/* Uᵀ w = v, por colunas de Uᵀ (= linhas de U) */
+static void resolverUT(double** fatorU, double* vetor, int ordem) {
+    for (int i = 0; i < ordem; i++) {
+        const double* linha = fatorU[i];
+        double valor = vetor[i] / linha[i];
+        vetor[i] = valor;
+        for (int j = i + 1; j < ordem; j++) vetor[j] -= linha[j] * valor;
+    }
+}
+
+/* Lᵀ z = w, por colunas de Lᵀ (= linhas de L) */
+static void resolverLT(double** fatorL, double* vetor, int ordem) {
+    for (int i = ordem - 1; i > 0; i--) {
+        const double* linha = fatorL[i];
+        double valor = vetor[i];
+        for (int j = 0; j < i; j++) vetor[j] -= linha[j] * valor;
+    }
+}
+
+static int diagonalNula(double** fatorU, int ordem) {
+    for (int i = 0; i < ordem; i++)
+        if (fatorU[i][i] == 0.0) return 1;
+    return 0;
+}
+
+// ============================================================
+// Operadores: (LU)⁻¹ para κ₁ e diag(f)·A⁻ᵀ para o erro progressivo
+// ============================================================
+typedef struct {
+    double**      fatorL;
+    double**      fatorU;
+    const int*    permutacao;  /* NULL: P = I */
+    const double* pesos;       /* f, nas posições originais */
+    double*       trabalho;    /* n posições para aplicar P */
+    int           ordem;
+} CondicaoFatores;
+
+/* B = (LU)⁻¹ = A⁻¹Pᵀ: mesma norma-1 de A⁻¹ */
+static void operadorInversa(void* contexto, int transposta, double* vetor) {
+    const CondicaoFatores* fatores = (const CondicaoFatores*) contexto;
+    if (!transposta) {
+        resolverL(fatores->fatorL, vetor, fatores->ordem);
+        resolverU(fatores->fatorU, vetor, fatores->ordem);
+    } else {
+        resolverUT(fatores->fatorU, vetor, fatores->ordem);
+        resolverLT(fatores->fatorL, vetor, fatores->ordem);
+    }
+}
+
+/*
+ * B = diag(f)·A⁻ᵀ = diag(f)·Pᵀ(LU)⁻ᵀ, e Bᵀ = A⁻¹·diag(f) = (LU)⁻¹·P·diag(f).
+ * ||B||₁ = ||A⁻¹ diag(f)||∞ = || |A⁻¹| f ||∞ (f ≥ 0).
+ */
+static void operadorErroProgressivo(void* contexto, int transposta, double* vetor) {
+    const CondicaoFatores* fatores = (const CondicaoFatores*) contexto;
+    const int* permutacao = fatores->permutacao;
+    const double* pesos = fatores->pesos;
+    double* trabalho = fatores->trabalho;
+    int ordem = fatores->ordem;
+
+    if (!transposta) {
+        resolverUT(fatores->fatorU, vetor, ordem);
+        resolverLT(fatores->fatorL, vetor, ordem);
+        if (permutacao) {
+            for (int i = 0; i < ordem; i++) trabalho[permutacao[i]] = vetor[i];
+            memcpy(vetor, trabalho, ordem * sizeof(double));
+        }
+        for (int i = 0; i < ordem; i++) vetor[i] *= pesos[i];
+    } else {
+        for (int i = 0; i < ordem; i++) vetor[i] *= pesos[i];
+        if (permutacao) {
+            for (int i = 0; i < ordem; i++) trabalho[i] = vetor[permutacao[i]];
+            memcpy(vetor, trabalho, ordem * sizeof(double));
+        }
+        resolverL(fatores->fatorL, vetor, ordem);
+        resolverU(fatores->fatorU, vetor, ordem);
+    }
+}
+
+// ============================================================
+// API
+// ============================================================
+double condicaoNorma1(double** matrizA, int ordem) {
+    double* somas = (double*) calloc(ordem > 0 ? ordem : 1, sizeof(double));
+    if (!somas) return -1.0;
+    for (int i = 0; i < ordem; i++) {
+        const double* linha = matrizA[i];
+        for (int j = 0; j < ordem; j++) somas[j] += fabs(linha[j]);
+    }
+    double norma = 0.0;
+    for (int j = 0; j < ordem; j++)
+        if (somas[j] > norma) norma = somas[j];
+    free(somas);
+    return norma;
+}
+
+double condicaoEstimar1(double** fatorL, double** fatorU, int ordem, double normaA) {
+    if (ordem <= 0) return 0.0;
+    if (diagonalNula(fatorU, ordem)) return INFINITY;
+
+    CondicaoFatores fatores = { fatorL, fatorU, NULL, NULL, NULL, ordem };
+    double normaInversa = condicaoEstimarNorma1(operadorInversa, &fatores, ordem);
+    if (normaInversa < 0.0) return -1.0;
+    return normaA * normaInversa;
+}
+
+int condicaoLimitesErro(double** matrizA, double** fatorL, double** fatorU,
+                        const int* permutacao, const double* vetorB, const double* vetorX,
+                        int ordem, CondicaoLimites* limites) {
+    limites->erroRetroativo = 0.0;
+    limites->limiteProgressivo = 0.0;
+    if (ordem <= 0) return 0;
+
+    double* pesos = (double*) malloc(ordem * sizeof(double));
+    double* trabalho = (double*) malloc(ordem * sizeof(double));
+    if (!pesos || !trabalho) { free(pesos); free(trabalho); return 1; }
+
+    // (1) r = b − Ax̂ em double-double; ω = max |r_i| / (|A||x̂| + |b|)_i
+    //     f_i = |r_i| + erro de arredondamento de r_i: ε|r_i| ao voltar
+    //     para double e ~(n+2)ε² da soma em double-double
+    const double epsilon = DBL_EPSILON;
+    double erroRetroativo = 0.0;
+    double normaX = 0.0;
+    for (int i = 0; i < ordem; i++) {
+        const double* linha = matrizA[i];
+        double residuo = residuoEstendido(linha, vetorX, NULL, vetorB[i], ordem);
+        double escala = fabs(vetorB[i]);
+        for (int j = 0; j < ordem; j++) escala += fabs(linha[j]) * fabs(vetorX[j]);
+
+        double absResiduo = fabs(residuo);
+        if (escala > 0.0) {
+            if (absResiduo / escala > erroRetroativo) erroRetroativo = absResiduo / escala;
+        } else if (absResiduo > 0.0) {
+            erroRetroativo = INFINITY;
+        }
+        pesos[i] = absResiduo * (1.0 + epsilon) + (ordem + 2) * epsilon * epsilon * escala;
+        if (fabs(vetorX[i]) > normaX) normaX = fabs(vetorX[i]);
+    }
+    limites->erroRetroativo = erroRetroativo;
+
+    // (2) ||x − x̂||∞ ≤ || |A⁻¹| f ||∞, estimado sem formar A⁻¹
+    if (diagonalNula(fatorU, ordem)) {
+        limites->limiteProgressivo = INFINITY;
+    } else {
+        CondicaoFatores fatores = { fatorL, fatorU, permutacao, pesos, trabalho, ordem };
+        double limite = condicaoEstimarNorma1(operadorErroProgressivo, &fatores, ordem);
+        if (limite < 0.0) { free(pesos); free(trabalho); return 1; }
+        if (normaX > 0.0) limites->limiteProgressivo = limite / normaX;
+        else limites->limiteProgressivo = (limite > 0.0) ? INFINITY : 0.0;
+    }
+
+    free(pesos);
+    free(trabalho);
+    return 0;
+}
@@ -0,0 +1,344 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "ldlt.h"
+#include "kernels.h"
+
+/* α = (1 + √17)/8: minimiza o limite de crescimento do Bunch–Kaufman */
+#define LDLT_ALFA 0.64038820320220756872767623199676
+
+static void trocarValores(double* a, double* b) {
+    double temporario = *a;
+    *a = *b;
+    *b = temporario;
+}
+
+int matrizSimetrica(double** matrizA, int ordemMatriz) {
+    for (int i = 1; i < ordemMatriz; i++)
+        for (int j = 0; j < i; j++)
+            if (matrizA[i][j] != matrizA[j][i]) return 0;
+    return 1;
+}
+
+// ============================================================
+// FATORAÇÃO P·A·Pᵀ = L·D·Lᵀ (Bunch–Kaufman, triângulo inferior)
+// ============================================================
+
+/*
+ * Troca simétrica das linhas/colunas kk < kp, só no triângulo inferior.
+ * Inclui as colunas de L já calculadas (0..kk-1), então a permutação vale
+ * para a fatoração inteira (como as trocas de linha na LU com pivotamento).
+ */
+static void trocarSimetrica(double** matrizA, int ordemMatriz, int kk, int kp) {
+    double* linhaKK = matrizA[kk];
+    double* linhaKP = matrizA[kp];
+    for (int j = 0; j < kk; j++) trocarValores(&linhaKK[j], &linhaKP[j]);
+    trocarValores(&linhaKK[kk], &linhaKP[kp]);
+    for (int j = kk + 1; j < kp; j++) trocarValores(&matrizA[j][kk], &linhaKP[j]);
+    for (int i = kp + 1; i < ordemMatriz; i++) trocarValores(&matrizA[i][kk], &matrizA[i][kp]);
+}
+
+LDLTStatus ldltDecomposicao(double** matrizA, int ordemMatriz, int* permutacao,
+                            int* blocos, double tolerancia) {
+    // colunas do pivô copiadas: a atualização lê por linhas, sem passos largos
+    double* coluna1 = (double*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(double));
+    double* coluna2 = (double*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(double));
+    if (!coluna1 || !coluna2) { free(coluna1); free(coluna2); return LDLT_MEMORIA; }
+
+    LDLTStatus status = LDLT_OK;
+    for (int i = 0; i < ordemMatriz; i++) permutacao[i] = i;
+
+    int k = 0;
+    while (k < ordemMatriz) {
+        // (1) escolha do pivô: maior |a_ik| abaixo da diagonal e, se preciso, da linha imax
+        double absDiagonal = fabs(matrizA[k][k]);
+        double maxColuna = 0.0;
+        int imax = k;
+        for (int i = k + 1; i < ordemMatriz; i++) {
+            if (fabs(matrizA[i][k]) > maxColuna) {
+                maxColuna = fabs(matrizA[i][k]);
+                imax = i;
+            }
+        }
+
+        double maior = (absDiagonal > maxColuna) ? absDiagonal : maxColuna;
+        if (maior < tolerancia) status = LDLT_PIVO_NULO;
+        if (maior == 0.0) {
+            // coluna já nula: D_kk = 0 e nada a eliminar (como xSYTF2)
+            blocos[k] = 1;
+            k++;
+            continue;
+        }
+
+        int passo = 1;
+        int kp = k;
+        if (absDiagonal < LDLT_ALFA * maxColuna) {
+            double maxLinha = 0.0;
+            for (int j = k; j < imax; j++)
+                if (fabs(matrizA[imax][j]) > maxLinha) maxLinha = fabs(matrizA[imax][j]);
+            for (int i = imax + 1; i < ordemMatriz; i++)
+                if (fabs(matrizA[i][imax]) > maxLinha) maxLinha = fabs(matrizA[i][imax]);
+
+            if (absDiagonal >= LDLT_ALFA * maxColuna * (maxColuna / maxLinha)) {
+                kp = k;                       // 1×1 em k
+            } else if (fabs(matrizA[imax][imax]) >= LDLT_ALFA * maxLinha) {
+                kp = imax;                    // 1×1 em imax
+            } else {
+                kp = imax;                    // 2×2 em (k, imax)
+                passo = 2;
+            }
+        }
+
+        int kk = k + passo - 1;
+        if (kp != kk) {
+            trocarSimetrica(matrizA, ordemMatriz, kk, kp);
+            int temporario = permutacao[kk];
+            permutacao[kk] = permutacao[kp];
+            permutacao[kp] = temporario;
+        }
+
+        // (2) eliminação: A22 -= W·D⁻¹·Wᵀ só para j ≤ i; L = W·D⁻¹ fica no lugar de W
+        if (passo == 1) {
+            double pivo = matrizA[k][k];
+            for (int i = k + 1; i < ordemMatriz; i++) coluna1[i] = matrizA[i][k];
+
+            for (int i = k + 1; i < ordemMatriz; i++) {
+                double multiplicador = coluna1[i] / pivo;
+                if (multiplicador != 0.0)
+                    kernelAtualizarLinha(matrizA[i] + k + 1, coluna1 + k + 1, multiplicador, i - k);
+                matrizA[i][k] = multiplicador;
+            }
+            blocos[k] = 1;
+        } else {
+            // D⁻¹ aplicado na forma escalada do xSYTF2 (evita overflow em d11·d22 − d21²)
+            double d21 = matrizA[k + 1][k];
+            double d11 = matrizA[k + 1][k + 1] / d21;
+            double d22 = matrizA[k][k] / d21;
+            double escala = 1.0 / (d11 * d22 - 1.0);
+            d21 = escala / d21;
+
+            for (int i = k + 2; i < ordemMatriz; i++) {
+                coluna1[i] = matrizA[i][k];
+                coluna2[i] = matrizA[i][k + 1];
+            }
+            for (int i = k + 2; i < ordemMatriz; i++) {
+                double l1 = d21 * (d11 * coluna1[i] - coluna2[i]);
+                double l2 = d21 * (d22 * coluna2[i] - coluna1[i]);
+                kernelAtualizarLinha(matrizA[i] + k + 2, coluna1 + k + 2, l1, i - k - 1);
+                kernelAtualizarLinha(matrizA[i] + k + 2, coluna2 + k + 2, l2, i - k - 1);
+                matrizA[i][k] = l1;
+                matrizA[i][k + 1] = l2;
+            }
+            blocos[k] = 2;
+            blocos[k + 1] = 0;
+        }
+        k += passo;
+    }
+
+    free(coluna1);
+    free(coluna2);
+    return status;
+}
+
+// ============================================================
+// SOLUÇÃO: x = Pᵀ L⁻ᵀ D⁻¹ L⁻¹ P b
+// ============================================================
+
+/* Elementos de L na linha i: 0..i-1, menos o de D na segunda linha de um 2×2 */
+static int larguraL(const int* blocos, int i) {
+    return (blocos[i] == 0) ? i - 1 : i;
+}
+
+int ldltResolver(double** matrizLDL, const int* permutacao, const int* blocos,
+                 const double* vetorB, double* vetorX, int ordemMatriz) {
+    double* vetorY = (double*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(double));
+    if (!vetorY) return 1;
+
+    for (int i = 0; i < ordemMatriz; i++) vetorY[i] = vetorB[permutacao[i]];
+
+    // L z = P b
+    for (int i = 1; i < ordemMatriz; i++) {
+        const double* linha = matrizLDL[i];
+        double soma = vetorY[i];
+        for (int j = 0, fim = larguraL(blocos, i); j < fim; j++) soma -= linha[j] * vetorY[j];
+        vetorY[i] = soma;
+    }
+
+    // D w = z
+    for (int k = 0; k < ordemMatriz; ) {
+        if (blocos[k] == 1) {
+            vetorY[k] /= matrizLDL[k][k];
+            k++;
+        } else {
+            double d21 = matrizLDL[k + 1][k];
+            double d11 = matrizLDL[k][k] / d21;
+            double d22 = matrizLDL[k + 1][k + 1] / d21;
+            double denominador = d11 * d22 - 1.0;
+            double b1 = vetorY[k] / d21;
+            double b2 = vetorY[k + 1] / d21;
+            vetorY[k]     = (d22 * b1 - b2) / denominador;
+            vetorY[k + 1] = (d11 * b2 - b1) / denominador;
+            k += 2;
+        }
+    }
+
+    // Lᵀ y = w: a coluna i de Lᵀ é a linha i de L
+    for (int i = ordemMatriz - 1; i > 0; i--)
+        kernelAtualizarLinha(vetorY, matrizLDL[i], vetorY[i], larguraL(blocos, i));
+
+    for (int i = 0; i < ordemMatriz; i++) vetorX[permutacao[i]] = vetorY[i];
+
+    free(vetorY);
+    return 0;
+}
+
+// ============================================================
+// INVERSA (xSYTRI): M = (L·D·Lᵀ)⁻¹ no triângulo inferior,
+// da última coluna para a primeira; depois A⁻¹ = Pᵀ·M·P
+// ============================================================
+
+/* produto = M(inicio:n, inicio:n) · vetor, com M simétrica guardada no triângulo inferior */
+static void produtoSimetrico(double** matriz, int inicio, int ordemMatriz,
+                             const double* vetor, double* produto) {
+    for (int i = inicio; i < ordemMatriz; i++) produto[i] = 0.0;
+    for (int i = inicio; i < ordemMatriz; i++) {
+        const double* linha = matriz[i];
+        double soma = linha[i] * vetor[i];
+        for (int j = inicio; j < i; j++) soma += linha[j] * vetor[j];
+        produto[i] += soma;
+        // parte acima da diagonal: M[j][i] = M[i][j], j < i
+        kernelAtualizarLinha(produto + inicio, linha + inicio, -vetor[i], i - inicio);
+    }
+}
+
+/*
+ * Coluna @p coluna de M, linhas inicio..n-1: recebe −M₂₂·l (l = coluna de L).
+ * Devolve lᵀ·M₂₂·l, a somar ao elemento diagonal.
+ */
+static double atualizarColunaInversa(double** matriz, int coluna, int inicio, int ordemMatriz,
+                                     double* trabalho, double* produto) {
+    for (int i = inicio; i < ordemMatriz; i++) trabalho[i] = matriz[i][coluna];
+    produtoSimetrico(matriz, inicio, ordemMatriz, trabalho, produto);
+
+    double soma = 0.0;
+    for (int i = inicio; i < ordemMatriz; i++) {
+        matriz[i][coluna] = -produto[i];
+        soma += trabalho[i] * produto[i];
+    }
+    return soma;
+}
+
+static void inverterFatores(double** matriz, const int* blocos, int ordemMatriz,
+                            double* trabalho, double* produto) {
+    int k = ordemMatriz - 1;
+    while (k >= 0) {
+        if (blocos[k] == 1) {
+            matriz[k][k] = 1.0 / matriz[k][k];
+            if (k < ordemMatriz - 1)
+                matriz[k][k] += atualizarColunaInversa(matriz, k, k + 1, ordemMatriz, trabalho, produto);
+            k--;
+        } else {
+            // bloco 2×2 nas linhas k-1, k
+            int a = k - 1;
+            double t = fabs(matriz[k][a]);
+            double ak = matriz[a][a] / t;
+            double akp1 = matriz[k][k] / t;
+            double akkp1 = matriz[k][a] / t;
+            double d = t * (ak * akp1 - 1.0);
+            matriz[a][a] = akp1 / d;
+            matriz[k][k] = ak / d;
+            matriz[k][a] = -akkp1 / d;
+
+            if (k < ordemMatriz - 1) {
+                matriz[a][a] += atualizarColunaInversa(matriz, a, k + 1, ordemMatriz, trabalho, produto);
+                double soma = 0.0;  // coluna k ainda é L; a coluna a já é da inversa
+                for (int i = k + 1; i < ordemMatriz; i++) soma += matriz[i][k] * matriz[i][a];
+                matriz[k][a] -= soma;
+                matriz[k][k] += atualizarColunaInversa(matriz, k, k + 1, ordemMatriz, trabalho, produto);
+            }
+            k -= 2;
+        }
+    }
+}
+
+/*
+ * M (triângulo inferior) -> A⁻¹ completa: espelha e aplica
+ * A⁻¹[perm[i]][perm[j]] = M[i][j]. As linhas são movidas por ciclos da
+ * permutação com uma linha auxiliar (os ponteiros de linha não mudam).
+ */
+static void expandirInversa(double** matriz, const int* permutacao, int ordemMatriz,
+                            double* linhaAuxiliar, int* inversaPermutacao) {
+    for (int i = 1; i < ordemMatriz; i++)
+        for (int j = 0; j < i; j++) matriz[j][i] = matriz[i][j];
+
+    // colunas: linha[perm[j]] <- linha[j]
+    for (int i = 0; i < ordemMatriz; i++) {
+        double* linha = matriz[i];
+        for (int j = 0; j < ordemMatriz; j++) linhaAuxiliar[permutacao[j]] = linha[j];
+        memcpy(linha, linhaAuxiliar, ordemMatriz * sizeof(double));
+    }
+
+    // linhas: destino p recebe a linha inversaPermutacao[p]
+    for (int i = 0; i < ordemMatriz; i++) inversaPermutacao[permutacao[i]] = i;
+    for (int inicio = 0; inicio < ordemMatriz; inicio++) {
+        if (inversaPermutacao[inicio] < 0 || inversaPermutacao[inicio] == inicio) continue;
+        memcpy(linhaAuxiliar, matriz[inicio], ordemMatriz * sizeof(double));
+        int atual = inicio;
+        for (;;) {
+            int origem = inversaPermutacao[atual];
+            inversaPermutacao[atual] = -1;
+            if (origem == inicio) {
+                memcpy(matriz[atual], linhaAuxiliar, ordemMatriz * sizeof(double));
+                break;
+            }
+            memcpy(matriz[atual], matriz[origem], ordemMatriz * sizeof(double));
+            atual = origem;
+        }
+    }
+}
+
+/* Trabalho das rotinas de inversa: 3n doubles e n inteiros, numa só alocação */
+static double* alocarTrabalhoInversa(int ordemMatriz, int** inteiros) {
+    size_t n = (size_t)(ordemMatriz > 0 ? ordemMatriz : 1);
+    double* trabalho = (double*) malloc(3 * n * sizeof(double) + n * sizeof(int));
+    if (trabalho) *inteiros = (int*)(trabalho + 3 * n);
+    return trabalho;
+}
+
+int ldltInversa(double** matrizLDL, const int* permutacao, const int* blocos,
+                double** matrizInversa, int ordemMatriz) {
+    int* inteiros = NULL;
+    double* trabalho = alocarTrabalhoInversa(ordemMatriz, &inteiros);
+    if (!trabalho) return 1;
+
+    for (int i = 0; i < ordemMatriz; i++)
+        memcpy(matrizInversa[i], matrizLDL[i], (size_t)(i + 1) * sizeof(double));
+
+    inverterFatores(matrizInversa, blocos, ordemMatriz, trabalho, trabalho + ordemMatriz);
+    expandirInversa(matrizInversa, permutacao, ordemMatriz, trabalho + 2 * ordemMatriz, inteiros);
+
+    free(trabalho);
+    return 0;
+}
+
+LDLTStatus inversaSimetricaNoLugar(double** matrizA, int ordemMatriz, double tolerancia) {
+    int* inteiros = NULL;
+    double* trabalho = alocarTrabalhoInversa(ordemMatriz, &inteiros);
+    int* permutacao = (int*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(int));
+    int* blocos = (int*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(int));
+    if (!trabalho || !permutacao || !blocos) {
+        free(trabalho); free(permutacao); free(blocos);
+        return LDLT_MEMORIA;
+    }
+
+    LDLTStatus status = ldltDecomposicao(matrizA, ordemMatriz, permutacao, blocos, tolerancia);
+    if (status != LDLT_MEMORIA) {
+        inverterFatores(matrizA, blocos, ordemMatriz, trabalho, trabalho + ordemMatriz);
+        expandirInversa(matrizA, permutacao, ordemMatriz, trabalho + 2 * ordemMatriz, inteiros);
+    }
+
+    free(trabalho);
+    free(permutacao);
+    free(blocos);
+    return status;
+}
@@ -0,0 +1,105 @@
+#ifndef LDLT_H
+#define LDLT_H
+
+/**
+ * @file ldlt.h
+ * @brief Fatoração simétrica indefinida P·A·Pᵀ = L·D·Lᵀ com pivotamento de
+ *        Bunch–Kaufman, solução de sistemas e inversa.
+ *
+ * Para A simétrica (não necessariamente positivo-definida, como a Hankel de
+ * quadrados de criarMatrizA2()), L é triangular inferior com diagonal 1 e D é
+ * bloco-diagonal com blocos 1×1 e 2×2. O pivotamento escolhe, a cada passo,
+ * um pivô 1×1 ou um bloco 2×2 que limita o crescimento dos elementos (como
+ * xSYTRF do LAPACK, com α = (1 + √17)/8), então a fatoração é estável sem
+ * precisar das trocas não simétricas da LU com pivotamento.
+ *
+ * Só o triângulo inferior de A é lido e escrito: cada passo atualiza metade
+ * da submatriz restante, então fatoração e inversa movem metade dos dados da
+ * LU (e fazem ~n³/3 flops contra 2n³/3). O triângulo superior não é tocado
+ * (exceto pela inversa no lugar, que devolve A⁻¹ completa).
+ *
+ * Formato dos fatores (sobre a própria A):
+ * - abaixo da diagonal, os multiplicadores de L (diag(L) = 1 implícita);
+ * - na diagonal e em A[k+1][k] dos blocos 2×2, os elementos de D;
+ * - blocos[k] = 1 (bloco 1×1 em k), 2 (bloco 2×2 em k, k+1) ou 0 (segunda linha de um bloco 2×2);
+ * - permutacao[i] = linha/coluna original que está na posição i (mesma convenção de condicao.h).
+ */
+
+/**
+ * @enum LDLTStatus
+ * @brief Indica o status da fatoração LDLᵀ.
+ */
+typedef enum {
+    LDLT_OK = 0,         /**< Fatoração concluída; D é invertível. */
+    LDLT_PIVO_NULO = 1,  /**< Alguma coluna restante tinha todos os |elementos| < tolerancia:
+                              A é singular ou quase singular (o bloco de D correspondente
+                              é quase nulo). A fatoração é concluída mesmo assim. */
+    LDLT_MEMORIA = 2     /**< Falha de alocação (A não foi alterada). */
+} LDLTStatus;
+
+/**
+ * @brief Fatora P·A·Pᵀ = L·D·Lᵀ no lugar (Bunch–Kaufman, right-looking).
+ *
+ * @param matrizA     Entrada: A simétrica (só o triângulo inferior é lido);
+ *                    saída: L e D no triângulo inferior.
+ * @param ordemMatriz Ordem n.
+ * @param permutacao  Saída (n): permutacao[i] = índice original na posição i.
+ * @param blocos      Saída (n): tamanho dos blocos de D (1, 2, ou 0 na segunda linha de um 2×2).
+ * @param tolerancia  Coluna com maior |elemento| < tolerancia => LDLT_PIVO_NULO.
+ * @return LDLT_OK ou LDLT_PIVO_NULO.
+ */
+LDLTStatus ldltDecomposicao(double** matrizA, int ordemMatriz, int* permutacao,
+                            int* blocos, double tolerancia);
+
+/**
+ * @brief Resolve A x = b com os fatores de ldltDecomposicao():
+ *        x = Pᵀ L⁻ᵀ D⁻¹ L⁻¹ P b.
+ *
+ * @param matrizLDL   Fatores (só o triângulo inferior é lido).
+ * @param permutacao  Permutação da fatoração.
+ * @param blocos      Blocos de D.
+ * @param vetorB      Lado direito b (n).
+ * @param vetorX      Saída x (n); pode ser o próprio @p vetorB.
+ * @param ordemMatriz Ordem n.
+ * @return 0 se sucesso; 1 em falha de alocação.
+ */
+int ldltResolver(double** matrizLDL, const int* permutacao, const int* blocos,
+                 const double* vetorB, double* vetorX, int ordemMatriz);
+
+/**
+ * @brief Monta A⁻¹ (completa, simétrica) a partir dos fatores, sem alterá-los.
+ *
+ * Inverte os fatores no triângulo inferior de @p matrizInversa, coluna a
+ * coluna da última para a primeira, como xSYTRI (~2n³/3 flops), e depois
+ * aplica a permutação e espelha no triângulo superior.
+ *
+ * @param matrizLDL      Fatores de ldltDecomposicao() (só o triângulo inferior é lido).
+ * @param permutacao     Permutação da fatoração.
+ * @param blocos         Blocos de D.
+ * @param matrizInversa  Saída: A⁻¹ (n x n).
+ * @param ordemMatriz    Ordem n.
+ * @return 0 se sucesso; 1 em falha de alocação.
+ */
+int ldltInversa(double** matrizLDL, const int* permutacao, const int* blocos,
+                double** matrizInversa, int ordemMatriz);
+
+/**
+ * @brief Substitui a A simétrica por A⁻¹ usando só a própria matriz (mais O(n) de trabalho).
+ *
+ * ldltDecomposicao() seguida da inversão dos fatores no lugar. Só o
+ * triângulo inferior de A é lido; a saída é a A⁻¹ completa.
+ *
+ * @param matrizA     Entrada A (n x n, simétrica); saída A⁻¹.
+ * @param ordemMatriz Ordem n.
+ * @param tolerancia  Repassada a ldltDecomposicao().
+ * @return LDLT_OK, LDLT_PIVO_NULO (a "inversa" é calculada mesmo assim) ou
+ *         LDLT_MEMORIA (A fica intacta).
+ */
+LDLTStatus inversaSimetricaNoLugar(double** matrizA, int ordemMatriz, double tolerancia);
+
+/**
+ * @brief 1 se a_ij == a_ji para todo i, j (comparação exata); 0 caso contrário.
+ */
+int matrizSimetrica(double** matrizA, int ordemMatriz);
+
+#endif /* LDLT_H */
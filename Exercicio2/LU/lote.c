@@ -0,0 +1,173 @@
+#include <string.h>
+#include "lote.h"
+#include "kernels.h"
+
+#if !(defined(__GNUC__) || defined(__clang__))
+#error "lote.c usa as extensões vetoriais do GCC/Clang"
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LOTE_X86 1
+#endif
+
+/* Endereço de A(i, j) / v(i) dentro de um grupo (pista 0) */
+#define ELEM(bloco, ordem, i, j) ((bloco) + ((i) * (ordem) + (j)) * LOTE_LARGURA)
+#define COMP(bloco, i)           ((bloco) + (i) * LOTE_LARGURA)
+
+/* ============================================================
+   Instâncias dos núcleos (lote_nucleo.h), uma por alvo, cada uma
+   com vetores da largura nativa do registrador:
+   padrão = 2 doubles (SSE2), AVX2 = 4, AVX-512 = 8.
+   ============================================================ */
+typedef double    LoteV2 __attribute__((vector_size(16)));
+typedef long long LoteM2 __attribute__((vector_size(16)));
+
+#define LOTE_SUFIXO Padrao
+#define LOTE_ALVO
+#define LOTE_T      LoteV2
+#define LOTE_M      LoteM2
+#define LOTE_VL     2
+#include "lote_nucleo.h"
+#undef LOTE_SUFIXO
+#undef LOTE_ALVO
+#undef LOTE_T
+#undef LOTE_M
+#undef LOTE_VL
+
+#ifdef LOTE_X86
+typedef double    LoteV4 __attribute__((vector_size(32)));
+typedef long long LoteM4 __attribute__((vector_size(32)));
+typedef double    LoteV8 __attribute__((vector_size(64)));
+typedef long long LoteM8 __attribute__((vector_size(64)));
+
+#define LOTE_SUFIXO AVX2
+#define LOTE_ALVO   __attribute__((target("avx2,fma")))
+#define LOTE_T      LoteV4
+#define LOTE_M      LoteM4
+#define LOTE_VL     4
+#include "lote_nucleo.h"
+#undef LOTE_SUFIXO
+#undef LOTE_ALVO
+#undef LOTE_T
+#undef LOTE_M
+#undef LOTE_VL
+
+#define LOTE_SUFIXO AVX512
+#define LOTE_ALVO   __attribute__((target("avx512f")))
+#define LOTE_T      LoteV8
+#define LOTE_M      LoteM8
+#define LOTE_VL     8
+#include "lote_nucleo.h"
+#undef LOTE_SUFIXO
+#undef LOTE_ALVO
+#undef LOTE_T
+#undef LOTE_M
+#undef LOTE_VL
+#endif
+
+/* Instância do nível ativo de kernels.h (escalar/SSE2 usam a padrão), escolhida a
+   cada chamada: kernelNivelAtivo() é uma leitura atômica e não há estado a compartilhar */
+static int fatorarLoteAtivo(const Lote* lote, double tolerancia, unsigned char* singular) {
+    switch (kernelNivelAtivo()) {
+#ifdef LOTE_X86
+        case KERNEL_AVX512: return fatorarLoteAVX512(lote, tolerancia, singular);
+        case KERNEL_AVX2:   return fatorarLoteAVX2(lote, tolerancia, singular);
+#endif
+        default:            return fatorarLotePadrao(lote, tolerancia, singular);
+    }
+}
+
+static void resolverLoteAtivo(const Lote* lote) {
+    switch (kernelNivelAtivo()) {
+#ifdef LOTE_X86
+        case KERNEL_AVX512: resolverLoteAVX512(lote); break;
+        case KERNEL_AVX2:   resolverLoteAVX2(lote); break;
+#endif
+        default:            resolverLotePadrao(lote); break;
+    }
+}
+
+/* ============================================================
+   Criação / liberação e cópia de dados
+   ============================================================ */
+
+int criarLote(Lote* lote, int ordem, int numSistemas) {
+    memset(lote, 0, sizeof(*lote));
+    if (ordem < 1 || ordem > LOTE_ORDEM_MAX || numSistemas < 1) return 0;
+
+    lote->ordem = ordem;
+    lote->numSistemas = numSistemas;
+    lote->numGrupos = (numSistemas + LOTE_LARGURA - 1) / LOTE_LARGURA;
+    lote->matrizes = criarMatriz(lote->numGrupos, ordem * ordem * LOTE_LARGURA);
+    lote->vetores  = criarMatriz(lote->numGrupos, ordem * LOTE_LARGURA);
+    lote->pivos    = criarMatriz(lote->numGrupos, ordem * LOTE_LARGURA);
+    if (!lote->matrizes || !lote->vetores || !lote->pivos) {
+        liberarLote(lote);
+        return 0;
+    }
+
+    /* Todas as pistas começam como Ix = 0: pistas de sobra nunca ficam singulares */
+    for (int g = 0; g < lote->numGrupos; g++) {
+        memset(lote->matrizes->linhas[g], 0, (size_t) ordem * ordem * LOTE_LARGURA * sizeof(double));
+        memset(lote->vetores->linhas[g], 0, (size_t) ordem * LOTE_LARGURA * sizeof(double));
+        for (int i = 0; i < ordem; i++) {
+            for (int p = 0; p < LOTE_LARGURA; p++) {
+                ELEM(lote->matrizes->linhas[g], ordem, i, i)[p] = 1.0;
+            }
+        }
+    }
+    return 1;
+}
+
+void liberarLote(Lote* lote) {
+    if (!lote) return;
+    if (lote->matrizes) destruirMatriz(lote->matrizes);
+    if (lote->vetores)  destruirMatriz(lote->vetores);
+    if (lote->pivos)    destruirMatriz(lote->pivos);
+    lote->matrizes = lote->vetores = lote->pivos = NULL;
+    lote->numSistemas = lote->numGrupos = 0;
+}
+
+void loteDefinirMatriz(Lote* lote, int sistema, double** matrizA) {
+    double* bloco = lote->matrizes->linhas[sistema / LOTE_LARGURA];
+    int pista = sistema % LOTE_LARGURA;
+    for (int i = 0; i < lote->ordem; i++) {
+        for (int j = 0; j < lote->ordem; j++) {
+            ELEM(bloco, lote->ordem, i, j)[pista] = matrizA[i][j];
+        }
+    }
+}
+
+void loteDefinirVetor(Lote* lote, int sistema, const double* vetorB) {
+    double* vetor = lote->vetores->linhas[sistema / LOTE_LARGURA];
+    int pista = sistema % LOTE_LARGURA;
+    for (int i = 0; i < lote->ordem; i++) {
+        COMP(vetor, i)[pista] = vetorB[i];
+    }
+}
+
+void loteObterVetor(const Lote* lote, int sistema, double* vetorX) {
+    const double* vetor = lote->vetores->linhas[sistema / LOTE_LARGURA];
+    int pista = sistema % LOTE_LARGURA;
+    for (int i = 0; i < lote->ordem; i++) {
+        vetorX[i] = COMP(vetor, i)[pista];
+    }
+}
+
+/* ============================================================
+   Fatoração e solução
+   ============================================================ */
+
+int loteFatorar(Lote* lote, double tolerancia, unsigned char* singular) {
+    return fatorarLoteAtivo(lote, tolerancia, singular);
+}
+
+void loteResolver(const Lote* lote) {
+    resolverLoteAtivo(lote);
+}
+
+int loteResolverSistemas(Lote* lote, double tolerancia, unsigned char* singular) {
+    int totalSingulares = loteFatorar(lote, tolerancia, singular);
+    loteResolver(lote);
+    return totalSingulares;
+}
@@ -0,0 +1,109 @@
+#ifndef LOTE_H
+#define LOTE_H
+
+/**
+ * @file lote.h
+ * @brief Resolução em lote de muitos sistemas pequenos (n ≤ 16) de uma vez,
+ *        com SIMD *entre* sistemas.
+ *
+ * Em vez de vetorizar dentro de um sistema 3×3 ou 4×4 (pouco trabalho por
+ * linha), cada pista SIMD cuida de um sistema diferente: os sistemas são
+ * guardados intercalados, em grupos de @ref LOTE_LARGURA, no formato
+ * *structure-of-arrays*:
+ *
+ *     grupo g = s / LOTE_LARGURA, pista p = s % LOTE_LARGURA
+ *     A_s(i, j) = matrizes->linhas[g][(i * ordem + j) * LOTE_LARGURA + p]
+ *     b_s(i)    = vetores->linhas[g][i * LOTE_LARGURA + p]
+ *
+ * Assim, cada operação da eliminação (busca do pivô, troca, atualização) vira
+ * uma instrução sobre LOTE_LARGURA sistemas. O pivotamento parcial é feito
+ * com seleções mascaradas: cada pista escolhe e troca a sua linha de pivô sem
+ * desvios.
+ *
+ * A fatoração é PA = LU no próprio lote (L abaixo da diagonal com diagonal 1,
+ * U no triângulo superior; pivôs em `pivos`), no mesmo espírito de
+ * luDecomposicao(), porém com pivotamento. O código é compilado para SSE2,
+ * AVX2 e AVX-512 e escolhido pelo mesmo despacho de kernels.h; as ordens 2, 3
+ * e 4 têm laços totalmente desenrolados.
+ */
+
+#include "utils.h"
+
+/** Número de sistemas intercalados por grupo (uma pista por sistema). */
+#define LOTE_LARGURA 8
+
+/** Maior ordem aceita pelo lote (sistemas "pequenos"). */
+#define LOTE_ORDEM_MAX 16
+
+/**
+ * @brief Lote de sistemas Ax = b de mesma ordem, em grupos intercalados.
+ *
+ * Cada linha das matrizes abaixo é um grupo de LOTE_LARGURA sistemas
+ * (blocos contíguos e alinhados a 64 bytes, ver @ref Matriz). As pistas
+ * que sobram no último grupo começam como a identidade, para não gerar
+ * avisos de pivô nulo.
+ */
+typedef struct {
+    Matriz* matrizes;  /**< numGrupos × (ordem²·LOTE_LARGURA): A, depois L e U (no lugar). */
+    Matriz* vetores;   /**< numGrupos × (ordem·LOTE_LARGURA): b, depois x. */
+    Matriz* pivos;     /**< numGrupos × (ordem·LOTE_LARGURA): linha do pivô de cada etapa. */
+    int ordem;         /**< Ordem n de todos os sistemas. */
+    int numSistemas;   /**< Quantidade de sistemas úteis. */
+    int numGrupos;     /**< ceil(numSistemas / LOTE_LARGURA). */
+} Lote;
+
+/**
+ * @brief Aloca um lote de @p numSistemas sistemas de ordem @p ordem.
+ *
+ * @return 1 em caso de sucesso; 0 em falha de alocação ou ordem fora de 1..LOTE_ORDEM_MAX.
+ */
+int criarLote(Lote* lote, int ordem, int numSistemas);
+
+/**
+ * @brief Libera as matrizes do lote (seguro com lote já liberado).
+ */
+void liberarLote(Lote* lote);
+
+/**
+ * @brief Copia a matriz A (double**, ordem n) para o sistema @p sistema do lote.
+ */
+void loteDefinirMatriz(Lote* lote, int sistema, double** matrizA);
+
+/**
+ * @brief Copia o vetor b (tamanho n) para o sistema @p sistema do lote.
+ */
+void loteDefinirVetor(Lote* lote, int sistema, const double* vetorB);
+
+/**
+ * @brief Copia o vetor do sistema @p sistema (x, após loteResolver) para @p vetorX.
+ */
+void loteObterVetor(const Lote* lote, int sistema, double* vetorX);
+
+/**
+ * @brief Fatora todos os sistemas do lote (PA = LU, pivotamento parcial), no lugar.
+ *
+ * Um sistema é marcado singular se algum |pivô| < tolerancia (ou pivô nulo);
+ * as demais pistas do grupo não são afetadas.
+ *
+ * @param lote       Lote com as matrizes A.
+ * @param tolerancia Valor mínimo aceito para |pivô|.
+ * @param singular   (opcional) numSistemas posições: 1 se o sistema for singular; NULL ignora.
+ * @return Número de sistemas singulares.
+ */
+int loteFatorar(Lote* lote, double tolerancia, unsigned char* singular);
+
+/**
+ * @brief Resolve todos os sistemas já fatorados: vetores b são substituídos por x.
+ *
+ * Pode ser chamada várias vezes (um novo b por chamada) após uma única loteFatorar().
+ */
+void loteResolver(const Lote* lote);
+
+/**
+ * @brief Fatora e resolve todos os sistemas do lote (loteFatorar + loteResolver).
+ *
+ * @return Número de sistemas singulares (suas soluções não são confiáveis).
+ */
+int loteResolverSistemas(Lote* lote, double tolerancia, unsigned char* singular);
+
+#endif /* LOTE_H */
@@ -0,0 +1,224 @@
+/**
+ * @file lote_nucleo.h
+ * @brief Modelo dos núcleos de lote.c, incluído uma vez por conjunto de instruções.
+ *
+ * Antes de incluir, lote.c define:
+ *  - LOTE_SUFIXO: sufixo dos nomes gerados (Padrao, AVX2, AVX512);
+ *  - LOTE_ALVO:   atributo de alvo das funções geradas (pode ser vazio);
+ *  - LOTE_T / LOTE_M: vetor de doubles e máscara com a largura nativa do alvo;
+ *  - LOTE_VL:     número de doubles em LOTE_T (divide LOTE_LARGURA).
+ *
+ * Cada grupo de LOTE_LARGURA pistas é tratado em LOTE_LARGURA / LOTE_VL fatias
+ * de LOTE_VL pistas, sempre com vetores do tamanho de um registrador.
+ * Sem proteção de inclusão múltipla, de propósito.
+ */
+
+#define LOTE_JUNTAR_(a, b) a##b
+#define LOTE_JUNTAR(a, b)  LOTE_JUNTAR_(a, b)
+#define LOTE_NOME(nome)    LOTE_JUNTAR(nome, LOTE_SUFIXO)
+
+#define LOTE_CARREGAR(p)         (*(const LOTE_T*)(p))
+#define LOTE_GUARDAR(p, v)       (*(LOTE_T*)(p) = (v))
+#define LOTE_SELECIONAR(m, a, b) ((LOTE_T)((((LOTE_M)(a)) & (m)) | (((LOTE_M)(b)) & ~(m))))
+#define LOTE_ABS(v)              ((LOTE_T)(((LOTE_M)(v)) & ((LOTE_M){ 0 } + 0x7fffffffffffffffLL)))
+#define LOTE_REPLICAR(x)         ((LOTE_T){ 0 } + (double)(x))
+/* Desenrola por completo quando a ordem é constante (mantém a fatia em registradores) */
+#define LOTE_DESENROLAR          _Pragma("GCC unroll 4")
+
+/**
+ * @brief PA = LU de uma fatia de LOTE_VL pistas, com pivotamento parcial mascarado.
+ *
+ * A fatia é copiada para um vetor local (registradores, quando a ordem é
+ * constante e pequena), fatorada ali e devolvida ao lote no fim.
+ *
+ * @return Bits das pistas singulares da fatia (bit p = pista p da fatia).
+ */
+static inline __attribute__((always_inline)) LOTE_ALVO
+unsigned LOTE_NOME(fatorarFatia)(double* restrict bloco, double* restrict pivos,
+                                 int ordem, double tolerancia) {
+    LOTE_T a[LOTE_ORDEM_MAX][LOTE_ORDEM_MAX];
+    LOTE_M singular = { 0 };
+
+    LOTE_DESENROLAR
+
+    for (int i = 0; i < ordem; i++) {
+        LOTE_DESENROLAR
+        for (int j = 0; j < ordem; j++) {
+            a[i][j] = LOTE_CARREGAR(ELEM(bloco, ordem, i, j));
+        }
+    }
+
+    LOTE_DESENROLAR
+
+    for (int k = 0; k < ordem; k++) {
+        /* (1) Busca do pivô: maior |A(i,k)|, i >= k, escolhido por pista */
+        LOTE_T melhor = LOTE_ABS(a[k][k]);
+        LOTE_T linhaPivo = LOTE_REPLICAR(k);
+        LOTE_DESENROLAR
+        for (int i = k + 1; i < ordem; i++) {
+            LOTE_T candidato = LOTE_ABS(a[i][k]);
+            LOTE_M maior = candidato > melhor;
+            melhor = LOTE_SELECIONAR(maior, candidato, melhor);
+            linhaPivo = LOTE_SELECIONAR(maior, LOTE_REPLICAR(i), linhaPivo);
+        }
+        LOTE_GUARDAR(COMP(pivos, k), linhaPivo);
+        /* A negação também pega pivô nulo e NaN */
+        singular |= ~((melhor >= tolerancia) & (melhor > 0.0));
+
+        /* (2) Troca mascarada: cada pista troca a linha k com a sua linha de pivô */
+        LOTE_DESENROLAR
+        for (int i = k + 1; i < ordem; i++) {
+            LOTE_M troca = linhaPivo == (double) i;
+            LOTE_DESENROLAR
+            for (int j = 0; j < ordem; j++) {
+                LOTE_T ak = a[k][j];
+                a[k][j] = LOTE_SELECIONAR(troca, a[i][j], ak);
+                a[i][j] = LOTE_SELECIONAR(troca, ak, a[i][j]);
+            }
+        }
+
+        /* (3) Eliminação abaixo do pivô; multiplicadores ficam em L */
+        LOTE_T inversoPivo = 1.0 / a[k][k];
+        LOTE_DESENROLAR
+        for (int i = k + 1; i < ordem; i++) {
+            LOTE_T multiplicador = a[i][k] * inversoPivo;
+            a[i][k] = multiplicador;
+            LOTE_DESENROLAR
+            for (int j = k + 1; j < ordem; j++) {
+                a[i][j] -= multiplicador * a[k][j];
+            }
+        }
+    }
+
+    LOTE_DESENROLAR
+
+    for (int i = 0; i < ordem; i++) {
+        LOTE_DESENROLAR
+        for (int j = 0; j < ordem; j++) {
+            LOTE_GUARDAR(ELEM(bloco, ordem, i, j), a[i][j]);
+        }
+    }
+
+    unsigned bits = 0;
+    LOTE_DESENROLAR
+    for (int p = 0; p < LOTE_VL; p++) {
+        if (singular[p]) bits |= 1u << p;
+    }
+    return bits;
+}
+
+/**
+ * @brief Resolve LUx = Pb numa fatia de LOTE_VL pistas (b é sobrescrito por x).
+ */
+static inline __attribute__((always_inline)) LOTE_ALVO
+void LOTE_NOME(resolverFatia)(const double* restrict bloco, const double* restrict pivos,
+                              double* restrict vetor, int ordem) {
+    LOTE_T v[LOTE_ORDEM_MAX];
+    LOTE_DESENROLAR
+    for (int i = 0; i < ordem; i++) {
+        v[i] = LOTE_CARREGAR(COMP(vetor, i));
+    }
+
+    /* (1) Aplica P, na mesma ordem das trocas da fatoração */
+    LOTE_DESENROLAR
+    for (int k = 0; k < ordem - 1; k++) {
+        LOTE_T linhaPivo = LOTE_CARREGAR(COMP(pivos, k));
+        LOTE_DESENROLAR
+        for (int i = k + 1; i < ordem; i++) {
+            LOTE_M troca = linhaPivo == (double) i;
+            LOTE_T bk = v[k];
+            v[k] = LOTE_SELECIONAR(troca, v[i], bk);
+            v[i] = LOTE_SELECIONAR(troca, bk, v[i]);
+        }
+    }
+
+    /* (2) Progressiva: Ly = Pb (diagonal de L = 1) */
+    LOTE_DESENROLAR
+    for (int i = 1; i < ordem; i++) {
+        LOTE_DESENROLAR
+        for (int j = 0; j < i; j++) {
+            v[i] -= LOTE_CARREGAR(ELEM(bloco, ordem, i, j)) * v[j];
+        }
+    }
+
+    /* (3) Regressiva: Ux = y */
+    LOTE_DESENROLAR
+    for (int i = ordem - 1; i >= 0; i--) {
+        LOTE_DESENROLAR
+        for (int j = i + 1; j < ordem; j++) {
+            v[i] -= LOTE_CARREGAR(ELEM(bloco, ordem, i, j)) * v[j];
+        }
+        v[i] /= LOTE_CARREGAR(ELEM(bloco, ordem, i, i));
+    }
+
+    LOTE_DESENROLAR
+
+    for (int i = 0; i < ordem; i++) {
+        LOTE_GUARDAR(COMP(vetor, i), v[i]);
+    }
+}
+
+/* Grupo inteiro = LOTE_LARGURA / LOTE_VL fatias; ordem constante desenrola os laços */
+static inline __attribute__((always_inline)) LOTE_ALVO
+unsigned LOTE_NOME(fatorarGrupo)(double* bloco, double* pivos, int ordem, double tolerancia) {
+    unsigned bits = 0;
+    for (int f = 0; f < LOTE_LARGURA; f += LOTE_VL) {
+        bits |= LOTE_NOME(fatorarFatia)(bloco + f, pivos + f, ordem, tolerancia) << f;
+    }
+    return bits;
+}
+
+static inline __attribute__((always_inline)) LOTE_ALVO
+void LOTE_NOME(resolverGrupo)(const double* bloco, const double* pivos, double* vetor, int ordem) {
+    for (int f = 0; f < LOTE_LARGURA; f += LOTE_VL) {
+        LOTE_NOME(resolverFatia)(bloco + f, pivos + f, vetor + f, ordem);
+    }
+}
+
+LOTE_ALVO static int LOTE_NOME(fatorarLote)(const Lote* lote, double tolerancia,
+                                            unsigned char* singular) {
+    int totalSingulares = 0;
+    for (int g = 0; g < lote->numGrupos; g++) {
+        double* bloco = lote->matrizes->linhas[g];
+        double* pivos = lote->pivos->linhas[g];
+        unsigned bits;
+        switch (lote->ordem) {
+            case 2:  bits = LOTE_NOME(fatorarGrupo)(bloco, pivos, 2, tolerancia); break;
+            case 3:  bits = LOTE_NOME(fatorarGrupo)(bloco, pivos, 3, tolerancia); break;
+            case 4:  bits = LOTE_NOME(fatorarGrupo)(bloco, pivos, 4, tolerancia); break;
+            default: bits = LOTE_NOME(fatorarGrupo)(bloco, pivos, lote->ordem, tolerancia);
+        }
+        for (int p = 0; p < LOTE_LARGURA; p++) {
+            int sistema = g * LOTE_LARGURA + p;
+            if (sistema >= lote->numSistemas) break;
+            int s = (bits >> p) & 1u;
+            totalSingulares += s;
+            if (singular) singular[sistema] = (unsigned char) s;
+        }
+    }
+    return totalSingulares;
+}
+
+LOTE_ALVO static void LOTE_NOME(resolverLote)(const Lote* lote) {
+    for (int g = 0; g < lote->numGrupos; g++) {
+        const double* bloco = lote->matrizes->linhas[g];
+        const double* pivos = lote->pivos->linhas[g];
+        double* vetor = lote->vetores->linhas[g];
+        switch (lote->ordem) {
+            case 2:  LOTE_NOME(resolverGrupo)(bloco, pivos, vetor, 2); break;
+            case 3:  LOTE_NOME(resolverGrupo)(bloco, pivos, vetor, 3); break;
+            case 4:  LOTE_NOME(resolverGrupo)(bloco, pivos, vetor, 4); break;
+            default: LOTE_NOME(resolverGrupo)(bloco, pivos, vetor, lote->ordem);
+        }
+    }
+}
+
+#undef LOTE_JUNTAR_
+#undef LOTE_JUNTAR
+#undef LOTE_NOME
+#undef LOTE_CARREGAR
+#undef LOTE_GUARDAR
+#undef LOTE_SELECIONAR
+#undef LOTE_ABS
+#undef LOTE_REPLICAR
+#undef LOTE_DESENROLAR
@@ -1,7 +1,12 @@
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
+#include <float.h>
+#include <string.h>
 #include "lu.h"
+#include "lu_fixo.h"
+#include "kernels.h"
+#include "residuo_estendido.h"
 #include "utils.h"
 
 /* Flag interna de aviso (pivô ~ 0) */
@@ -14,6 +19,7 @@ static int g_flagPivoQuaseZero = 0;
  * A = L * U, onde:
  *  - U é obtida fazendo eliminações em A (escalonando linhas)
  *  - L guarda os multiplicadores abaixo da diagonal e 1 na diagonal
+ * A ordem dos laços é a de luVariante() (padrão: right-looking).
  */
 LUStatus luDecomposicao(double** matrizA,
                         int ordemMatriz,
@@ -21,44 +27,394 @@ LUStatus luDecomposicao(double** matrizA,
                         double** matrizU,
                         double tolerancia)
 {
-    // (1) Inicializar U como cópia de A e L como identidade
+    return luDecomposicaoVariante(matrizA, ordemMatriz, matrizL, matrizU, tolerancia, luVariante());
+}
+
+// ============================================================
+// LU RECURSIVA (cache-oblivious)
+//
+// Divide as colunas ao meio: fatora a metade esquerda, resolve o bloco
+// U12 (TRSM, também recursivo) e atualiza A22 -= L21 * U12 (GEMM), depois
+// fatora a metade direita. Quase todo o trabalho vira multiplicação de
+// matrizes em blocos cada vez menores, que cabem em algum nível de cache
+// sem depender de um tamanho de bloco ajustado por máquina.
+// ============================================================
+
+/* Largura do painel eliminado diretamente no fim da recursão */
+#define LU_RECURSAO_BASE 16
+/* Profundidade (k) máxima de um produto folha: painéis empacotados cabem no L1/L2 */
+#define LU_GEMM_BASE 128
+/* Ladrilho do micro-kernel e largura das faixas de colunas da folha */
+#define MK_LINHAS  KERNEL_MK_LINHAS
+#define MK_COLUNAS KERNEL_MK_COLUNAS
+#define FAIXA_COLUNAS 256
+
+/* Painéis empacotados reaproveitados por todas as folhas do produto */
+typedef struct {
+    double* painelU; /* LU_GEMM_BASE × FAIXA_COLUNAS */
+    double* painelL; /* LU_GEMM_BASE × MK_LINHAS */
+} LuRecursivaTrabalho;
+
+/**
+ * @brief Folha do produto: m[i][j] -= sum_p m[i][inicioPainel+p] * m[inicioPainel+p][j],
+ *        para i em [linhaIni, linhaFim) e j em [colunaIni, colunaFim), com p < larguraPainel.
+ */
+static void produtoFolha(const LuRecursivaTrabalho* trabalho, double** matriz,
+                         int linhaIni, int linhaFim, int colunaIni, int colunaFim,
+                         int inicioPainel, int larguraPainel) {
+    int gruposLinhas = (linhaFim - linhaIni) / MK_LINHAS;
+    int linhasCheias = linhaIni + gruposLinhas * MK_LINHAS;
+
+    for (int faixa = colunaIni; faixa < colunaFim; faixa += FAIXA_COLUNAS) {
+        int fimFaixa = faixa + FAIXA_COLUNAS;
+        if (fimFaixa > colunaFim) fimFaixa = colunaFim;
+        int colunasCheias = faixa + ((fimFaixa - faixa) / MK_COLUNAS) * MK_COLUNAS;
+
+        // empacota U12[:, faixa] em blocos de MK_COLUNAS colunas
+        for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS) {
+            double* destino = trabalho->painelU + (size_t)(coluna - faixa) * larguraPainel;
+            for (int p = 0; p < larguraPainel; p++)
+                for (int j = 0; j < MK_COLUNAS; j++)
+                    destino[p * MK_COLUNAS + j] = matriz[inicioPainel + p][coluna + j];
+        }
+
+        for (int linha = linhaIni; linha < linhaFim; linha += MK_LINHAS) {
+            int cheia = linha < linhasCheias;
+            int fimGrupo = cheia ? linha + MK_LINHAS : linhaFim;
+
+            if (cheia) {
+                double* linhasC[MK_LINHAS];
+                for (int p = 0; p < larguraPainel; p++)
+                    for (int i = 0; i < MK_LINHAS; i++)
+                        trabalho->painelL[p * MK_LINHAS + i] = matriz[linha + i][inicioPainel + p];
+
+                for (int coluna = faixa; coluna < colunasCheias; coluna += MK_COLUNAS) {
+                    for (int i = 0; i < MK_LINHAS; i++) linhasC[i] = matriz[linha + i] + coluna;
+                    kernelMicroAtualizacao(linhasC, trabalho->painelL,
+                                           trabalho->painelU + (size_t)(coluna - faixa) * larguraPainel,
+                                           larguraPainel);
+                }
+            }
+
+            // bordas: colunas que não fecham um ladrilho (ou linhas que não fecham um grupo)
+            int colunaBorda = cheia ? colunasCheias : faixa;
+            if (colunaBorda >= fimFaixa) continue;
+            for (int i = linha; i < fimGrupo; i++) {
+                double* linhaC = matriz[i];
+                for (int p = inicioPainel; p < inicioPainel + larguraPainel; p++) {
+                    double l = linhaC[p];
+                    if (l == 0.0) continue;
+                    kernelAtualizarLinha(linhaC + colunaBorda, matriz[p] + colunaBorda,
+                                         l, fimFaixa - colunaBorda);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief A22 -= L21 * U12 dividindo a profundidade ao meio até LU_GEMM_BASE.
+ */
+static void produtoRecursivo(const LuRecursivaTrabalho* trabalho, double** matriz,
+                             int linhaIni, int linhaFim, int colunaIni, int colunaFim,
+                             int inicioPainel, int larguraPainel) {
+    if (linhaIni >= linhaFim || colunaIni >= colunaFim || larguraPainel <= 0) return;
+    if (larguraPainel > LU_GEMM_BASE) {
+        int metade = larguraPainel / 2;
+        produtoRecursivo(trabalho, matriz, linhaIni, linhaFim, colunaIni, colunaFim,
+                         inicioPainel, metade);
+        produtoRecursivo(trabalho, matriz, linhaIni, linhaFim, colunaIni, colunaFim,
+                         inicioPainel + metade, larguraPainel - metade);
+        return;
+    }
+    produtoFolha(trabalho, matriz, linhaIni, linhaFim, colunaIni, colunaFim,
+                 inicioPainel, larguraPainel);
+}
+
+/**
+ * @brief U12 = L11^{-1} A12 (L11 unitária nas linhas/colunas [linhaIni, linhaFim)),
+ *        dividindo L11 ao meio: TRSM de cima, GEMM, TRSM de baixo.
+ */
+static void trsmRecursiva(const LuRecursivaTrabalho* trabalho, double** matriz,
+                          int linhaIni, int linhaFim, int colunaIni, int colunaFim) {
+    int altura = linhaFim - linhaIni;
+    if (altura <= LU_RECURSAO_BASE) {
+        for (int k = linhaIni; k < linhaFim; k++) {
+            for (int linha = k + 1; linha < linhaFim; linha++) {
+                double multiplicador = matriz[linha][k];
+                if (multiplicador == 0.0) continue;
+                kernelAtualizarLinha(matriz[linha] + colunaIni, matriz[k] + colunaIni,
+                                     multiplicador, colunaFim - colunaIni);
+            }
+        }
+        return;
+    }
+    int meio = linhaIni + altura / 2;
+    trsmRecursiva(trabalho, matriz, linhaIni, meio, colunaIni, colunaFim);
+    produtoRecursivo(trabalho, matriz, meio, linhaFim, colunaIni, colunaFim,
+                     linhaIni, meio - linhaIni);
+    trsmRecursiva(trabalho, matriz, meio, linhaFim, colunaIni, colunaFim);
+}
+
+/**
+ * @brief Elimina diretamente (right-looking) as colunas [colunaIni, colunaFim),
+ *        atualizando só essas colunas; multiplicadores ficam abaixo da diagonal.
+ */
+static void eliminarColunas(double** matriz, int ordemMatriz, int colunaIni, int colunaFim,
+                            double tolerancia) {
+    for (int k = colunaIni; k < colunaFim; k++) {
+        double pivo = matriz[k][k];
+        if (k < ordemMatriz - 1 && fabs(pivo) < tolerancia) {
+            g_flagPivoQuaseZero = 1; // mesma regra de luDecomposicao
+        }
+        for (int linha = k + 1; linha < ordemMatriz; linha++) {
+            double multiplicador = matriz[linha][k] / pivo;
+            matriz[linha][k] = multiplicador;
+            if (k + 1 < colunaFim) {
+                kernelAtualizarLinha(matriz[linha] + k + 1, matriz[k] + k + 1,
+                                     multiplicador, colunaFim - k - 1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Fatora as colunas [colunaIni, colunaFim) das linhas [colunaIni, n), no lugar.
+ */
+static void luRecursivaNucleo(const LuRecursivaTrabalho* trabalho, double** matriz,
+                              int ordemMatriz, int colunaIni, int colunaFim,
+                              double tolerancia) {
+    int largura = colunaFim - colunaIni;
+    if (largura <= LU_RECURSAO_BASE) {
+        eliminarColunas(matriz, ordemMatriz, colunaIni, colunaFim, tolerancia);
+        return;
+    }
+
+    int meio = colunaIni + largura / 2;
+    luRecursivaNucleo(trabalho, matriz, ordemMatriz, colunaIni, meio, tolerancia);
+    trsmRecursiva(trabalho, matriz, colunaIni, meio, meio, colunaFim);
+    produtoRecursivo(trabalho, matriz, meio, ordemMatriz, meio, colunaFim,
+                     colunaIni, meio - colunaIni);
+    luRecursivaNucleo(trabalho, matriz, ordemMatriz, meio, colunaFim, tolerancia);
+}
+
+/* L <- multiplicadores (diag = 1) e zera o triângulo inferior de U (U contém L\U) */
+static void separarLU(double** matrizL, double** matrizU, int ordemMatriz) {
     for (int linha = 0; linha < ordemMatriz; linha++) {
         for (int coluna = 0; coluna < ordemMatriz; coluna++) {
-            matrizU[linha][coluna] = matrizA[linha][coluna];          // U <- A
-            matrizL[linha][coluna] = (linha == coluna) ? 1.0 : 0.0;   // L <- I
+            if (coluna < linha) {
+                matrizL[linha][coluna] = matrizU[linha][coluna];
+                matrizU[linha][coluna] = 0.0;
+            } else {
+                matrizL[linha][coluna] = (linha == coluna) ? 1.0 : 0.0;
+            }
         }
     }
+}
+
+static void copiarParaU(double** matrizA, double** matrizU, int ordemMatriz) {
+    for (int linha = 0; linha < ordemMatriz; linha++)
+        for (int coluna = 0; coluna < ordemMatriz; coluna++)
+            matrizU[linha][coluna] = matrizA[linha][coluna];
+}
+
+LUStatus luRecursiva(double** matrizA,
+                     int ordemMatriz,
+                     double** matrizL,
+                     double** matrizU,
+                     double tolerancia)
+{
+    LuRecursivaTrabalho trabalho;
+    trabalho.painelU = (double*) malloc((size_t)LU_GEMM_BASE * FAIXA_COLUNAS * sizeof(double));
+    trabalho.painelL = (double*) malloc((size_t)LU_GEMM_BASE * MK_LINHAS * sizeof(double));
+
+    // (1) U <- A; a fatoração acontece no lugar, com L abaixo da diagonal
+    copiarParaU(matrizA, matrizU, ordemMatriz);
+    if (trabalho.painelU && trabalho.painelL) {
+        luRecursivaNucleo(&trabalho, matrizU, ordemMatriz, 0, ordemMatriz, tolerancia);
+    } else {
+        eliminarColunas(matrizU, ordemMatriz, 0, ordemMatriz, tolerancia); // sem memória: direto
+    }
 
-    // (2) Loop de pivôs: elimina abaixo da diagonal, coluna por coluna
+    // (2) separa os multiplicadores em L (diag = 1) e zera o triângulo inferior de U
+    separarLU(matrizL, matrizU, ordemMatriz);
+
+    free(trabalho.painelU);
+    free(trabalho.painelL);
+    return LU_OK;
+}
+
+// ============================================================
+// VARIANTES (ordem dos laços), todas no lugar sobre L\U
+//
+//   direita  (kij): a cada pivô k, todas as linhas abaixo são atualizadas;
+//                   a submatriz restante inteira é lida e escrita n vezes.
+//   esquerda (ikj): versão por linhas do left-looking (o armazenamento aqui
+//                   é por linhas): a linha i recebe de uma vez as
+//                   contribuições das linhas 0..i-1 de U e só ela é escrita.
+//   Crout         : no passo k, a linha k de U (combinação das linhas de U
+//                   anteriores) e a coluna k de L (produtos internos com a
+//                   coluna k de U, copiada para um vetor contíguo).
+//
+// direita e esquerda fazem exatamente as mesmas operações em cada elemento
+// (mesmas chamadas de kernelAtualizarLinha), então dão L e U idênticos bit a
+// bit; Crout acumula os produtos internos antes de subtrair e difere só no
+// arredondamento.
+// ============================================================
+
+static LUVariante g_variante = LU_VARIANTE_DIREITA;
+static int g_varianteEscolhida = 0; /* 0: ainda não lida de LU_VARIANTE */
+
+static void avisarPivo(double pivo, int indicePivo, int ordemMatriz, double tolerancia) {
+    if (indicePivo < ordemMatriz - 1 && fabs(pivo) < tolerancia) {
+        g_flagPivoQuaseZero = 1; // mesma regra de luDecomposicao: o último pivô não conta
+    }
+}
+
+static void luDireitaCompacta(double** matriz, int ordemMatriz, double tolerancia) {
     for (int indicePivo = 0; indicePivo < ordemMatriz - 1; indicePivo++) {
-        double valorPivo = matrizU[indicePivo][indicePivo];
+        double valorPivo = matriz[indicePivo][indicePivo];
+        avisarPivo(valorPivo, indicePivo, ordemMatriz, tolerancia);
+
+        for (int linhaEliminada = indicePivo + 1; linhaEliminada < ordemMatriz; linhaEliminada++) {
+            double* linha = matriz[linhaEliminada];
+            double multiplicador = linha[indicePivo] / valorPivo;
 
-        // Aviso (sem abortar)
-        if (fabs(valorPivo) < tolerancia) {
-            g_flagPivoQuaseZero = 1;
-            // segue o cálculo mesmo assim
+            // atualiza a linha a partir da coluna do pivô (que vira ~0) e
+            // então guarda o multiplicador no lugar dela
+            kernelAtualizarLinha(linha + indicePivo, matriz[indicePivo] + indicePivo,
+                                 multiplicador, ordemMatriz - indicePivo);
+            linha[indicePivo] = multiplicador;
         }
+    }
+}
 
-        // (2.1) Para cada linha abaixo do pivô, zere a entrada na coluna do pivô
-        for (int linhaEliminada = indicePivo + 1; linhaEliminada < ordemMatriz; linhaEliminada++) {
-            double multiplicador = matrizU[linhaEliminada][indicePivo] / valorPivo;
-            matrizL[linhaEliminada][indicePivo] = multiplicador; // guarda multiplicador em L
-
-            // Atualiza toda a linha (inclusive a coluna do pivô, que vira 0)
-            for (int colunaAtual = indicePivo; colunaAtual < ordemMatriz; colunaAtual++) {
-                double antes = matrizU[linhaEliminada][colunaAtual];
-                double termo = multiplicador * matrizU[indicePivo][colunaAtual];
-                matrizU[linhaEliminada][colunaAtual] = antes - termo;
+static void luEsquerdaCompacta(double** matriz, int ordemMatriz, double tolerancia) {
+    for (int linhaAtual = 0; linhaAtual < ordemMatriz; linhaAtual++) {
+        double* linha = matriz[linhaAtual];
+
+        // contribuições das linhas de U já prontas, na mesma ordem da direita
+        for (int k = 0; k < linhaAtual; k++) {
+            double multiplicador = linha[k] / matriz[k][k];
+            kernelAtualizarLinha(linha + k, matriz[k] + k, multiplicador, ordemMatriz - k);
+            linha[k] = multiplicador;
+        }
+        avisarPivo(linha[linhaAtual], linhaAtual, ordemMatriz, tolerancia);
+    }
+}
+
+static int luCroutCompacta(double** matriz, int ordemMatriz, double tolerancia) {
+    double* colunaU = (double*) malloc((ordemMatriz > 0 ? ordemMatriz : 1) * sizeof(double));
+    if (!colunaU) return 1;
+
+    for (int k = 0; k < ordemMatriz; k++) {
+        double* linhaK = matriz[k];
+
+        // (a) linha k de U: u_kj = a_kj - sum_{p<k} l_kp u_pj, para j >= k
+        for (int p = 0; p < k; p++)
+            kernelAtualizarLinha(linhaK + k, matriz[p] + k, linhaK[p], ordemMatriz - k);
+
+        double pivo = linhaK[k];
+        avisarPivo(pivo, k, ordemMatriz, tolerancia);
+
+        // (b) coluna k de L: l_ik = (a_ik - <l_i[0:k], u[0:k][k]>) / u_kk, para i > k
+        for (int p = 0; p < k; p++) colunaU[p] = matriz[p][k];
+        for (int i = k + 1; i < ordemMatriz; i++) {
+            const double* linhaI = matriz[i];
+            double soma0 = 0.0, soma1 = 0.0, soma2 = 0.0, soma3 = 0.0;
+            int p = 0;
+            for (; p + 4 <= k; p += 4) {
+                soma0 += linhaI[p]     * colunaU[p];
+                soma1 += linhaI[p + 1] * colunaU[p + 1];
+                soma2 += linhaI[p + 2] * colunaU[p + 2];
+                soma3 += linhaI[p + 3] * colunaU[p + 3];
             }
+            for (; p < k; p++) soma0 += linhaI[p] * colunaU[p];
+            matriz[i][k] = (linhaI[k] - ((soma0 + soma1) + (soma2 + soma3))) / pivo;
         }
     }
 
+    free(colunaU);
+    return 0;
+}
+
+LUStatus luDecomposicaoCompactaVariante(double** matrizA, int ordemMatriz, double tolerancia,
+                                        LUVariante variante)
+{
+    switch (variante) {
+        case LU_VARIANTE_RECURSIVA:
+            return luDecomposicaoCompacta(matrizA, ordemMatriz, tolerancia);
+        case LU_VARIANTE_CROUT:
+            if (luCroutCompacta(matrizA, ordemMatriz, tolerancia) == 0) return LU_OK;
+            break; // sem memória para a coluna de U: segue pela direita
+        case LU_VARIANTE_ESQUERDA:
+            luEsquerdaCompacta(matrizA, ordemMatriz, tolerancia);
+            return LU_OK;
+        default:
+            break;
+    }
+    luDireitaCompacta(matrizA, ordemMatriz, tolerancia);
     return LU_OK;
 }
 
+LUStatus luDecomposicaoVariante(double** matrizA, int ordemMatriz, double** matrizL,
+                                double** matrizU, double tolerancia, LUVariante variante)
+{
+    if (variante == LU_VARIANTE_RECURSIVA)
+        return luRecursiva(matrizA, ordemMatriz, matrizL, matrizU, tolerancia);
+
+    // (0) Ordens pequenas (2..16): versão desenrolada de lu_fixo.c (mesmas
+    //     operações de direita/esquerda; Crout fica com os próprios laços)
+    LuFixoDecomposicao fixa = luFixoDecomposicao(ordemMatriz);
+    if (fixa && variante != LU_VARIANTE_CROUT) {
+        if (fixa(matrizA, matrizL, matrizU, tolerancia)) g_flagPivoQuaseZero = 1;
+        return LU_OK;
+    }
+
+    // (1) U <- A, fatoração no lugar e separação de L
+    copiarParaU(matrizA, matrizU, ordemMatriz);
+    luDecomposicaoCompactaVariante(matrizU, ordemMatriz, tolerancia, variante);
+    separarLU(matrizL, matrizU, ordemMatriz);
+    return LU_OK;
+}
+
+void luDefinirVariante(LUVariante variante) {
+    g_variante = variante;
+    g_varianteEscolhida = 1;
+}
+
+/* Primeira chamada: direita, ou LU_VARIANTE=direita|esquerda|crout|recursiva */
+LUVariante luVariante(void) {
+    if (!g_varianteEscolhida) {
+        const char* escolha = getenv("LU_VARIANTE");
+        if (escolha) {
+            if      (strcmp(escolha, "esquerda") == 0)  g_variante = LU_VARIANTE_ESQUERDA;
+            else if (strcmp(escolha, "crout") == 0)     g_variante = LU_VARIANTE_CROUT;
+            else if (strcmp(escolha, "recursiva") == 0) g_variante = LU_VARIANTE_RECURSIVA;
+        }
+        g_varianteEscolhida = 1;
+    }
+    return g_variante;
+}
+
+const char* luNomeVariante(LUVariante variante) {
+    switch (variante) {
+        case LU_VARIANTE_ESQUERDA:  return "esquerda";
+        case LU_VARIANTE_CROUT:     return "crout";
+        case LU_VARIANTE_RECURSIVA: return "recursiva";
+        default:                    return "direita";
+    }
+}
+
 int substituicaoProgressiva(double** matrizL, const double* vetorB,
                             double* vetorY, int ordemMatriz, double tolerancia)
 {
+    LuFixoSubstituicao fixa = luFixoProgressiva(ordemMatriz);
+    if (fixa) {
+        if (fixa(matrizL, vetorB, vetorY, tolerancia)) g_flagPivoQuaseZero = 1;
+        return 0;
+    }
+
     for (int i = 0; i < ordemMatriz; i++) {
         double soma = 0.0;
         for (int j = 0; j < i; j++) soma += matrizL[i][j] * vetorY[j];
@@ -75,6 +431,12 @@ int substituicaoProgressiva(double** matrizL, const double* vetorB,
 int substituicaoRegressiva_U(double** matrizU, const double* vetorY,
                              double* vetorX, int ordemMatriz, double tolerancia)
 {
+    LuFixoSubstituicao fixa = luFixoRegressiva(ordemMatriz);
+    if (fixa) {
+        if (fixa(matrizU, vetorY, vetorX, tolerancia)) g_flagPivoQuaseZero = 1;
+        return 0;
+    }
+
     for (int i = ordemMatriz - 1; i >= 0; i--) {
         double soma = 0.0;
         for (int j = i + 1; j < ordemMatriz; j++) soma += matrizU[i][j] * vetorX[j];
@@ -132,6 +494,311 @@ int inversaPorLU(double** matrizA, int ordemMatriz, double tolerancia,
 }
 
 
+/* ============================================================
+   LU COMPACTA (no lugar, layout do getrf)
+   A vira L\U: multiplicadores abaixo da diagonal (diag(L) = 1
+   implícita) e U no triângulo superior. Uma só matriz n x n.
+   ============================================================ */
+
+/* Linhas (em U⁻¹) e colunas (em X L = U⁻¹) tratadas juntas na inversa no lugar */
+#define LU_INVERSA_BLOCO 32
+
+LUStatus luDecomposicaoCompacta(double** matrizA, int ordemMatriz, double tolerancia)
+{
+    // (0) ordens pequenas: versão desenrolada, que grava L\U quando L == U
+    LuFixoDecomposicao fixa = luFixoDecomposicao(ordemMatriz);
+    if (fixa) {
+        if (fixa(matrizA, matrizA, matrizA, tolerancia)) g_flagPivoQuaseZero = 1;
+        return LU_OK;
+    }
+
+    // (1) recursiva, no lugar; os painéis empacotados são o único espaço extra
+    LuRecursivaTrabalho trabalho;
+    trabalho.painelU = (double*) malloc((size_t)LU_GEMM_BASE * FAIXA_COLUNAS * sizeof(double));
+    trabalho.painelL = (double*) malloc((size_t)LU_GEMM_BASE * MK_LINHAS * sizeof(double));
+    if (trabalho.painelU && trabalho.painelL) {
+        luRecursivaNucleo(&trabalho, matrizA, ordemMatriz, 0, ordemMatriz, tolerancia);
+    } else {
+        eliminarColunas(matrizA, ordemMatriz, 0, ordemMatriz, tolerancia);
+    }
+
+    free(trabalho.painelU);
+    free(trabalho.painelL);
+    return LU_OK;
+}
+
+int luResolverCompacta(double** matrizLU, const double* vetorB, double* vetorX,
+                       int ordemMatriz, double tolerancia)
+{
+    // (1) L y = b, diagonal unitária (y fica em vetorX)
+    for (int i = 0; i < ordemMatriz; i++) {
+        const double* linha = matrizLU[i];
+        double soma = 0.0;
+        for (int j = 0; j < i; j++) soma += linha[j] * vetorX[j];
+        vetorX[i] = vetorB[i] - soma;
+    }
+
+    // (2) U x = y (só o triângulo superior é lido, então a versão fixa serve)
+    LuFixoSubstituicao fixa = luFixoRegressiva(ordemMatriz);
+    if (fixa) {
+        if (fixa(matrizLU, vetorX, vetorX, tolerancia)) g_flagPivoQuaseZero = 1;
+        return 0;
+    }
+    for (int i = ordemMatriz - 1; i >= 0; i--) {
+        const double* linha = matrizLU[i];
+        double soma = 0.0;
+        for (int j = i + 1; j < ordemMatriz; j++) soma += linha[j] * vetorX[j];
+
+        if (fabs(linha[i]) < tolerancia) {
+            g_flagPivoQuaseZero = 1; // avisa e segue
+        }
+        vetorX[i] = (vetorX[i] - soma) / linha[i];
+    }
+    return 0;
+}
+
+int inversaAPartirDeLUCompacta(double** matrizLU, double** matrizInversa,
+                               int ordemMatriz, double tolerancia)
+{
+    double* vetorX = (double*) malloc(ordemMatriz * sizeof(double));
+    if (!vetorX) return 1;
+
+    for (int j = 0; j < ordemMatriz; j++) {
+        for (int i = 0; i < ordemMatriz; i++) vetorX[i] = (i == j) ? 1.0 : 0.0;
+        luResolverCompacta(matrizLU, vetorX, vetorX, ordemMatriz, tolerancia);
+        for (int i = 0; i < ordemMatriz; i++) matrizInversa[i][j] = vetorX[i];
+    }
+
+    free(vetorX);
+    return 0;
+}
+
+/*
+ * U <- U^{-1}, em blocos de LU_INVERSA_BLOCO linhas, de baixo para cima.
+ * Linha i de U^{-1} = -(1/u_ii) * sum_{k>i} u_ik * (linha k de U^{-1}):
+ * cada linha k já invertida é lida uma vez por bloco (e não uma vez por
+ * linha i), acumulando as linhas do bloco em trabalho (bloco x n).
+ */
+static void inverterUNoLugar(double** matriz, int ordemMatriz, double tolerancia,
+                             double* trabalho) {
+    for (int fimBloco = ordemMatriz; fimBloco > 0; fimBloco -= LU_INVERSA_BLOCO) {
+        int inicioBloco = fimBloco - LU_INVERSA_BLOCO;
+        if (inicioBloco < 0) inicioBloco = 0;
+
+        for (int b = 0; b < fimBloco - inicioBloco; b++) {
+            double* acumulado = trabalho + (size_t)b * ordemMatriz;
+            for (int j = inicioBloco; j < ordemMatriz; j++) acumulado[j] = 0.0;
+        }
+
+        // (a) contribuição das linhas abaixo do bloco (já invertidas)
+        for (int k = fimBloco; k < ordemMatriz; k++) {
+            for (int i = inicioBloco; i < fimBloco; i++) {
+                double coeficiente = matriz[i][k];
+                if (coeficiente == 0.0) continue;
+                kernelAtualizarLinha(trabalho + (size_t)(i - inicioBloco) * ordemMatriz + k,
+                                     matriz[k] + k, coeficiente, ordemMatriz - k);
+            }
+        }
+
+        // (b) dentro do bloco, de baixo para cima
+        for (int i = fimBloco - 1; i >= inicioBloco; i--) {
+            double* linha = matriz[i];
+            double* acumulado = trabalho + (size_t)(i - inicioBloco) * ordemMatriz;
+            for (int k = i + 1; k < fimBloco; k++) {
+                double coeficiente = linha[k];
+                if (coeficiente == 0.0) continue;
+                kernelAtualizarLinha(acumulado + k, matriz[k] + k, coeficiente, ordemMatriz - k);
+            }
+
+            if (fabs(linha[i]) < tolerancia) {
+                g_flagPivoQuaseZero = 1; // avisa e segue
+            }
+            double inversoDiagonal = 1.0 / linha[i];
+            linha[i] = inversoDiagonal;
+            for (int j = i + 1; j < ordemMatriz; j++) linha[j] = acumulado[j] * inversoDiagonal;
+        }
+    }
+}
+
+/*
+ * A^{-1} = U^{-1} L^{-1}: resolve X L = U^{-1} por blocos de colunas, da
+ * direita para a esquerda (como o getri). As colunas de L do bloco vão para
+ * trabalho (n x bloco) e são zeradas na matriz; cada linha de X é lida uma
+ * vez por bloco, e não uma vez por coluna.
+ */
+static void multiplicarPorInversaL(double** matriz, int ordemMatriz, double* trabalho) {
+    int ultimoBloco = ((ordemMatriz - 1) / LU_INVERSA_BLOCO) * LU_INVERSA_BLOCO;
+    for (int inicioBloco = ultimoBloco; inicioBloco >= 0; inicioBloco -= LU_INVERSA_BLOCO) {
+        int largura = ordemMatriz - inicioBloco;
+        if (largura > LU_INVERSA_BLOCO) largura = LU_INVERSA_BLOCO;
+        int fimBloco = inicioBloco + largura;
+
+        // (a) trabalho[i][c] = L[i][inicioBloco + c] (só abaixo da diagonal; o resto, 0)
+        for (int i = inicioBloco; i < ordemMatriz; i++) {
+            double* colunasL = trabalho + (size_t)i * LU_INVERSA_BLOCO;
+            for (int c = 0; c < LU_INVERSA_BLOCO; c++) {
+                if (c < largura && i > inicioBloco + c) {
+                    colunasL[c] = matriz[i][inicioBloco + c];
+                    matriz[i][inicioBloco + c] = 0.0;
+                } else {
+                    colunasL[c] = 0.0;
+                }
+            }
+        }
+
+        for (int linha = 0; linha < ordemMatriz; linha++) {
+            double* x = matriz[linha];
+
+            // (b) X[:, bloco] -= X[:, fimBloco:] * L[fimBloco:, bloco]
+            double soma[LU_INVERSA_BLOCO] = { 0.0 };
+            for (int i = fimBloco; i < ordemMatriz; i++) {
+                double valor = x[i];
+                const double* colunasL = trabalho + (size_t)i * LU_INVERSA_BLOCO;
+                for (int c = 0; c < LU_INVERSA_BLOCO; c++) soma[c] += valor * colunasL[c];
+            }
+            for (int c = 0; c < largura; c++) x[inicioBloco + c] -= soma[c];
+
+            // (c) triângulo unitário do próprio bloco, da direita para a esquerda
+            for (int c = largura - 2; c >= 0; c--) {
+                double resto = 0.0;
+                for (int d = c + 1; d < largura; d++)
+                    resto += x[inicioBloco + d] * trabalho[(size_t)(inicioBloco + d) * LU_INVERSA_BLOCO + c];
+                x[inicioBloco + c] -= resto;
+            }
+        }
+    }
+}
+
+int inversaNoLugar(double** matrizA, int ordemMatriz, double tolerancia)
+{
+    double* trabalho = (double*) malloc((size_t)LU_INVERSA_BLOCO * ordemMatriz * sizeof(double));
+    if (!trabalho) return 1;
+
+    luRedefinirAvisos();
+    luDecomposicaoCompacta(matrizA, ordemMatriz, tolerancia); // não aborta
+    inverterUNoLugar(matrizA, ordemMatriz, tolerancia, trabalho);
+    multiplicarPorInversaL(matrizA, ordemMatriz, trabalho);
+
+    free(trabalho);
+    return 0;
+}
+
+/* ============================================================
+   REFINAMENTO ITERATIVO com resíduo em double-double
+   ============================================================ */
+
+/* Cada correção precisa ser menor que esta fração da anterior */
+#define LU_REFINO_REDUCAO_MINIMA 0.5
+
+/* max_i |d_i| / |x_i| (componentes nulas de x usam ||x||∞) */
+static double correcaoRelativa(const double* correcao, const double* vetorX, int ordemMatriz)
+{
+    double normaX = 0.0, maior = 0.0;
+    for (int i = 0; i < ordemMatriz; i++)
+        if (fabs(vetorX[i]) > normaX) normaX = fabs(vetorX[i]);
+
+    for (int i = 0; i < ordemMatriz; i++) {
+        if (correcao[i] == 0.0) continue;
+        double escala = (vetorX[i] != 0.0) ? fabs(vetorX[i]) : normaX;
+        double razao = (escala > 0.0) ? fabs(correcao[i]) / escala : INFINITY;
+        if (razao > maior) maior = razao;
+    }
+    return maior;
+}
+
+int resolverPorLURefinado(double** matrizA, double** matrizL, double** matrizU,
+                          const double* vetorB, double* vetorX, int ordemMatriz,
+                          double tolerancia, LURefinamentoInfo* info)
+{
+    LURefinamentoInfo local;
+    if (!info) info = &local;
+    info->iteracoes = 0;
+    info->limiteErro = INFINITY;
+    info->convergiu = 0;
+
+    double* trabalho = (double*) calloc(4 * (size_t)ordemMatriz, sizeof(double));
+    if (!trabalho) return 1;
+    double* vetorY   = trabalho;
+    double* residuo  = trabalho + ordemMatriz;
+    double* correcao = trabalho + 2 * (size_t)ordemMatriz;
+    double* cauda    = trabalho + 3 * (size_t)ordemMatriz;
+
+    // (0) solução inicial com os fatores em double
+    substituicaoProgressiva(matrizL, vetorB, vetorY, ordemMatriz, tolerancia);
+    substituicaoRegressiva_U(matrizU, vetorY, vetorX, ordemMatriz, tolerancia);
+
+    double correcaoAnterior = INFINITY;
+    while (info->iteracoes < LU_REFINO_MAX_ITERACOES) {
+        // (1) r = b - A (x + cauda), acumulado em double-double
+        for (int i = 0; i < ordemMatriz; i++)
+            residuo[i] = residuoEstendido(matrizA[i], vetorX, cauda, vetorB[i], ordemMatriz);
+
+        // (2) L U d = r
+        substituicaoProgressiva(matrizL, residuo, vetorY, ordemMatriz, tolerancia);
+        substituicaoRegressiva_U(matrizU, vetorY, correcao, ordemMatriz, tolerancia);
+
+        // (3) para se a correção não caiu o bastante (fica com o x anterior)
+        double relativa = correcaoRelativa(correcao, vetorX, ordemMatriz);
+        if (!(relativa < LU_REFINO_REDUCAO_MINIMA * correcaoAnterior)) break;
+
+        somarCorrecaoEstendida(vetorX, cauda, correcao, ordemMatriz);
+        info->iteracoes++;
+        info->limiteErro = relativa;
+        correcaoAnterior = relativa;
+        if (relativa <= DBL_EPSILON) {
+            info->convergiu = 1;
+            break;
+        }
+    }
+
+    free(trabalho);
+    return 0;
+}
+
+int inversaPorLURefinada(double** matrizA, int ordemMatriz, double tolerancia,
+                         double** matrizInversa, LURefinamentoInfo* info)
+{
+    LURefinamentoInfo local;
+    if (!info) info = &local;
+    info->iteracoes = 0;
+    info->limiteErro = 0.0;
+    info->convergiu = 1;
+
+    double** matrizL = alocarMatriz(ordemMatriz);
+    double** matrizU = alocarMatriz(ordemMatriz);
+    double* vetorB = (double*) malloc(ordemMatriz * sizeof(double));
+    double* vetorX = (double*) malloc(ordemMatriz * sizeof(double));
+    if (!vetorB || !vetorX) {
+        free(vetorB); free(vetorX);
+        liberarMatriz(matrizL, ordemMatriz);
+        liberarMatriz(matrizU, ordemMatriz);
+        return 1;
+    }
+
+    luRedefinirAvisos();
+    luDecomposicao(matrizA, ordemMatriz, matrizL, matrizU, tolerancia); // não aborta
+
+    int falhou = 0;
+    for (int j = 0; j < ordemMatriz && !falhou; j++) {
+        for (int i = 0; i < ordemMatriz; i++) vetorB[i] = (i == j) ? 1.0 : 0.0;
+
+        LURefinamentoInfo coluna;
+        falhou = resolverPorLURefinado(matrizA, matrizL, matrizU, vetorB, vetorX,
+                                       ordemMatriz, tolerancia, &coluna);
+        for (int i = 0; i < ordemMatriz; i++) matrizInversa[i][j] = vetorX[i];
+
+        if (coluna.iteracoes > info->iteracoes) info->iteracoes = coluna.iteracoes;
+        if (!(coluna.limiteErro <= info->limiteErro)) info->limiteErro = coluna.limiteErro;
+        info->convergiu &= coluna.convergiu;
+    }
+
+    free(vetorB); free(vetorX);
+    liberarMatriz(matrizL, ordemMatriz);
+    liberarMatriz(matrizU, ordemMatriz);
+    return falhou;
+}
+
+
 void luRedefinirAvisos(){
      g_flagPivoQuaseZero = 0;
 }
@@ -40,6 +40,82 @@ LUStatus luDecomposicao(double** matrizA,
                         double** matrizU,
                         double tolerancia);
 
+/**
+ * @brief Fatoração LU recursiva (cache-oblivious), sem pivotamento: A = L * U.
+ *
+ * Mesma interface e mesmo resultado de luDecomposicao() (a menos de
+ * arredondamento), mas divide as colunas ao meio recursivamente e transforma
+ * a maior parte do trabalho em multiplicações de matrizes em blocos. Como os
+ * blocos vão diminuindo até caber em cada nível de cache, não há tamanho de
+ * bloco a ajustar por máquina; indicada a partir de algumas centenas de linhas.
+ *
+ * Pivôs com |pivô| < tolerancia acionam o mesmo aviso de luFlagPivoQuaseZero().
+ *
+ * @param matrizA        Matriz de entrada (n x n) — NÃO é modificada.
+ * @param ordemMatriz    Ordem n da matriz.
+ * @param matrizL        Saída: matriz L (n x n), triangular inferior (diag = 1.0).
+ * @param matrizU        Saída: matriz U (n x n), triangular superior.
+ * @param tolerancia     Valor mínimo aceito para o pivô (|pivô| < tolerancia => aviso).
+ * @return LU_OK. Em falha de alocação dos painéis, elimina as colunas
+ *         diretamente no laço right-looking (não passa por luDecomposicao(),
+ *         cuja escolha de variante poderia voltar a esta função); o resultado
+ *         e o aviso de pivô são os mesmos.
+ */
+LUStatus luRecursiva(double** matrizA,
+                     int ordemMatriz,
+                     double** matrizL,
+                     double** matrizU,
+                     double tolerancia);
+
+/**
+ * @enum LUVariante
+ * @brief Ordem dos laços da fatoração. Todas têm o contrato de luDecomposicao():
+ *        mesmas entradas e saídas, mesma regra de aviso de pivô e os mesmos L e U
+ *        a menos de arredondamento.
+ */
+typedef enum {
+    LU_VARIANTE_DIREITA = 0, /**< right-looking (kij): a cada pivô, lê e escreve toda a submatriz restante. */
+    LU_VARIANTE_ESQUERDA,    /**< left-looking por linhas (ikj): cada linha é escrita uma vez, quando é a vez
+                                  dela; idêntica bit a bit à direita. */
+    LU_VARIANTE_CROUT,       /**< Crout: linha k de U e coluna k de L por produtos internos; escreve cada
+                                  elemento uma vez. */
+    LU_VARIANTE_RECURSIVA    /**< luRecursiva() (blocos cache-oblivious). */
+} LUVariante;
+
+/**
+ * @brief luDecomposicao() com a ordem dos laços escolhida explicitamente.
+ *
+ * @param variante Uma de @ref LUVariante.
+ * @return LU_OK (pivôs quase nulos são informados por luFlagPivoQuaseZero()).
+ */
+LUStatus luDecomposicaoVariante(double** matrizA, int ordemMatriz, double** matrizL,
+                                double** matrizU, double tolerancia, LUVariante variante);
+
+/**
+ * @brief luDecomposicaoCompacta() (A vira L\U, no lugar) com a ordem dos laços escolhida.
+ */
+LUStatus luDecomposicaoCompactaVariante(double** matrizA, int ordemMatriz, double tolerancia,
+                                        LUVariante variante);
+
+/**
+ * @brief Define a variante usada por luDecomposicao() (e por quem a chama, como inversaPorLU()).
+ *
+ * Sem chamar esta função, vale a variável de ambiente `LU_VARIANTE`
+ * (direita|esquerda|crout|recursiva), ou direita se ela não existir. Assim cada
+ * instalação pode ficar com a mais rápida no `bench_variantes` sem recompilar.
+ */
+void luDefinirVariante(LUVariante variante);
+
+/**
+ * @brief Variante em uso por luDecomposicao().
+ */
+LUVariante luVariante(void);
+
+/**
+ * @brief Nome curto da variante ("direita", "esquerda", "crout", "recursiva").
+ */
+const char* luNomeVariante(LUVariante variante);
+
 /**
  * @brief Resolve o sistema L * y = b (substituição progressiva).
  *
@@ -114,6 +190,125 @@ int inversaPorLU(double** matrizA,
                  double tolerancia,
                  double** matrizInversa);
 
+/**
+ * @brief Fatoração LU no lugar, em formato compacto (o layout do getrf do LAPACK).
+ *
+ * A é sobrescrita por L\U: os multiplicadores de L ficam abaixo da diagonal
+ * (diag(L) = 1.0 fica implícita) e U no triângulo superior. Não aloca L nem U:
+ * o pico de memória cai de 3n² (A, L, U) para n², o que permite ordens ~1,7×
+ * maiores na mesma memória. Nas ordens 2..16 usa as versões desenroladas de
+ * lu_fixo.h (mesmo resultado de luDecomposicao()); acima, a recursão de
+ * luRecursiva() (mesmo resultado dela).
+ *
+ * @param matrizA     Entrada A (n x n); saída L\U.
+ * @param ordemMatriz Ordem n da matriz.
+ * @param tolerancia  Valor mínimo aceito para o pivô (|pivô| < tolerancia => aviso).
+ * @return LU_OK (pivôs quase nulos são informados por luFlagPivoQuaseZero()).
+ */
+LUStatus luDecomposicaoCompacta(double** matrizA, int ordemMatriz, double tolerancia);
+
+/**
+ * @brief Resolve A x = b com os fatores compactos de luDecomposicaoCompacta().
+ *
+ * Substituição progressiva com diagonal unitária implícita seguida da
+ * regressiva em U, lendo a mesma matriz.
+ *
+ * @param matrizLU    Fatores L\U (n x n).
+ * @param vetorB      Lado direito b (n).
+ * @param vetorX      Saída x (n); pode ser o próprio @p vetorB.
+ * @param ordemMatriz Ordem n.
+ * @param tolerancia  Valor mínimo para a diagonal de U.
+ * @return Sempre 0 (mantém compatibilidade com outras versões).
+ */
+int luResolverCompacta(double** matrizLU, const double* vetorB, double* vetorX,
+                       int ordemMatriz, double tolerancia);
+
+/**
+ * @brief Monta A⁻¹ numa matriz separada a partir dos fatores compactos.
+ *
+ * @param matrizLU       Fatores L\U (n x n); não são modificados.
+ * @param matrizInversa  Saída: matriz inversa (n x n).
+ * @param ordemMatriz    Ordem n.
+ * @param tolerancia     Valor mínimo para pivôs.
+ * @return 0 se sucesso; 1 em falha de alocação.
+ */
+int inversaAPartirDeLUCompacta(double** matrizLU, double** matrizInversa,
+                               int ordemMatriz, double tolerancia);
+
+/**
+ * @brief Substitui A por A⁻¹ usando só a própria matriz (mais 32n doubles de trabalho).
+ *
+ * Fatora com luDecomposicaoCompacta(), inverte U no lugar e resolve
+ * X L = U⁻¹ em blocos de colunas, como o par getrf/getri do LAPACK (~2n³ flops).
+ * Com inversaPorLU() a inversão ocupa 4n² (A, L, U e a inversa); aqui, n².
+ *
+ * @param matrizA     Entrada A (n x n); saída A⁻¹.
+ * @param ordemMatriz Ordem n.
+ * @param tolerancia  Valor mínimo aceito para pivôs (aviso em luFlagPivoQuaseZero()).
+ * @return 0 se executou; 1 em falha de alocação (A fica intacta).
+ */
+int inversaNoLugar(double** matrizA, int ordemMatriz, double tolerancia);
+
+/** Máximo de passos de refinamento por sistema. */
+#ifndef LU_REFINO_MAX_ITERACOES
+#define LU_REFINO_MAX_ITERACOES 10
+#endif
+
+/**
+ * @brief Diagnóstico do refinamento iterativo (resolverPorLURefinado / inversaPorLURefinada).
+ */
+typedef struct {
+    int    iteracoes;  /**< Correções aplicadas (na inversa: o maior número entre as colunas). */
+    double limiteErro; /**< max_i |d_i|/|x_i| da última correção: estimativa do erro relativo
+                            componente a componente (na inversa: o pior entre as colunas). */
+    int    convergiu;  /**< 1 se a última correção ficou abaixo de ε_double (na inversa: em todas). */
+} LURefinamentoInfo;
+
+/**
+ * @brief Resolve A x = b com L e U já calculados e refina x com resíduo em double-double.
+ *
+ * Cada passo custa O(n²): r = b − A·x avaliado com ~106 bits (residuo_estendido.h),
+ * L y = r, U d = y e x += d (x guardado como double-double). Continua enquanto
+ * a correção relativa cair pelo menos pela metade; para sozinho quando a
+ * correção fica abaixo de ε ou estaciona (cond(A) acima de ~1/ε).
+ *
+ * @param matrizA     A original (n x n) — só é lida.
+ * @param matrizL     L de luDecomposicao() (ou luRecursiva()).
+ * @param matrizU     U correspondente.
+ * @param vetorB      Lado direito b (n).
+ * @param vetorX      Saída x (n).
+ * @param ordemMatriz Ordem n.
+ * @param tolerancia  Valor mínimo para a diagonal nas substituições.
+ * @param info        (opcional) passos, limite de erro e convergência; NULL ignora.
+ * @return 0 se executou; 1 em falha de alocação.
+ */
+int resolverPorLURefinado(double** matrizA,
+                          double** matrizL,
+                          double** matrizU,
+                          const double* vetorB,
+                          double* vetorX,
+                          int ordemMatriz,
+                          double tolerancia,
+                          LURefinamentoInfo* info);
+
+/**
+ * @brief Como inversaPorLU(), mas cada coluna A⁻¹e_j é refinada com resolverPorLURefinado().
+ *
+ * A fatoração é feita uma vez; o refinamento acrescenta O(n²) por passo e por coluna.
+ *
+ * @param matrizA        Matriz de entrada (n x n) — NÃO é modificada.
+ * @param ordemMatriz    Ordem n da matriz.
+ * @param tolerancia     Valor mínimo aceito para pivôs.
+ * @param matrizInversa  Saída: matriz inversa (n x n).
+ * @param info           (opcional) resumo do refinamento (pior coluna); NULL ignora.
+ * @return 0 se sucesso; 1 em falha de alocação.
+ */
+int inversaPorLURefinada(double** matrizA,
+                         int ordemMatriz,
+                         double tolerancia,
+                         double** matrizInversa,
+                         LURefinamentoInfo* info);
+
 /**
  * @brief Redefine os avisos internos da LU (pivôs quase nulos).
  *
@@ -0,0 +1,165 @@
+#include <math.h>
+#include <stddef.h>
+#include "lu_fixo.h"
+
+/*
+ * Os corpos abaixo recebem a ordem como parâmetro, mas só são expandidos
+ * (always_inline) dentro das instâncias geradas por LU_FIXO_INSTANCIAR, com
+ * a ordem constante; o "GCC unroll" garante então o desenrolamento completo.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LU_FIXO_EXPANDIR   static inline __attribute__((always_inline))
+#define LU_FIXO_DESENROLAR _Pragma("GCC unroll 16")
+#else
+#define LU_FIXO_EXPANDIR   static inline
+#define LU_FIXO_DESENROLAR
+#endif
+
+/* ============================================================
+   Corpos genéricos (mesma sequência de operações de lu.c)
+   ============================================================ */
+
+LU_FIXO_EXPANDIR
+int decomposicaoFixa(double** matrizA, double** matrizL, double** matrizU,
+                     double tolerancia, const int ordem) {
+    double u[LU_ORDEM_FIXA_MAX][LU_ORDEM_FIXA_MAX];
+    double l[LU_ORDEM_FIXA_MAX][LU_ORDEM_FIXA_MAX];
+    const int compacta = (matrizL == matrizU); /* L\U numa só matriz (layout do getrf) */
+    int aviso = 0;
+
+    LU_FIXO_DESENROLAR
+    for (int i = 0; i < ordem; i++) {
+        LU_FIXO_DESENROLAR
+        for (int j = 0; j < ordem; j++) {
+            u[i][j] = matrizA[i][j];
+            l[i][j] = (i == j) ? 1.0 : 0.0;
+        }
+    }
+
+    LU_FIXO_DESENROLAR
+    for (int k = 0; k < ordem - 1; k++) {
+        double pivo = u[k][k];
+        aviso |= (fabs(pivo) < tolerancia);
+
+        LU_FIXO_DESENROLAR
+        for (int i = k + 1; i < ordem; i++) {
+            double multiplicador = u[i][k] / pivo;
+            l[i][k] = multiplicador;
+            LU_FIXO_DESENROLAR
+            for (int j = k; j < ordem; j++) {
+                u[i][j] -= multiplicador * u[k][j];
+            }
+        }
+    }
+
+    LU_FIXO_DESENROLAR
+    for (int i = 0; i < ordem; i++) {
+        double* linhaU = matrizU[i];
+        double* linhaL = matrizL[i];
+        LU_FIXO_DESENROLAR
+        for (int j = 0; j < ordem; j++) {
+            if (compacta) {
+                linhaU[j] = (j < i) ? l[i][j] : u[i][j];
+            } else {
+                linhaU[j] = u[i][j];
+                linhaL[j] = l[i][j];
+            }
+        }
+    }
+    return aviso;
+}
+
+LU_FIXO_EXPANDIR
+int progressivaFixa(double** matrizL, const double* vetorB, double* vetorY,
+                    double tolerancia, const int ordem) {
+    double y[LU_ORDEM_FIXA_MAX];
+    int aviso = 0;
+
+    LU_FIXO_DESENROLAR
+    for (int i = 0; i < ordem; i++) {
+        const double* linha = matrizL[i];
+        double soma = 0.0;
+        LU_FIXO_DESENROLAR
+        for (int j = 0; j < i; j++) soma += linha[j] * y[j];
+
+        aviso |= (fabs(linha[i]) < tolerancia);
+        y[i] = (vetorB[i] - soma) / linha[i];
+        vetorY[i] = y[i];
+    }
+    return aviso;
+}
+
+LU_FIXO_EXPANDIR
+int regressivaFixa(double** matrizU, const double* vetorY, double* vetorX,
+                   double tolerancia, const int ordem) {
+    double x[LU_ORDEM_FIXA_MAX];
+    int aviso = 0;
+
+    LU_FIXO_DESENROLAR
+    for (int i = ordem - 1; i >= 0; i--) {
+        const double* linha = matrizU[i];
+        double soma = 0.0;
+        LU_FIXO_DESENROLAR
+        for (int j = i + 1; j < ordem; j++) soma += linha[j] * x[j];
+
+        aviso |= (fabs(linha[i]) < tolerancia);
+        x[i] = (vetorY[i] - soma) / linha[i];
+        vetorX[i] = x[i];
+    }
+    return aviso;
+}
+
+/* ============================================================
+   Instâncias 2..16 e tabelas de despacho
+   ============================================================ */
+
+#define LU_FIXO_INSTANCIAR(N)                                                         \
+    static int decomposicao##N(double** matrizA, double** matrizL,                    \
+                               double** matrizU, double tolerancia) {                 \
+        return decomposicaoFixa(matrizA, matrizL, matrizU, tolerancia, N);            \
+    }                                                                                 \
+    static int progressiva##N(double** matrizL, const double* vetorB,                 \
+                              double* vetorY, double tolerancia) {                    \
+        return progressivaFixa(matrizL, vetorB, vetorY, tolerancia, N);               \
+    }                                                                                 \
+    static int regressiva##N(double** matrizU, const double* vetorY,                  \
+                             double* vetorX, double tolerancia) {                     \
+        return regressivaFixa(matrizU, vetorY, vetorX, tolerancia, N);                \
+    }
+
+LU_FIXO_INSTANCIAR(2)
+LU_FIXO_INSTANCIAR(3)
+LU_FIXO_INSTANCIAR(4)
+LU_FIXO_INSTANCIAR(5)
+LU_FIXO_INSTANCIAR(6)
+LU_FIXO_INSTANCIAR(7)
+LU_FIXO_INSTANCIAR(8)
+LU_FIXO_INSTANCIAR(9)
+LU_FIXO_INSTANCIAR(10)
+LU_FIXO_INSTANCIAR(11)
+LU_FIXO_INSTANCIAR(12)
+LU_FIXO_INSTANCIAR(13)
+LU_FIXO_INSTANCIAR(14)
+LU_FIXO_INSTANCIAR(15)
+LU_FIXO_INSTANCIAR(16)
+
+#define LU_FIXO_TABELA(prefixo) {                                                     \
+    NULL, NULL, prefixo##2, prefixo##3, prefixo##4, prefixo##5, prefixo##6,           \
+    prefixo##7, prefixo##8, prefixo##9, prefixo##10, prefixo##11, prefixo##12,        \
+    prefixo##13, prefixo##14, prefixo##15, prefixo##16 }
+
+static const LuFixoDecomposicao g_decomposicao[LU_ORDEM_FIXA_MAX + 1] = LU_FIXO_TABELA(decomposicao);
+static const LuFixoSubstituicao g_progressiva[LU_ORDEM_FIXA_MAX + 1]  = LU_FIXO_TABELA(progressiva);
+static const LuFixoSubstituicao g_regressiva[LU_ORDEM_FIXA_MAX + 1]   = LU_FIXO_TABELA(regressiva);
+
+LuFixoDecomposicao luFixoDecomposicao(int ordemMatriz) {
+    return (ordemMatriz >= 2 && ordemMatriz <= LU_ORDEM_FIXA_MAX) ? g_decomposicao[ordemMatriz] : NULL;
+}
+
+LuFixoSubstituicao luFixoProgressiva(int ordemMatriz) {
+    return (ordemMatriz >= 2 && ordemMatriz <= LU_ORDEM_FIXA_MAX) ? g_progressiva[ordemMatriz] : NULL;
+}
+
+LuFixoSubstituicao luFixoRegressiva(int ordemMatriz) {
+    return (ordemMatriz >= 2 && ordemMatriz <= LU_ORDEM_FIXA_MAX) ? g_regressiva[ordemMatriz] : NULL;
+}
@@ -0,0 +1,58 @@
+#ifndef LU_FIXO_H
+#define LU_FIXO_H
+
+/**
+ * @file lu_fixo.h
+ * @brief Versões da LU e das substituições especializadas para ordens fixas
+ *        2..LU_ORDEM_FIXA_MAX, totalmente desenroladas em tempo de compilação.
+ *
+ * Para matrizes pequenas (as 3×3 e 4×4 dos experimentos), os laços genéricos
+ * de lu.c gastam mais com controle de laço e indireção do que com contas.
+ * Aqui cada ordem tem sua própria função, gerada por macro a partir de um
+ * único corpo com a ordem constante: os laços viram código em linha reta e a
+ * matriz fica em variáveis locais (registradores, nas ordens menores).
+ *
+ * As rotinas públicas de lu.h consultam estes seletores e usam a versão fixa
+ * automaticamente quando `ordemMatriz` está na faixa; não é preciso chamá-las
+ * diretamente. Os resultados são os mesmos dos laços genéricos (mesma ordem
+ * das operações); só as versões SIMD com FMA de kernels.h podem diferir na
+ * última casa.
+ */
+
+/** Maior ordem com versão especializada. */
+#define LU_ORDEM_FIXA_MAX 16
+
+/**
+ * @brief LU (Doolittle, sem pivotamento) de ordem fixa: U <- A eliminada, L <- multiplicadores.
+ *
+ * Com matrizL == matrizU (podendo ser a própria matrizA), grava L\U compactados:
+ * multiplicadores abaixo da diagonal e U no triângulo superior.
+ *
+ * @return 1 se algum pivô (exceto o último, como em luDecomposicao) tiver |pivô| < tolerancia.
+ */
+typedef int (*LuFixoDecomposicao)(double** matrizA, double** matrizL,
+                                  double** matrizU, double tolerancia);
+
+/**
+ * @brief Substituição (progressiva em L ou regressiva em U) de ordem fixa.
+ * @return 1 se algum elemento da diagonal tiver módulo < tolerancia.
+ */
+typedef int (*LuFixoSubstituicao)(double** matriz, const double* vetorEntrada,
+                                  double* vetorSaida, double tolerancia);
+
+/**
+ * @brief Versão especializada da decomposição para @p ordemMatriz, ou NULL se não houver.
+ */
+LuFixoDecomposicao luFixoDecomposicao(int ordemMatriz);
+
+/**
+ * @brief Versão especializada da substituição progressiva (Ly = b), ou NULL.
+ */
+LuFixoSubstituicao luFixoProgressiva(int ordemMatriz);
+
+/**
+ * @brief Versão especializada da substituição regressiva (Ux = y), ou NULL.
+ */
+LuFixoSubstituicao luFixoRegressiva(int ordemMatriz);
+
+#endif /* LU_FIXO_H */
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 #include <time.h>
 #ifdef _WIN32
@@ -8,28 +9,75 @@
 #endif
 #include "utils.h"
 #include "lu.h"
+#include "matriz_bin.h"
+#include "condicao.h"
+#include "ldlt.h"
 
 // ============================================
 // FUNÇÕES AUXILIARES
 // ============================================
 
 static void mostrarFatoracaoLU(double** matrizA, int ordemMatriz, double tolerancia) {
-    double** matrizL = alocarMatriz(ordemMatriz);
-    double** matrizU = alocarMatriz(ordemMatriz);
+    // L e U compactados numa só matriz (layout do getrf)
+    double** matrizLU = clonarMatriz(matrizA, ordemMatriz);
+    luDecomposicaoCompacta(matrizLU, ordemMatriz, tolerancia);
 
-    luDecomposicao(matrizA, ordemMatriz, matrizL, matrizU, tolerancia);
-
-    imprimirMatriz("L:", matrizL, ordemMatriz);
-    imprimirMatriz("U:", matrizU, ordemMatriz);
+    imprimirMatriz("L\\U (L abaixo da diagonal, diag(L) = 1 implicita; U no triangulo superior):",
+                   matrizLU, ordemMatriz);
 
     double determinante = 1.0;
     for (int i = 0; i < ordemMatriz; i++)
-        determinante *= matrizU[i][i];
+        determinante *= matrizLU[i][i];
+
+    printf("det(A) (produto dos pivos de U) = %.6e\n", determinante);
+
+    // condicionamento e limites de erro com os próprios fatores (O(n²), sem A^{-1})
+    double condicao = condicaoEstimar1(matrizLU, matrizLU, ordemMatriz, condicaoNorma1(matrizA, ordemMatriz));
+    printf("cond_1(A) estimado (Hager/Higham) = %.6e\n", condicao);
+
+    double* vetorB = (double*) malloc(ordemMatriz * sizeof(double));
+    double* vetorX = (double*) malloc(ordemMatriz * sizeof(double));
+    CondicaoLimites limites;
+    if (vetorB && vetorX) {
+        for (int i = 0; i < ordemMatriz; i++) {  // b = A (1,...,1)
+            vetorB[i] = 0.0;
+            for (int j = 0; j < ordemMatriz; j++) vetorB[i] += matrizA[i][j];
+        }
+        luResolverCompacta(matrizLU, vetorB, vetorX, ordemMatriz, tolerancia);
+        if (condicaoLimitesErro(matrizA, matrizLU, matrizLU, NULL, vetorB, vetorX,
+                                ordemMatriz, &limites) == 0) {
+            printf("Ax = A(1,...,1): erro retroativo = %.3e, limite do erro relativo de x = %.3e\n",
+                   limites.erroRetroativo, limites.limiteProgressivo);
+        }
+    }
+    free(vetorB); free(vetorX);
+    printf("\n");
 
-    printf("det(A) (produto dos pivos de U) = %.6e\n\n", determinante);
+    liberarMatriz(matrizLU, ordemMatriz);
+}
 
-    liberarMatriz(matrizL, ordemMatriz);
-    liberarMatriz(matrizU, ordemMatriz);
+static void mostrarFatoracaoLDLT(double** matrizA, int ordemMatriz, double tolerancia) {
+    // A simétrica: P A P^T = L D L^T (Bunch-Kaufman), só o triângulo inferior
+    double** matrizLDL = clonarMatriz(matrizA, ordemMatriz);
+    int* permutacao = (int*) malloc(ordemMatriz * sizeof(int));
+    int* blocos = (int*) malloc(ordemMatriz * sizeof(int));
+    if (permutacao && blocos &&
+        ldltDecomposicao(matrizLDL, ordemMatriz, permutacao, blocos, tolerancia) != LDLT_MEMORIA) {
+        for (int i = 0; i < ordemMatriz; i++)  // o triângulo superior não faz parte dos fatores
+            for (int j = i + 1; j < ordemMatriz; j++) matrizLDL[i][j] = 0.0;
+        imprimirMatriz("L\\D (Bunch-Kaufman: L abaixo da diagonal, blocos de D na diagonal):",
+                       matrizLDL, ordemMatriz);
+
+        printf("Blocos de D:");
+        for (int k = 0; k < ordemMatriz; k++)
+            if (blocos[k] != 0) printf(" %dx%d@%d", blocos[k], blocos[k], k);
+        printf("\nPermutacao:");
+        for (int i = 0; i < ordemMatriz; i++) printf(" %d", permutacao[i]);
+        printf("\n\n");
+    }
+    free(permutacao);
+    free(blocos);
+    liberarMatriz(matrizLDL, ordemMatriz);
 }
 
 static void verificarInversa(double** matrizA, double** matrizInversa,
@@ -50,14 +98,34 @@ static void verificarInversa(double** matrizA, double** matrizInversa,
 // FUNÇÃO PRINCIPAL
 // ============================================
 
-int main(void) {
+int main(int argc, char** argv) {
     int ordemMatriz = 3;
-    double** matrizA = criarMatrizA1();  // altere aqui para testar outra matriz
+    double** matrizA = NULL;
+    MatrizMapeada mapa = { 0 };
+
+    // com um argumento, A vem de um arquivo de matriz_bin.h (mapeado, cópia na escrita)
+    if (argc > 1) {
+        MatrizBinStatus statusArquivo = matrizBinAbrir(&mapa, argv[1], MATRIZ_BIN_COPIA_PRIVADA, 1);
+        if (statusArquivo != MATRIZ_BIN_OK) {
+            fprintf(stderr, "%s: %s\n", argv[1], matrizBinMensagem(statusArquivo));
+            return 1;
+        }
+        if (mapa.matriz->nLinhas != mapa.matriz->nColunas) {
+            fprintf(stderr, "%s: a matriz precisa ser quadrada\n", argv[1]);
+            matrizBinFechar(&mapa);
+            return 1;
+        }
+        ordemMatriz = mapa.matriz->nLinhas;
+        matrizA = mapa.matriz->linhas;
+    } else {
+        matrizA = criarMatrizA1();  // altere aqui para testar outra matriz
+    }
     double** matrizInversa  = alocarMatriz(ordemMatriz);
     double** matrizErros    = alocarMatriz(ordemMatriz);
     double tolerancia = 1e-12;  // limite para detectar pivôs quase nulos (baseado na precisão do double)
 
-    double** matrizCopia = clonarMatriz(matrizA, ordemMatriz);
+    // a inversa é calculada no lugar, sobre uma cópia de A (A fica para a verificação)
+    copiarMatriz(matrizInversa, matrizA, ordemMatriz);
 
     // ============================================
     // MEDIR TEMPO DE EXECUÇÃO
@@ -72,7 +140,16 @@ int main(void) {
     gettimeofday(&inicio, NULL);
 #endif
 
-    (void) inversaPorLU(matrizA, ordemMatriz, tolerancia, matrizInversa);
+    // A simétrica: LDL^T com Bunch-Kaufman (metade do tráfego, estável);
+    // caso contrário, LU no lugar
+    int simetrica = matrizSimetrica(matrizA, ordemMatriz);
+    int pivoQuaseNulo = 0;
+    if (simetrica) {
+        pivoQuaseNulo = (inversaSimetricaNoLugar(matrizInversa, ordemMatriz, tolerancia) == LDLT_PIVO_NULO);
+    } else {
+        (void) inversaNoLugar(matrizInversa, ordemMatriz, tolerancia);
+        pivoQuaseNulo = luFlagPivoQuaseZero();
+    }
 
 #ifdef _WIN32
     QueryPerformanceCounter(&fim);
@@ -86,19 +163,20 @@ int main(void) {
     // ============================================
     // RESULTADOS E ANÁLISE
     // ============================================
-    if (luFlagPivoQuaseZero()) {
+    if (pivoQuaseNulo) {
         puts("[AVISO] Pivo aproximado de zero detectado: matriz singular ou quase singular. "
              "Os resultados a seguir sao numericamente instaveis e potencialmente invalidos.");
     }
 
-    mostrarFatoracaoLU(matrizCopia, ordemMatriz, tolerancia);
+    mostrarFatoracaoLU(matrizA, ordemMatriz, tolerancia);
+    if (simetrica) mostrarFatoracaoLDLT(matrizA, ordemMatriz, tolerancia);
     imprimirMatriz("A^{-1} (calculada):", matrizInversa, ordemMatriz);
-    verificarInversa(matrizCopia, matrizInversa, ordemMatriz, matrizErros);
+    verificarInversa(matrizA, matrizInversa, ordemMatriz, matrizErros);
 
-    liberarMatriz(matrizA, ordemMatriz);
+    if (mapa.matriz) matrizBinFechar(&mapa);
+    else liberarMatriz(matrizA, ordemMatriz);
     liberarMatriz(matrizInversa, ordemMatriz);
     liberarMatriz(matrizErros, ordemMatriz);
-    liberarMatriz(matrizCopia, ordemMatriz);
 
 
     printf("\nTempo de execucao total: %.6e segundos\n\n", tempo_execucao);
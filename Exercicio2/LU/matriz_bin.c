@@ -0,0 +1,272 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L  /* mmap, fstat */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "matriz_bin.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+static const char MAGICA[8] = { 'M', 'A', 'T', 'R', 'I', 'Z', 'B', '\0' };
+
+/* O cabeçalho ocupa exatamente uma linha de cache */
+typedef char verificaCabecalho[(sizeof(MatrizBinCabecalho) == MATRIZ_ALINHAMENTO) ? 1 : -1];
+
+static uint64_t deslocamentoDados(void) {
+    return (sizeof(MatrizBinCabecalho) + MATRIZ_ALINHAMENTO - 1) / MATRIZ_ALINHAMENTO * MATRIZ_ALINHAMENTO;
+}
+
+uint64_t matrizBinSoma(uint64_t soma, const double* dados, size_t quantidade) {
+    for (size_t i = 0; i < quantidade; i++) {
+        uint64_t palavra;
+        memcpy(&palavra, &dados[i], sizeof(palavra));
+        soma = (soma ^ palavra) * 0x100000001b3ull;
+    }
+    return soma;
+}
+
+const char* matrizBinMensagem(MatrizBinStatus status) {
+    switch (status) {
+        case MATRIZ_BIN_OK:          return "ok";
+        case MATRIZ_BIN_ERRO_ES:     return "erro de E/S";
+        case MATRIZ_BIN_FORMATO:     return "arquivo nao e uma matriz valida";
+        case MATRIZ_BIN_VERSAO_NOVA: return "versao, tipo ou layout nao suportados";
+        case MATRIZ_BIN_SOMA:        return "soma de verificacao nao confere";
+        case MATRIZ_BIN_MEMORIA:     return "memoria insuficiente";
+    }
+    return "desconhecido";
+}
+
+// ============================================================
+// Leitura: validação do cabeçalho e mapeamento
+// ============================================================
+static MatrizBinStatus validarCabecalho(const MatrizBinCabecalho* cabecalho, size_t tamanhoArquivo) {
+    if (memcmp(cabecalho->magica, MAGICA, sizeof(MAGICA)) != 0) return MATRIZ_BIN_FORMATO;
+    if (cabecalho->marcaBytes != MATRIZ_BIN_MARCA_BYTES) return MATRIZ_BIN_FORMATO;
+    if (cabecalho->versao > MATRIZ_BIN_VERSAO ||
+        cabecalho->tipo != MATRIZ_BIN_FLOAT64 ||
+        cabecalho->layout != MATRIZ_BIN_POR_LINHAS) {
+        return MATRIZ_BIN_VERSAO_NOVA;
+    }
+    if (cabecalho->nLinhas <= 0 || cabecalho->nLinhas > 0x7fffffff ||
+        cabecalho->nColunas <= 0 || cabecalho->nColunas > 0x7fffffff ||
+        cabecalho->passo < cabecalho->nColunas || cabecalho->passo > 0x7fffffff ||
+        cabecalho->deslocamento < sizeof(MatrizBinCabecalho) ||
+        cabecalho->deslocamento % MATRIZ_ALINHAMENTO != 0 ||
+        (cabecalho->passo * (int64_t) sizeof(double)) % MATRIZ_ALINHAMENTO != 0) {
+        return MATRIZ_BIN_FORMATO;
+    }
+    // nLinhas · passo · 8 pode passar de 2^64: compara por divisão, sem estouro
+    if (cabecalho->deslocamento > tamanhoArquivo) return MATRIZ_BIN_FORMATO;
+    uint64_t doublesDisponiveis = ((uint64_t) tamanhoArquivo - cabecalho->deslocamento) / sizeof(double);
+    if ((uint64_t) cabecalho->passo > doublesDisponiveis / (uint64_t) cabecalho->nLinhas)
+        return MATRIZ_BIN_FORMATO;
+    return MATRIZ_BIN_OK;
+}
+
+/* Mapeia o arquivo inteiro; em sucesso preenche base/tamanho (e as HANDLEs no Windows) */
+static MatrizBinStatus mapearArquivo(MatrizMapeada* mapa, const char* caminho, MatrizBinModo modo) {
+#ifdef _WIN32
+    HANDLE arquivo = CreateFileA(caminho, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL, NULL);
+    if (arquivo == INVALID_HANDLE_VALUE) return MATRIZ_BIN_ERRO_ES;
+    LARGE_INTEGER tamanho;
+    if (!GetFileSizeEx(arquivo, &tamanho)) {
+        CloseHandle(arquivo);
+        return MATRIZ_BIN_ERRO_ES;
+    }
+    if (tamanho.QuadPart < (LONGLONG) sizeof(MatrizBinCabecalho)) {
+        CloseHandle(arquivo);
+        return MATRIZ_BIN_FORMATO;
+    }
+    DWORD protecao = (modo == MATRIZ_BIN_COPIA_PRIVADA) ? PAGE_WRITECOPY : PAGE_READONLY;
+    HANDLE mapeamento = CreateFileMappingA(arquivo, NULL, protecao, 0, 0, NULL);
+    if (!mapeamento) {
+        CloseHandle(arquivo);
+        return MATRIZ_BIN_ERRO_ES;
+    }
+    DWORD acesso = (modo == MATRIZ_BIN_COPIA_PRIVADA) ? FILE_MAP_COPY : FILE_MAP_READ;
+    void* base = MapViewOfFile(mapeamento, acesso, 0, 0, 0);
+    if (!base) {
+        CloseHandle(mapeamento);
+        CloseHandle(arquivo);
+        return MATRIZ_BIN_ERRO_ES;
+    }
+    mapa->base = base;
+    mapa->tamanho = (size_t) tamanho.QuadPart;
+    mapa->arquivo = arquivo;
+    mapa->mapeamento = mapeamento;
+#else
+    int descritor = open(caminho, O_RDONLY);
+    if (descritor < 0) return MATRIZ_BIN_ERRO_ES;
+    struct stat info;
+    if (fstat(descritor, &info) != 0) {
+        close(descritor);
+        return MATRIZ_BIN_ERRO_ES;
+    }
+    if (info.st_size < (off_t) sizeof(MatrizBinCabecalho)) {
+        close(descritor);
+        return MATRIZ_BIN_FORMATO;
+    }
+    int protecao = PROT_READ;
+    int compartilhamento = MAP_SHARED;
+    if (modo == MATRIZ_BIN_COPIA_PRIVADA) {
+        protecao |= PROT_WRITE;
+        compartilhamento = MAP_PRIVATE;
+    }
+    void* base = mmap(NULL, (size_t) info.st_size, protecao, compartilhamento, descritor, 0);
+    close(descritor); /* o mapeamento continua válido */
+    if (base == MAP_FAILED) return MATRIZ_BIN_ERRO_ES;
+    mapa->base = base;
+    mapa->tamanho = (size_t) info.st_size;
+#endif
+    return MATRIZ_BIN_OK;
+}
+
+static void desmapearArquivo(MatrizMapeada* mapa) {
+    if (!mapa->base) return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapa->base);
+    CloseHandle((HANDLE) mapa->mapeamento);
+    CloseHandle((HANDLE) mapa->arquivo);
+#else
+    munmap(mapa->base, mapa->tamanho);
+#endif
+}
+
+MatrizBinStatus matrizBinAbrir(MatrizMapeada* mapa, const char* caminho,
+                               MatrizBinModo modo, int verificarSoma) {
+    memset(mapa, 0, sizeof(*mapa));
+    MatrizBinStatus status = mapearArquivo(mapa, caminho, modo);
+    if (status != MATRIZ_BIN_OK) {
+        memset(mapa, 0, sizeof(*mapa));
+        return status;
+    }
+
+    const MatrizBinCabecalho* cabecalho = (const MatrizBinCabecalho*) mapa->base;
+    status = validarCabecalho(cabecalho, mapa->tamanho);
+
+    double* dados = (double*)((char*) mapa->base + cabecalho->deslocamento);
+    if (status == MATRIZ_BIN_OK && verificarSoma) {
+        size_t quantidade = (size_t) cabecalho->nLinhas * (size_t) cabecalho->passo;
+        if (matrizBinSoma(MATRIZ_BIN_SOMA_INICIAL, dados, quantidade) != cabecalho->soma) {
+            status = MATRIZ_BIN_SOMA;
+        }
+    }
+    if (status == MATRIZ_BIN_OK) {
+        mapa->matriz = criarVisaoMatriz(dados, (int) cabecalho->nLinhas,
+                                        (int) cabecalho->nColunas, (int) cabecalho->passo);
+        if (!mapa->matriz) status = MATRIZ_BIN_MEMORIA;
+    }
+
+    if (status != MATRIZ_BIN_OK) {
+        desmapearArquivo(mapa);
+        memset(mapa, 0, sizeof(*mapa));
+    }
+    return status;
+}
+
+void matrizBinFechar(MatrizMapeada* mapa) {
+    if (!mapa) return;
+    destruirMatriz(mapa->matriz);
+    desmapearArquivo(mapa);
+    memset(mapa, 0, sizeof(*mapa));
+}
+
+// ============================================================
+// Escrita em fluxo
+// ============================================================
+static void preencherCabecalho(MatrizBinCabecalho* cabecalho, const MatrizBinEscritor* escritor) {
+    memset(cabecalho, 0, sizeof(*cabecalho));
+    memcpy(cabecalho->magica, MAGICA, sizeof(MAGICA));
+    cabecalho->versao       = MATRIZ_BIN_VERSAO;
+    cabecalho->marcaBytes   = MATRIZ_BIN_MARCA_BYTES;
+    cabecalho->tipo         = MATRIZ_BIN_FLOAT64;
+    cabecalho->layout       = MATRIZ_BIN_POR_LINHAS;
+    cabecalho->nLinhas      = escritor->nLinhas;
+    cabecalho->nColunas     = escritor->nColunas;
+    cabecalho->passo        = escritor->passo;
+    cabecalho->soma         = escritor->soma;
+    cabecalho->deslocamento = deslocamentoDados();
+}
+
+MatrizBinStatus matrizBinIniciarEscrita(MatrizBinEscritor* escritor, const char* caminho,
+                                        int nLinhas, int nColunas) {
+    memset(escritor, 0, sizeof(*escritor));
+    if (nLinhas <= 0 || nColunas <= 0) return MATRIZ_BIN_FORMATO;
+
+    escritor->nLinhas  = nLinhas;
+    escritor->nColunas = nColunas;
+    escritor->passo    = passoAlinhado(nColunas);
+    escritor->soma     = MATRIZ_BIN_SOMA_INICIAL;
+    escritor->arquivo  = fopen(caminho, "wb");
+    if (!escritor->arquivo) return MATRIZ_BIN_ERRO_ES;
+
+    // cabeçalho provisório (soma ainda desconhecida) + preenchimento até os dados
+    MatrizBinCabecalho cabecalho;
+    preencherCabecalho(&cabecalho, escritor);
+    char zeros[MATRIZ_ALINHAMENTO] = { 0 };
+    size_t preenchimento = (size_t)(deslocamentoDados() - sizeof(cabecalho));
+    if (fwrite(&cabecalho, sizeof(cabecalho), 1, escritor->arquivo) != 1 ||
+        fwrite(zeros, 1, preenchimento, escritor->arquivo) != preenchimento) {
+        fclose(escritor->arquivo);
+        escritor->arquivo = NULL;
+        return MATRIZ_BIN_ERRO_ES;
+    }
+    return MATRIZ_BIN_OK;
+}
+
+MatrizBinStatus matrizBinEscreverLinha(MatrizBinEscritor* escritor, const double* linha) {
+    if (!escritor->arquivo || escritor->linhasGravadas >= escritor->nLinhas) return MATRIZ_BIN_FORMATO;
+
+    static const double zeros[MATRIZ_ALINHAMENTO / sizeof(double)] = { 0.0 };
+    size_t colunas = (size_t) escritor->nColunas;
+    size_t preenchimento = (size_t)(escritor->passo - escritor->nColunas);
+    if (fwrite(linha, sizeof(double), colunas, escritor->arquivo) != colunas ||
+        fwrite(zeros, sizeof(double), preenchimento, escritor->arquivo) != preenchimento) {
+        return MATRIZ_BIN_ERRO_ES;
+    }
+    escritor->soma = matrizBinSoma(escritor->soma, linha, colunas);
+    escritor->soma = matrizBinSoma(escritor->soma, zeros, preenchimento);
+    escritor->linhasGravadas++;
+    return MATRIZ_BIN_OK;
+}
+
+MatrizBinStatus matrizBinConcluirEscrita(MatrizBinEscritor* escritor) {
+    if (!escritor->arquivo) return MATRIZ_BIN_ERRO_ES;
+
+    MatrizBinStatus status = MATRIZ_BIN_OK;
+    if (escritor->linhasGravadas != escritor->nLinhas) {
+        status = MATRIZ_BIN_FORMATO;
+    } else {
+        MatrizBinCabecalho cabecalho;
+        preencherCabecalho(&cabecalho, escritor);
+        if (fseek(escritor->arquivo, 0, SEEK_SET) != 0 ||
+            fwrite(&cabecalho, sizeof(cabecalho), 1, escritor->arquivo) != 1) {
+            status = MATRIZ_BIN_ERRO_ES;
+        }
+    }
+    if (fclose(escritor->arquivo) != 0 && status == MATRIZ_BIN_OK) status = MATRIZ_BIN_ERRO_ES;
+    escritor->arquivo = NULL;
+    return status;
+}
+
+MatrizBinStatus matrizBinSalvar(const char* caminho, double** linhas, int nLinhas, int nColunas) {
+    MatrizBinEscritor escritor;
+    MatrizBinStatus status = matrizBinIniciarEscrita(&escritor, caminho, nLinhas, nColunas);
+    for (int linha = 0; linha < nLinhas && status == MATRIZ_BIN_OK; linha++) {
+        status = matrizBinEscreverLinha(&escritor, linhas[linha]);
+    }
+    if (escritor.arquivo) {
+        MatrizBinStatus final = matrizBinConcluirEscrita(&escritor);
+        if (status == MATRIZ_BIN_OK) status = final;
+    }
+    return status;
+}
@@ -0,0 +1,163 @@
+#ifndef MATRIZ_BIN_H
+#define MATRIZ_BIN_H
+
+/**
+ * @file matriz_bin.h
+ * @brief Formato binário versionado de matrizes, lido por mapeamento em
+ *        memória (sem interpretação nem cópia) e gravado em fluxo.
+ *
+ * Layout do arquivo (na ordem de bytes nativa de quem gravou; `marcaBytes`
+ * faz a leitura recusar arquivos de outra ordem):
+ *
+ *     [cabeçalho: 64 bytes][dados: nLinhas × passo doubles]
+ *
+ * Os dados começam em `deslocamento` (múltiplo de MATRIZ_ALINHAMENTO) e cada
+ * linha ocupa `passo` doubles, com `passo` = @ref passoAlinhado(nColunas) e
+ * preenchimento zerado: é exatamente o layout do buffer de @ref Matriz. Como
+ * o mapeamento começa numa página, o arquivo mapeado já é uma matriz válida
+ * e vira `double**` com @ref criarVisaoMatriz.
+ *
+ * Vários processos que abrem o mesmo arquivo em modo somente leitura
+ * compartilham as mesmas páginas físicas (cache de páginas do sistema).
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "utils.h"
+
+/** Versão do formato gravada pelo escritor. */
+#define MATRIZ_BIN_VERSAO 1
+/** Marca de ordem de bytes (lida diferente numa máquina de outra ordem). */
+#define MATRIZ_BIN_MARCA_BYTES 0x01020304u
+
+/** Tipo dos elementos (só double por enquanto). */
+typedef enum {
+    MATRIZ_BIN_FLOAT64 = 1
+} MatrizBinTipo;
+
+/** Disposição dos elementos (só por linhas por enquanto). */
+typedef enum {
+    MATRIZ_BIN_POR_LINHAS = 0
+} MatrizBinLayout;
+
+/**
+ * @brief Cabeçalho do arquivo (64 bytes).
+ */
+typedef struct {
+    char     magica[8];    /**< "MATRIZB" seguido de '\0'. */
+    uint32_t versao;       /**< MATRIZ_BIN_VERSAO. */
+    uint32_t marcaBytes;   /**< MATRIZ_BIN_MARCA_BYTES. */
+    uint32_t tipo;         /**< MatrizBinTipo. */
+    uint32_t layout;       /**< MatrizBinLayout. */
+    int64_t  nLinhas;      /**< Número de linhas. */
+    int64_t  nColunas;     /**< Colunas úteis. */
+    int64_t  passo;        /**< Doubles entre linhas consecutivas (>= nColunas). */
+    uint64_t soma;         /**< Soma de verificação dos dados (ver @ref matrizBinSoma). */
+    uint64_t deslocamento; /**< Início dos dados, em bytes (múltiplo de MATRIZ_ALINHAMENTO). */
+} MatrizBinCabecalho;
+
+/**
+ * @brief Códigos de retorno das rotinas do formato.
+ */
+typedef enum {
+    MATRIZ_BIN_OK = 0,
+    MATRIZ_BIN_ERRO_ES,      /**< Falha ao abrir, ler, gravar ou mapear o arquivo. */
+    MATRIZ_BIN_FORMATO,      /**< Cabeçalho inválido, tamanho incoerente ou outra ordem de bytes. */
+    MATRIZ_BIN_VERSAO_NOVA,  /**< Versão, tipo ou layout desconhecidos. */
+    MATRIZ_BIN_SOMA,         /**< Soma de verificação não confere. */
+    MATRIZ_BIN_MEMORIA       /**< Falha de alocação. */
+} MatrizBinStatus;
+
+/**
+ * @brief Modo de mapeamento.
+ */
+typedef enum {
+    /** Páginas compartilhadas entre processos; escrever na matriz é erro (falha de segmentação). */
+    MATRIZ_BIN_SOMENTE_LEITURA = 0,
+    /** Cópia na escrita: começa compartilhada e só as páginas alteradas viram privadas
+     *  (permite eliminar no lugar sem alterar o arquivo). */
+    MATRIZ_BIN_COPIA_PRIVADA
+} MatrizBinModo;
+
+/**
+ * @brief Arquivo mapeado e a visão Matriz sobre ele.
+ */
+typedef struct {
+    Matriz* matriz;      /**< Visão sobre os dados mapeados (linhas em matriz->linhas). */
+    void*   base;        /**< Início do mapeamento (cabeçalho). */
+    size_t  tamanho;     /**< Bytes mapeados. */
+#ifdef _WIN32
+    void*   arquivo;     /**< HANDLE do arquivo. */
+    void*   mapeamento;  /**< HANDLE do mapeamento. */
+#endif
+} MatrizMapeada;
+
+/**
+ * @brief Escritor em fluxo: grava uma linha por vez, sem a matriz inteira na memória.
+ */
+typedef struct {
+    FILE*    arquivo;
+    int64_t  nLinhas;
+    int64_t  nColunas;
+    int64_t  passo;
+    int64_t  linhasGravadas;
+    uint64_t soma;       /**< Soma parcial dos dados já gravados. */
+} MatrizBinEscritor;
+
+/**
+ * @brief Mapeia o arquivo e monta a visão Matriz, sem copiar os dados.
+ *
+ * @param mapa         Estrutura a preencher.
+ * @param caminho      Arquivo no formato deste módulo.
+ * @param modo         Somente leitura (compartilhado) ou cópia privada na escrita.
+ * @param verificarSoma Se não-zero, confere a soma de verificação (lê todos os dados uma vez).
+ * @return MATRIZ_BIN_OK ou o motivo da falha (nada fica mapeado em caso de falha).
+ */
+MatrizBinStatus matrizBinAbrir(MatrizMapeada* mapa, const char* caminho,
+                               MatrizBinModo modo, int verificarSoma);
+
+/**
+ * @brief Desfaz o mapeamento e libera a visão.
+ */
+void matrizBinFechar(MatrizMapeada* mapa);
+
+/**
+ * @brief Cria o arquivo e reserva o cabeçalho (completado em @ref matrizBinConcluirEscrita).
+ */
+MatrizBinStatus matrizBinIniciarEscrita(MatrizBinEscritor* escritor, const char* caminho,
+                                        int nLinhas, int nColunas);
+
+/**
+ * @brief Grava a próxima linha (nColunas valores; o preenchimento é acrescentado).
+ */
+MatrizBinStatus matrizBinEscreverLinha(MatrizBinEscritor* escritor, const double* linha);
+
+/**
+ * @brief Grava o cabeçalho final e fecha o arquivo.
+ *
+ * @return MATRIZ_BIN_FORMATO se nem todas as linhas foram gravadas.
+ */
+MatrizBinStatus matrizBinConcluirEscrita(MatrizBinEscritor* escritor);
+
+/**
+ * @brief Grava uma matriz `double**` inteira (atalho para o escritor em fluxo).
+ */
+MatrizBinStatus matrizBinSalvar(const char* caminho, double** linhas, int nLinhas, int nColunas);
+
+/**
+ * @brief Soma de verificação de @p quantidade doubles, continuando de @p soma.
+ *
+ * FNV-1a sobre palavras de 64 bits; comece com MATRIZ_BIN_SOMA_INICIAL.
+ */
+uint64_t matrizBinSoma(uint64_t soma, const double* dados, size_t quantidade);
+
+/** Valor inicial de @ref matrizBinSoma. */
+#define MATRIZ_BIN_SOMA_INICIAL 0xcbf29ce484222325ull
+
+/**
+ * @brief Mensagem legível para um código de retorno.
+ */
+const char* matrizBinMensagem(MatrizBinStatus status);
+
+#endif /* MATRIZ_BIN_H */
@@ -0,0 +1,51 @@
+#include <math.h>
+#include "residuo_estendido.h"
+
+// ============================================================
+// Transformações exatas: a + b = s + e  e  a * b = p + e
+// ============================================================
+static inline void somaExata(double a, double b, double* s, double* e) {
+    double soma = a + b;
+    double bVirtual = soma - a;
+    *e = (a - (soma - bVirtual)) + (b - bVirtual);
+    *s = soma;
+}
+
+static inline void produtoExato(double a, double b, double* p, double* e) {
+    double produto = a * b;
+    *e = fma(a, b, -produto);
+    *p = produto;
+}
+
+/* (alto, baixo) += v, renormalizado */
+static inline void acumular(double* alto, double* baixo, double v) {
+    double s, e;
+    somaExata(*alto, v, &s, &e);
+    e += *baixo;
+    somaExata(s, e, alto, baixo);
+}
+
+// ============================================================
+// Resíduo e atualização
+// ============================================================
+double residuoEstendido(const double* linhaA, const double* vetorX, const double* caudaX,
+                        double b, int tamanho) {
+    double alto = b, baixo = 0.0;
+    for (int j = 0; j < tamanho; j++) {
+        double p, e;
+        produtoExato(linhaA[j], vetorX[j], &p, &e);
+        acumular(&alto, &baixo, -p);
+        baixo -= e;
+        if (caudaX) baixo -= linhaA[j] * caudaX[j];
+    }
+    return alto + baixo;
+}
+
+void somarCorrecaoEstendida(double* vetorX, double* caudaX, const double* correcao, int tamanho) {
+    for (int i = 0; i < tamanho; i++) {
+        double alto = vetorX[i], baixo = caudaX[i];
+        acumular(&alto, &baixo, correcao[i]);
+        vetorX[i] = alto;
+        caudaX[i] = baixo;
+    }
+}